@@ -7,29 +7,80 @@
  * @date March, 2020
  */
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 
 // Uses cxxopts from https://github.com/jarro2783/cxxopts under the MIT license
 #include "cxxopts/cxxopts.hxx"
 
+#include "checkpointer.h"
+#include "frame_stream.h"
 #include "grid.h"
+#include "metrics.h"
+#include "renderer.h"
 #include "world.h"
 #include "zoo.h"
 
 int main(int argc, char *argv[]) {
 
+    // Let std::cout buffer on its own, so each printed frame goes out in a single write
+    std::ios::sync_with_stdio(false);
+
     cxxopts::Options options("Game_of_Life",
                              "This program implements John Conway's Game of Life for Cellular Automaton (circa 1970).");
 
     // Declare the valid command line arguments and their types and default values.
     options.add_options()
-            ("f,file", "Load an ascii file from the provided path.", cxxopts::value<std::string>())
-            ("o,output", "Save an ascii file to the provided path.", cxxopts::value<std::string>())
+            ("f,file", "Load a file from the provided path, as .bgol, .rle, .cgol or otherwise ascii.",
+             cxxopts::value<std::string>())
+            ("o,output", "Save a file to the provided path, as .bgol, .rle, .cgol or otherwise ascii.",
+             cxxopts::value<std::string>())
             ("s,steps", "The number of steps to simulate the world.", cxxopts::value<int>()->default_value("10"))
             ("e,every", "Print world to the console every N steps. 0 disables printing.",
              cxxopts::value<int>()->default_value("0"))
+            ("fps", "Print at most N frames a second, dropping the frames in between. 0 for no limit.",
+             cxxopts::value<int>()->default_value("0"))
+            ("viewport", "Print only the part x,y,width,height of the world.", cxxopts::value<std::string>())
+            ("columns", "Shrink printed frames to fit N columns. 0 fits the terminal if printing to one.",
+             cxxopts::value<int>()->default_value("0"))
+            ("rows", "Shrink printed frames to fit N rows. 0 fits the terminal if printing to one.",
+             cxxopts::value<int>()->default_value("0"))
             ("t,toroidal", "Simulate the Game of Life on a torus.", cxxopts::value<bool>()->default_value("false"))
+            ("j,threads", "The number of threads to simulate the world with. 0 uses every hardware thread.",
+             cxxopts::value<int>()->default_value("1"))
+            ("rule", "The rule to simulate the world with, in B/S notation such as B36/S23.",
+             cxxopts::value<std::string>()->default_value("B3/S23"))
+            ("engine", "The engine to simulate the world with, dense, hashlife or gpu. hashlife needs --unbounded.",
+             cxxopts::value<std::string>()->default_value("dense"))
+            ("unbounded", "Treat the world as a window onto an unbounded plane, where cells that leave it carry on "
+                          "evolving and can come back in. Only the hashlife engine simulates this, and requires it.",
+             cxxopts::value<bool>()->default_value("false"))
+            ("checkpoint-every", "Checkpoint the world in the background every N steps. 0 disables checkpoints.",
+             cxxopts::value<int>()->default_value("0"))
+            ("checkpoint", "The path prefix of the checkpoint files.",
+             cxxopts::value<std::string>()->default_value("checkpoint"))
+            ("resume", "Resume from the latest checkpoint if there is one, running the steps left of --steps.",
+             cxxopts::value<bool>()->default_value("false"))
+            ("detect-cycles", "Watch for cycles up to N steps long, skipping ahead once one is found. 0 disables.",
+             cxxopts::value<int>()->default_value("0"))
+            ("temporal-blocking", "Advance N generations of each band of the world at a time while not printing.",
+             cxxopts::value<int>()->default_value("1"))
+            ("frames", "Stream frames as binary to the provided path, a file or a named pipe, for visualisers to read.",
+             cxxopts::value<std::string>())
+            ("frames-every", "Stream a frame every N steps.", cxxopts::value<int>()->default_value("1"))
+            ("frames-encoding", "Stream each frame whole as bitplanes, or as a delta of the cells that changed.",
+             cxxopts::value<std::string>()->default_value("delta"))
+            ("frames-compress", "Compress streamed frames with zstd, in builds configured with GOL_WITH_ZSTD.",
+             cxxopts::value<bool>()->default_value("false"))
+            ("metrics", "Report every step as json lines, or totals as prometheus metrics once the run ends.",
+             cxxopts::value<std::string>())
+            ("metrics-file", "Write the metrics to the provided path instead of the error stream.",
+             cxxopts::value<std::string>())
             ("h,help", "Print usage.");
 
     // Actually parse the command line arguments
@@ -45,14 +96,81 @@ int main(int argc, char *argv[]) {
     const int steps = result["steps"].as<int>();
     const int every = result["every"].as<int>();
     const bool toroidal = result["toroidal"].as<bool>();
+    const int threads = result["threads"].as<int>();
+    const std::string engine = result["engine"].as<std::string>();
+    const bool unbounded = result["unbounded"].as<bool>();
+    const int checkpoint_every = result["checkpoint-every"].as<int>();
+    const std::string checkpoint = result["checkpoint"].as<std::string>();
+    const int frames_every = result.count("frames") ? result["frames-every"].as<int>() : 0;
+    const std::string frames_encoding = result["frames-encoding"].as<std::string>();
+
+    if (engine != "dense" && engine != "hashlife" && engine != "gpu") {
+        std::cerr << "Unknown engine " << engine << std::endl;
+        std::exit(-1);
+    }
+    if ((engine == "hashlife") != unbounded) {
+        std::cerr << "The hashlife engine simulates an unbounded plane, and is the only one that does, "
+                  << "so --engine hashlife and --unbounded must be given together" << std::endl;
+        std::exit(-1);
+    }
+
+    if (result.count("frames") && frames_every <= 0) {
+        std::cerr << "Frames must be streamed every 1 or more steps" << std::endl;
+        std::exit(-1);
+    }
+    if (frames_encoding != "delta" && frames_encoding != "bitplanes") {
+        std::cerr << "Unknown frame encoding " << frames_encoding << std::endl;
+        std::exit(-1);
+    }
+
+    // Fit printed frames to the terminal unless told otherwise, leaving room for the border and step line
+    int columns = result["columns"].as<int>(), rows = result["rows"].as<int>();
+    int terminal_columns = 0, terminal_rows = 0;
+    if (Renderer::terminal_size(terminal_columns, terminal_rows)) {
+        if (columns == 0) columns = std::max(terminal_columns - 2, 1);
+        if (rows == 0) rows = std::max(terminal_rows - 4, 1);
+    }
+
+    // Parse the viewport if only part of the world should be printed
+    int viewport[4] = {0, 0, 0, 0};
+    if (result.count("viewport")) {
+        std::istringstream view(result["viewport"].as<std::string>());
+        char comma = ',';
+        view >> viewport[0];
+        for (int i = 1; i < 4 && view && comma == ','; i++) view >> comma >> viewport[i];
+        if (!view || comma != ',' || !view.eof()) {
+            std::cerr << "Viewport must be x,y,width,height" << std::endl;
+            std::exit(-1);
+        }
+    }
+
+    // Open the metrics stream if metrics were asked for
+    std::unique_ptr<Metrics> metrics;
+    std::ofstream metrics_file;
+    if (result.count("metrics")) {
+        const std::string format = result["metrics"].as<std::string>();
+        if (format != "json" && format != "prometheus") {
+            std::cerr << "Unknown metrics format " << format << std::endl;
+            std::exit(-1);
+        }
+        if (result.count("metrics-file")) {
+            metrics_file.open(result["metrics-file"].as<std::string>());
+            if (!metrics_file) {
+                std::cerr << "File cannot be written" << std::endl;
+                std::exit(-1);
+            }
+        }
+        metrics.reset(new Metrics(metrics_file.is_open() ? metrics_file : std::cerr,
+                                  format == "json" ? Metrics::Format::JsonLines : Metrics::Format::Prometheus));
+    }
 
     // Start with an empty grid
     Grid grid;
 
-    // Attempt to read in and parse the input file as an ascii .gol file if a path was given
+    // Attempt to read in and parse the input file in the format of its extension if a path was given
     if (result.count("file")) {
         try {
-            grid = Zoo::load_ascii(result["file"].as<std::string>());
+            grid = Zoo::load(result["file"].as<std::string>());
         }
         catch (const std::exception &ex) {
             std::cerr << ex.what() << std::endl;
@@ -60,23 +178,115 @@ int main(int argc, char *argv[]) {
         }
     }
 
-    // Construct a world from the parsed grid
+    // Pick up from the latest checkpoint instead if asked to
+    std::uint64_t start = 0;
+    if (result["resume"].as<bool>()) {
+        try {
+            if (Checkpointer::load_latest(checkpoint, grid, start)) {
+                std::cout << "Resuming from step " << start << std::endl;
+            }
+        }
+        catch (const std::exception &ex) {
+            std::cerr << ex.what() << std::endl;
+            std::exit(-1);
+        }
+    }
+
+    // Construct a world from the parsed grid, counting generations on from the checkpoint if resuming
     World world(grid);
+    if (start > 0) world.reset(grid, start);
+    world.set_threads(threads);
+    try {
+        world.set_rule(Rule(result["rule"].as<std::string>()));
+        world.set_temporal_blocking(result["temporal-blocking"].as<int>());
+        if (engine == "hashlife") world.set_engine(World::Engine::HashLife, unbounded);
+        if (engine == "gpu") world.set_engine(World::Engine::Gpu);
+    }
+    catch (const std::exception &ex) {
+        std::cerr << ex.what() << std::endl;
+        std::exit(-1);
+    }
+    world.set_cycle_detection(result["detect-cycles"].as<int>());
+    world.set_metrics(metrics.get());
 
     // Print the initial state of the grid
     std::cout << "Initial state..." << std::endl
               << "Alive " << world.get_alive_cells() << " | Dead " << world.get_dead_cells() << std::endl
               << world.get_state() << std::endl;
 
-    // Perform the requested number of update steps
-    for (int step = 0; step < steps; step++) {
-        world.step(toroidal);
+    // Perform the requested number of update steps, all at once if none of them are printed or checkpointed
+    try {
+        std::unique_ptr<Checkpointer> checkpointer;
+        if (checkpoint_every > 0) checkpointer.reset(new Checkpointer(checkpoint));
+
+        // Frames are drawn on a thread of their own, so a slow terminal never holds up the steps
+        std::unique_ptr<Renderer> renderer;
+        if (every > 0) renderer.reset(new Renderer(std::cout, columns, rows, result["fps"].as<int>()));
+
+        // Only the viewport is taken from the world for each frame, clipped to the world
+        const int view_x = std::min(std::max(viewport[0], 0), world.get_width());
+        const int view_y = std::min(std::max(viewport[1], 0), world.get_height());
+        const int view_width = viewport[2] > 0 ? std::min(viewport[2], world.get_width() - view_x) : world.get_width() - view_x;
+        const int view_height = viewport[3] > 0 ? std::min(viewport[3], world.get_height() - view_y)
+                                                : world.get_height() - view_y;
 
-        // Print the state of the grid every N steps
-        if ((every > 0) && (step % every == 0)) {
-            std::cout << "Step " << (step + 1) << " of " << steps << std::endl
-                      << world.get_state() << std::endl;
+        // Frames are encoded and written on a thread of their own, and every one is kept, unlike printed frames
+        std::ofstream frames_file;
+        std::unique_ptr<FrameWriter> frames;
+        if (frames_every > 0) {
+            frames_file.open(result["frames"].as<std::string>(), std::ios::out | std::ios::binary);
+            if (!frames_file) {
+                throw std::runtime_error("File cannot be written");
+            }
+            frames.reset(new FrameWriter(frames_file, view_width, view_height,
+                                         frames_encoding == "delta" ? FrameWriter::Encoding::Delta
+                                                                    : FrameWriter::Encoding::Bitplanes,
+                                         result["frames-compress"].as<bool>()));
+            frames->submit(world.get_state(view_x, view_y, view_width, view_height), start);
         }
+
+        const bool stepwise = every > 0 || checkpoint_every > 0 || frames_every > 0;
+        if (!stepwise && start < std::uint64_t(steps)) {
+            world.advance(steps - int(start), toroidal);
+        }
+        for (int step = int(start); stepwise && step < steps; step++) {
+            world.step(toroidal);
+
+            // Print the state of the grid every N steps
+            if (every > 0 && step % every == 0) {
+                const std::string title = "Step " + std::to_string(step + 1) + " of " + std::to_string(steps);
+                if (result.count("viewport")) {
+                    renderer->submit(world.get_state(view_x, view_y, view_width, view_height), title);
+                } else {
+                    renderer->submit(world.get_state(), title);
+                }
+            }
+
+            // Stream the viewport every N steps, which is the whole world unless one was given
+            if (frames_every > 0 && (step + 1) % frames_every == 0) {
+                frames->submit(world.get_state(view_x, view_y, view_width, view_height), std::uint64_t(step + 1));
+            }
+
+            // Hand a snapshot to the checkpoint writer every N steps, it is written while stepping carries on
+            if (checkpoint_every > 0 && (step + 1) % checkpoint_every == 0) {
+                checkpointer->submit(world.get_state(), std::uint64_t(step + 1));
+            }
+        }
+
+        if (checkpointer) checkpointer->wait();
+        if (renderer) renderer->wait();
+        if (frames) frames->wait();
+    }
+    catch (const std::exception &ex) {
+        std::cerr << ex.what() << std::endl;
+        std::exit(-1);
+    }
+
+    if (metrics) metrics->flush();
+
+    if (world.get_cycle_period() > 0) {
+        std::cout << "Cycle of period " << world.get_cycle_period() << " first repeated at step "
+                  << world.get_cycle_generation() << std::endl;
     }
 
     // Print the final state of the grid
@@ -87,7 +297,7 @@ int main(int argc, char *argv[]) {
     // Attempt to save to the output directory if a path was given
     if (result.count("output")) {
         try {
-            Zoo::save_ascii(result["output"].as<std::string>(), world.get_state());
+            Zoo::save(result["output"].as<std::string>(), world.get_state(), world.get_rule());
         }
         catch (const std::exception &ex) {
             std::cerr << ex.what() << std::endl;
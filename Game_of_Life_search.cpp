@@ -0,0 +1,88 @@
+/**
+ * Runs a census of random soups on every core, recording how each one settles.
+ * Run with -h or --help to print the usage message.
+ * i.e.
+ * ./GameOfLife_search --soups 1000000 --output census.bin
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+// Uses cxxopts from https://github.com/jarro2783/cxxopts under the MIT license
+#include "cxxopts/cxxopts.hxx"
+
+#include "rule.h"
+#include "soup_search.h"
+
+int main(int argc, char *argv[]) {
+
+    cxxopts::Options options("GameOfLife_search",
+                             "This program runs random soups of the Game of Life until they settle, recording a census.");
+
+    // Declare the valid command line arguments and their types and default values.
+    options.add_options()
+            ("n,soups", "The number of soups to run.", cxxopts::value<std::uint32_t>()->default_value("10000"))
+            ("first", "The number of the first soup, to carry on from an earlier search.",
+             cxxopts::value<std::uint64_t>()->default_value("0"))
+            ("seed", "The seed the soups are generated from.", cxxopts::value<std::uint64_t>()->default_value("0"))
+            ("soup-size", "The edge of each square soup, from 1 to 64.", cxxopts::value<int>()->default_value("16"))
+            ("world-size", "The edge of the square world each soup is run in.",
+             cxxopts::value<int>()->default_value("128"))
+            ("g,generations", "The number of generations each soup is given to settle.",
+             cxxopts::value<int>()->default_value("5000"))
+            ("max-period", "The longest cycle to watch each soup for.", cxxopts::value<int>()->default_value("60"))
+            ("t,toroidal", "Run the soups on a torus.", cxxopts::value<bool>()->default_value("false"))
+            ("j,threads", "The number of workers to run soups on. 0 uses every hardware thread.",
+             cxxopts::value<int>()->default_value("0"))
+            ("rule", "The rule to run the soups by, in B/S notation such as B36/S23.",
+             cxxopts::value<std::string>()->default_value("B3/S23"))
+            ("o,output", "Write the census of every soup to the provided path.", cxxopts::value<std::string>())
+            ("h,help", "Print usage.");
+
+    // Actually parse the command line arguments
+    auto result = options.parse(argc, argv);
+
+    // Print the help usage for this program
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        std::exit(0);
+    }
+
+    const std::uint32_t soups = result["soups"].as<std::uint32_t>();
+    const std::string output = result.count("output") ? result["output"].as<std::string>() : std::string();
+
+    try {
+        SoupSearch search(result["soup-size"].as<int>(), result["world-size"].as<int>(),
+                          result["generations"].as<int>(), result["max-period"].as<int>());
+        search.set_seed(result["seed"].as<std::uint64_t>());
+        search.set_rule(Rule(result["rule"].as<std::string>()));
+        search.set_toroidal(result["toroidal"].as<bool>());
+        search.set_threads(result["threads"].as<int>());
+
+        const auto start = std::chrono::steady_clock::now();
+        const SoupSearch::Summary summary = search.run(result["first"].as<std::uint64_t>(), soups, output);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // Print the totals, then how many soups settled into each period
+        std::cout << "Soups " << summary.soups << " | Settled " << summary.settled << " | Extinct " << summary.extinct
+                  << " | Unsettled " << summary.soups - summary.settled << std::endl
+                  << "Threads " << search.get_threads() << " | " << seconds << " s | "
+                  << (seconds > 0 ? double(summary.soups) / seconds : 0.0) << " soups/s | "
+                  << (seconds > 0 ? double(summary.generations) / seconds : 0.0) << " generations/s" << std::endl;
+        for (const auto &period : summary.periods) {
+            std::cout << "Period " << period.first << " | " << period.second << std::endl;
+        }
+    }
+    catch (const std::exception &ex) {
+        std::cerr << ex.what() << std::endl;
+        std::exit(-1);
+    }
+
+    // Destructors handle all the memory deallocation
+    return 0;
+}
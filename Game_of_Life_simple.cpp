@@ -6,6 +6,7 @@
 #include <iostream>
 
 #include "grid.h"
+#include "pattern_library.h"
 #include "world.h"
 #include "zoo.h"
 
@@ -14,23 +15,23 @@ int main(int argc, char *argv[]) {
     // Start with an empty grid
     Grid grid(32, 10);
 
-    Grid glider = Zoo::glider(),
-            glider90 = glider.rotate(1),
-            glider180 = glider.rotate(2),
-            glider270 = glider.rotate(3);
+    // The library holds the zoo creatures already turned into every orientation
+    PatternLibrary library;
+    const int glider = library.find("glider");
+    const Grid &glider180 = library.get(glider, 2);
 
     // Place gliders in the 4 corners all flying towards the centre
-    grid.merge(glider, 1, 1, true);
+    library.stamp(grid, glider, 0, 1, 1);
 
-    grid.merge(glider90, ((grid.get_width() - 1) - glider90.get_width()), 1, true);
+    library.stamp(grid, glider, 1, ((grid.get_width() - 1) - library.get(glider, 1).get_width()), 1);
 
-    grid.merge(glider180, ((grid.get_width() - 1) - glider180.get_width()),
-               ((grid.get_height() - 1) - glider180.get_height()), true);
+    library.stamp(grid, glider, 2, ((grid.get_width() - 1) - glider180.get_width()),
+                  ((grid.get_height() - 1) - glider180.get_height()));
 
-    grid.merge(glider270, 1, ((grid.get_height() - 1) - glider180.get_height()), true);
+    library.stamp(grid, glider, 3, 1, ((grid.get_height() - 1) - glider180.get_height()));
 
     // Place an r-pentomino (little shape that explodes huge) in the centre of the grid.
-    grid.merge(Zoo::r_pentomino(), (grid.get_width() / 2), (grid.get_height() / 2), true);
+    library.stamp(grid, library.find("r_pentomino"), 0, (grid.get_width() / 2), (grid.get_height() / 2));
 
     // Print the initial state of the grid
     std::cout << grid << std::endl;
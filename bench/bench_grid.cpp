@@ -0,0 +1,159 @@
+/**
+ * Benchmarks for transforming grids, reported in cells per second.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include <benchmark/benchmark.h>
+
+#include "bench_util.h"
+
+#include "../pattern_library.h"
+
+/**
+ * Rotate a random soup.
+ * Arguments: edge size, quarter turns.
+ */
+static void BM_GridRotate(benchmark::State &state) {
+    const int size = int(state.range(0));
+    const Grid grid = random_soup(size, size + 7, 33);
+
+    for (auto _ : state) {
+        Grid rotated = grid.rotate(int(state.range(1)));
+        benchmark::DoNotOptimize(rotated.row_words(0));
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * grid.get_total_cells(),
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_GridRotate)->ArgNames({"size", "turns"})->ArgsProduct({{512, 4096}, {1, 2, 3}});
+
+/**
+ * Crop the middle out of a random soup, at an offset that does not line up with the packed words.
+ * Arguments: edge size.
+ */
+static void BM_GridCrop(benchmark::State &state) {
+    const int size = int(state.range(0));
+    const Grid grid = random_soup(size, size, 33);
+
+    for (auto _ : state) {
+        Grid cropped = grid.crop(size / 4 + 3, size / 4, size * 3 / 4, size * 3 / 4);
+        benchmark::DoNotOptimize(cropped.row_words(0));
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * (size / 2) * (size / 2),
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_GridCrop)->ArgName("size")->Arg(512)->Arg(4096);
+
+/**
+ * Merge a random soup into a larger grid, at an offset that does not line up with the packed words.
+ * Arguments: edge size of the merged grid, alive only.
+ */
+static void BM_GridMerge(benchmark::State &state) {
+    const int size = int(state.range(0));
+    const Grid other = random_soup(size, size, 33);
+    Grid grid = random_soup(size * 2, size * 2, 5);
+
+    for (auto _ : state) {
+        grid.merge(other, size / 2 + 5, size / 2, state.range(1) != 0);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * other.get_total_cells(),
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_GridMerge)->ArgNames({"size", "alive_only"})->ArgsProduct({{512, 4096}, {0, 1}});
+
+/**
+ * Convert a random soup to its text form, a character per cell.
+ * Arguments: edge size.
+ */
+static void BM_GridToString(benchmark::State &state) {
+    const int size = int(state.range(0));
+    const Grid grid = random_soup(size, size, 33);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(grid.to_string());
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * grid.get_total_cells(),
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_GridToString)->ArgName("size")->Arg(512)->Arg(4096);
+
+/**
+ * Place rotated copies of the patterns of the zoo across a large board, as when building a scenario.
+ * Arguments: edge size of the board.
+ */
+static void BM_GridPlacePatterns(benchmark::State &state) {
+    const int size = int(state.range(0));
+    const Grid patterns[] = {zoo_pattern(0), zoo_pattern(1), zoo_pattern(2)};
+    Grid board(size, size);
+
+    int placed = 0;
+    for (auto _ : state) {
+        for (int y = 0; y + 16 <= size; y += 16) {
+            for (int x = 0; x + 16 <= size; x += 16) {
+                const int index = (x / 16 + y / 16) % 3;
+                board.merge(patterns[index].rotate(x / 16), x + y % 7, y, true);
+                placed++;
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["patterns/s"] = benchmark::Counter(double(placed), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_GridPlacePatterns)->ArgName("size")->Arg(1024)->Arg(4096);
+
+/**
+ * Place the same patterns as BM_GridPlacePatterns, stamping them pre-turned from a pattern library.
+ * Arguments: edge size of the board.
+ */
+static void BM_LibraryPlacePatterns(benchmark::State &state) {
+    const int size = int(state.range(0));
+    const PatternLibrary library;
+    Grid board(size, size);
+
+    int placed = 0;
+    for (auto _ : state) {
+        for (int y = 0; y + 16 <= size; y += 16) {
+            for (int x = 0; x + 16 <= size; x += 16) {
+                library.stamp(board, (x / 16 + y / 16) % 3, (x / 16) % 4, x + y % 7, y);
+                placed++;
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["patterns/s"] = benchmark::Counter(double(placed), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_LibraryPlacePatterns)->ArgName("size")->Arg(1024)->Arg(4096);
+
+/**
+ * Grow a random soup by 64 cells and shrink it back again, as a world does when its pattern spreads.
+ * Arguments: edge size, edge grown (0 the bottom, 1 the right, 2 the left and top).
+ */
+static void BM_GridResize(benchmark::State &state) {
+    const int size = int(state.range(0)), edge = int(state.range(1));
+    Grid grid = random_soup(size, size, 33);
+
+    for (auto _ : state) {
+        if (edge == 0) {
+            grid.resize(size, size + 64);
+            grid.resize(size, size);
+        } else if (edge == 1) {
+            grid.resize(size + 64, size);
+            grid.resize(size, size);
+        } else {
+            grid.resize(size + 64, size + 64, 64, 64);
+            grid.resize(size, size, -64, -64);
+        }
+        benchmark::DoNotOptimize(grid.row_words(0));
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * 2 * grid.get_total_cells(),
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_GridResize)->ArgNames({"size", "edge"})->ArgsProduct({{512, 4096}, {0, 1, 2}});
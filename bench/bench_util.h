@@ -0,0 +1,55 @@
+/**
+ * Declares helpers shared by the benchmarks for building worlds to measure.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+#include <random>
+
+#include "../grid.h"
+#include "../zoo.h"
+
+/**
+ * Fill a grid with alive cells at random, each alive with a chance of density percent.
+ */
+inline Grid random_soup(int width, int height, int density, unsigned seed = 16) {
+    std::mt19937 random(seed);
+    Grid grid(width, height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (int(random() % 100) < density) grid.set(x, y, Cell::ALIVE);
+        }
+    }
+
+    return grid;
+}
+
+/**
+ * Scatter copies of a pattern across a grid, one in every block of spacing x spacing cells.
+ */
+inline Grid scattered(const Grid &pattern, int size, int spacing) {
+    Grid grid(size, size);
+    for (int y = 0; y + spacing <= size; y += spacing) {
+        for (int x = 0; x + spacing <= size; x += spacing) {
+            grid.merge(pattern, x + spacing / 2, y + spacing / 2);
+        }
+    }
+
+    return grid;
+}
+
+/**
+ * The standard patterns of the Zoo, indexed by benchmark argument.
+ */
+inline Grid zoo_pattern(int index) {
+    switch (index) {
+        case 0:
+            return Zoo::glider();
+        case 1:
+            return Zoo::r_pentomino();
+        default:
+            return Zoo::light_weight_spaceship();
+    }
+}
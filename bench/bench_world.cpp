@@ -0,0 +1,220 @@
+/**
+ * Benchmarks for stepping and advancing worlds, reported in cells per second.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "bench_util.h"
+#include "../world.h"
+#include "../world_batch.h"
+
+/**
+ * Step a random soup of a given size, density and topology.
+ * Arguments: edge size, density percent, toroidal.
+ */
+static void BM_WorldStep(benchmark::State &state) {
+    const int size = int(state.range(0));
+    const bool toroidal = state.range(2) != 0;
+    World world(random_soup(size, size, int(state.range(1))));
+
+    for (auto _ : state) {
+        world.step(toroidal);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * world.get_total_cells(),
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_WorldStep)
+        ->ArgNames({"size", "density", "toroidal"})
+        ->ArgsProduct({{64, 512, 4096}, {5, 33}, {0, 1}});
+
+/**
+ * Step a large sparse world holding scattered copies of a standard pattern.
+ * Arguments: pattern (0 glider, 1 r-pentomino, 2 light weight spaceship), edge size.
+ */
+static void BM_WorldStepPattern(benchmark::State &state) {
+    const int size = int(state.range(1));
+    World world(scattered(zoo_pattern(int(state.range(0))), size, 512));
+
+    for (auto _ : state) {
+        world.step();
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * world.get_total_cells(),
+                                                   benchmark::Counter::kIsRate);
+    state.counters["active_tiles"] = world.get_active_tiles();
+}
+BENCHMARK(BM_WorldStepPattern)->ArgNames({"pattern", "size"})->ArgsProduct({{0, 1, 2}, {4096}});
+
+/**
+ * Step a large dense soup on a number of threads.
+ * Arguments: threads.
+ */
+static void BM_WorldStepThreads(benchmark::State &state) {
+    World world(random_soup(4096, 4096, 33));
+    world.set_threads(int(state.range(0)));
+
+    for (auto _ : state) {
+        world.step();
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * world.get_total_cells(),
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_WorldStepThreads)->ArgName("threads")->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+/**
+ * Advance a fresh copy of a random soup by a number of steps.
+ * Arguments: edge size, steps.
+ */
+static void BM_WorldAdvance(benchmark::State &state) {
+    const int size = int(state.range(0)), steps = int(state.range(1));
+    const Grid soup = random_soup(size, size, 33);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        World world(soup);
+        state.ResumeTiming();
+
+        world.advance(steps);
+        benchmark::DoNotOptimize(world.get_alive_cells());
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * size * size * steps,
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_WorldAdvance)->ArgNames({"size", "steps"})->Args({256, 1000})->Args({2048, 50});
+
+/**
+ * Advance a random soup far larger than the cache, a generation at a time or several generations per band.
+ * Arguments: size, generations per band (1 disables temporal blocking).
+ */
+static void BM_WorldAdvanceBlocked(benchmark::State &state) {
+    const int size = int(state.range(0)), depth = int(state.range(1)), steps = 16;
+    World world(random_soup(size, size, 33));
+    world.set_temporal_blocking(depth);
+
+    for (auto _ : state) {
+        world.advance(steps, true);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * world.get_total_cells() * steps,
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_WorldAdvanceBlocked)->ArgNames({"size", "depth"})->ArgsProduct({{4096, 16384}, {1, 2, 4, 8, 16}});
+
+/**
+ * Read the state of a large world after each HashLife leap, either all of it or only a window of 80x40 cells.
+ * Arguments: size, window (0 reads the whole state).
+ */
+static void BM_WorldGetState(benchmark::State &state) {
+    const int size = int(state.range(0));
+    World world(scattered(zoo_pattern(0), size, 64));
+    world.set_engine(World::Engine::HashLife, true);
+
+    for (auto _ : state) {
+        world.advance(1);
+        if (state.range(1)) {
+            benchmark::DoNotOptimize(world.get_state(size / 2, size / 2, 80, 40));
+        } else {
+            benchmark::DoNotOptimize(world.get_state().get_alive_cells());
+        }
+    }
+}
+BENCHMARK(BM_WorldGetState)->ArgNames({"size", "window"})->ArgsProduct({{1024, 8192}, {0, 1}});
+
+/**
+ * Advance a large random soup on the GPU engine, copying the state back once at the end.
+ * Arguments: size. Skipped in builds without a usable GPU.
+ */
+static void BM_WorldAdvanceGpu(benchmark::State &state) {
+    if (!GpuEngine::is_available()) {
+        state.SkipWithError("No GPU engine in this build");
+        return;
+    }
+
+    const int size = int(state.range(0)), steps = 100;
+    World world(random_soup(size, size, 33));
+    world.set_engine(World::Engine::Gpu);
+
+    for (auto _ : state) {
+        world.advance(steps, true);
+        benchmark::DoNotOptimize(world.get_alive_cells());
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * world.get_total_cells() * steps,
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_WorldAdvanceGpu)->ArgName("size")->Arg(4096)->Arg(16384);
+
+/**
+ * Step a large random soup by a rule, to compare the specialised kernels with the generic one.
+ * Arguments: rule (0 Conway, 1 HighLife, 2 Seeds, 3 Day & Night, 4 the generic kernel with B1357/S1357).
+ */
+static void BM_WorldStepRule(benchmark::State &state) {
+    const Rule rules[] = {Rule::conway(), Rule::highlife(), Rule::seeds(), Rule::day_and_night(), Rule("B1357/S1357")};
+    World world(random_soup(2048, 2048, 33));
+    world.set_rule(rules[state.range(0)]);
+
+    for (auto _ : state) {
+        world.step(true);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetLabel(rules[state.range(0)].to_string());
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * world.get_total_cells(),
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_WorldStepRule)->ArgName("rule")->DenseRange(0, 4);
+
+/**
+ * Step many small soups, either as one WorldBatch or as a World each.
+ * Arguments: number of soups, batched.
+ */
+static void BM_SmallSoups(benchmark::State &state) {
+    const int count = int(state.range(0));
+    WorldBatch batch(32, 32, state.range(1) ? count : 0);
+    std::vector<World> worlds;
+    for (int i = 0; i < count; i++) {
+        if (state.range(1)) batch.set(i, random_soup(32, 32, 33, unsigned(i)));
+        else worlds.emplace_back(random_soup(32, 32, 33, unsigned(i)));
+    }
+
+    for (auto _ : state) {
+        if (state.range(1)) {
+            batch.step(true);
+        } else {
+            for (World &world : worlds) world.step(true);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["worlds/s"] = benchmark::Counter(double(state.iterations()) * count, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_SmallSoups)->ArgNames({"soups", "batched"})->ArgsProduct({{10000}, {0, 1}});
+
+/**
+ * Step a dense soup far wider than it is tall, where a single row no longer fits in the L1 cache.
+ * Arguments: width.
+ */
+static void BM_WorldStepWide(benchmark::State &state) {
+    const int width = int(state.range(0));
+    World world(random_soup(width, (1 << 24) / width, 33));
+
+    for (auto _ : state) {
+        world.step(true);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * world.get_total_cells(),
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_WorldStepWide)->ArgName("width")->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
@@ -0,0 +1,102 @@
+/**
+ * Benchmarks for saving and loading grids in each of the Zoo file formats, reported in bytes per second,
+ * and for streaming frames to a file.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "bench_util.h"
+#include "../frame_stream.h"
+#include "../world.h"
+
+/**
+ * The file formats, indexed by benchmark argument.
+ */
+static const char *FORMATS[] = {".gol", ".bgol", ".rle", ".cgol"};
+
+static std::string bench_path(int format) {
+    return (std::filesystem::temp_directory_path() / ("GameOfLife_bench" + std::string(FORMATS[format]))).string();
+}
+
+static double file_size(const std::string &path) {
+    return double(std::filesystem::file_size(path));
+}
+
+/**
+ * Save a random soup in a format.
+ * Arguments: format (0 ascii, 1 binary, 2 rle, 3 compressed), density percent.
+ */
+static void BM_ZooSave(benchmark::State &state) {
+    const int format = int(state.range(0));
+    const Grid grid = random_soup(4096, 4096, int(state.range(1)));
+    const std::string path = bench_path(format);
+
+    for (auto _ : state) {
+        Zoo::save(path, grid);
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations() * file_size(path)));
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * grid.get_total_cells(),
+                                                   benchmark::Counter::kIsRate);
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_ZooSave)->ArgNames({"format", "density"})->ArgsProduct({{0, 1, 2, 3}, {1, 33}})
+        ->Unit(benchmark::kMillisecond);
+
+/**
+ * Load a random soup saved in a format.
+ * Arguments: format (0 ascii, 1 binary, 2 rle, 3 compressed), density percent.
+ */
+static void BM_ZooLoad(benchmark::State &state) {
+    const int format = int(state.range(0));
+    const Grid grid = random_soup(4096, 4096, int(state.range(1)));
+    const std::string path = bench_path(format);
+    Zoo::save(path, grid);
+
+    for (auto _ : state) {
+        Grid loaded = Zoo::load(path);
+        benchmark::DoNotOptimize(loaded.row_words(0));
+    }
+
+    state.SetBytesProcessed(std::int64_t(state.iterations() * file_size(path)));
+    state.counters["cells/s"] = benchmark::Counter(double(state.iterations()) * grid.get_total_cells(),
+                                                   benchmark::Counter::kIsRate);
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_ZooLoad)->ArgNames({"format", "density"})->ArgsProduct({{0, 1, 2, 3}, {1, 33}})
+        ->Unit(benchmark::kMillisecond);
+
+/**
+ * Stream the generations of a stepping soup to a file through a FrameWriter, reported in frames per second.
+ * Arguments: edge size, encoding (0 bitplanes, 1 delta).
+ */
+static void BM_FrameStream(benchmark::State &state) {
+    const int size = int(state.range(0));
+    World world(random_soup(size, size, 33));
+    std::vector<Grid> frames;
+    for (int i = 0; i < 64; i++, world.step()) frames.push_back(world.get_state());
+
+    const std::string path = (std::filesystem::temp_directory_path() / "GameOfLife_bench.golf").string();
+    std::ofstream file(path, std::ios::out | std::ios::binary);
+    FrameWriter writer(file, size, size, state.range(1) ? FrameWriter::Encoding::Delta : FrameWriter::Encoding::Bitplanes);
+
+    std::uint64_t generation = 0;
+    for (auto _ : state) {
+        writer.submit(frames[generation % frames.size()], generation);
+        generation++;
+    }
+    writer.wait();
+
+    state.counters["frames/s"] = benchmark::Counter(double(state.iterations()), benchmark::Counter::kIsRate);
+    file.close();
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_FrameStream)->ArgNames({"size", "delta"})->ArgsProduct({{512, 2048}, {0, 1}})->UseRealTime();
@@ -0,0 +1,275 @@
+/**
+ * A runner for the benchmarks that fails when their rates fall below a stored baseline, built as GameOfLife_perf.
+ *      - Every benchmark reports a rate as a counter ending in "/s", usually cells updated per second.
+ *      - Each is repeated and the median of its rates kept, so a few runs slowed by a busy machine do not fail
+ *        the check.
+ *      - A benchmark whose rates vary by more than the threshold between repetitions is run again, up to a
+ *        number of retries. One still that noisy cannot be judged, and fails the check like a regression.
+ *      - Baselines are stored per CPU, as rates only compare on the machine that recorded them. Each is a text
+ *        file of a benchmark name and its rate per line, in a directory of baselines named after the CPU model
+ *        and thread count, or in an explicit file.
+ *      - A missing baseline fails the check, unless it is allowed to be missing. --update records one.
+ *
+ * The make targets perf_check and perf_baseline run it with the filter and threshold configured in CMake,
+ * against bench/baselines.
+ *
+ * @example
+ *
+ *      // Fail if any world step benchmark is more than 15% slower than the baseline recorded for this CPU
+ *      ./GameOfLife_perf --baselines=../bench/baselines --threshold=15 --benchmark_filter=BM_WorldStep/
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * A console reporter that also keeps the rate of every repetition of every benchmark.
+ * Only the aggregates of repeated benchmarks are shown, as a console reporter would with aggregates only.
+ */
+class RateReporter : public benchmark::ConsoleReporter {
+public:
+    std::map<std::string, std::vector<double>> rates;
+
+    void ReportRuns(const std::vector<Run> &reports) override {
+        std::vector<Run> shown;
+        for (const Run &run : reports) {
+            if (run.run_type == Run::RT_Aggregate || run.repetitions <= 1) shown.push_back(run);
+            if (run.run_type == Run::RT_Aggregate || run.error_occurred) continue;
+
+            for (const auto &counter : run.counters) {
+                const std::string &name = counter.first;
+                if (name.size() > 2 && name.compare(name.size() - 2, 2, "/s") == 0) {
+                    rates[run.run_name.str()].push_back(counter.second.value);
+                    break;
+                }
+            }
+        }
+        ConsoleReporter::ReportRuns(shown);
+    }
+};
+
+/**
+ * The median of the rates of a benchmark's repetitions.
+ */
+static double median(std::vector<double> rates) {
+    std::sort(rates.begin(), rates.end());
+    const std::size_t middle = rates.size() / 2;
+
+    return rates.size() % 2 ? rates[middle] : (rates[middle - 1] + rates[middle]) / 2;
+}
+
+/**
+ * The coefficient of variation of the rates of a benchmark's repetitions, as a percent of their mean.
+ */
+static double variation(const std::vector<double> &rates) {
+    if (rates.size() < 2) return 0;
+    double mean = 0, squares = 0;
+    for (const double rate : rates) mean += rate;
+    mean /= double(rates.size());
+    for (const double rate : rates) squares += (rate - mean) * (rate - mean);
+
+    return mean > 0 ? 100 * std::sqrt(squares / double(rates.size() - 1)) / mean : 0;
+}
+
+/**
+ * The names of the benchmarks whose rates vary by more than the threshold between repetitions.
+ */
+static std::set<std::string> noisy_benchmarks(const std::map<std::string, std::vector<double>> &rates,
+                                              double threshold) {
+    std::set<std::string> noisy;
+    for (const auto &rate : rates) {
+        if (variation(rate.second) > threshold) noisy.insert(rate.first);
+    }
+
+    return noisy;
+}
+
+/**
+ * A filter matching exactly the benchmarks named, escaping what a regular expression would read as special.
+ */
+static std::string exact_filter(const std::set<std::string> &names) {
+    std::string filter = "^(";
+    for (const std::string &name : names) {
+        if (filter.size() > 2) filter += '|';
+        for (const char c : name) {
+            if (std::strchr("\\^$.|?*+()[]{}", c)) filter += '\\';
+            filter += c;
+        }
+    }
+
+    return filter + ")$";
+}
+
+/**
+ * The name of the baseline file for this machine, from the CPU model and the number of hardware threads,
+ * such as intel-r-xeon-r-processor-8-threads.txt.
+ */
+static std::string cpu_baseline_name() {
+    std::string model;
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (model.empty() && std::getline(cpuinfo, line)) {
+        const std::size_t colon = line.find(':');
+        if (colon != std::string::npos && (line.rfind("model name", 0) == 0 || line.rfind("Model", 0) == 0)) {
+            model = line.substr(colon + 1);
+        }
+    }
+    if (model.empty()) model = "unknown cpu";
+
+    std::string name;
+    for (const char c : model) {
+        if (std::isalnum((unsigned char) c)) name += char(std::tolower((unsigned char) c));
+        else if (!name.empty() && name.back() != '-') name += '-';
+    }
+    if (!name.empty() && name.back() == '-') name.pop_back();
+
+    return name + "-" + std::to_string(std::thread::hardware_concurrency()) + "-threads.txt";
+}
+
+/**
+ * Read the rates of a baseline file, skipping blank lines and comments starting with #.
+ */
+static std::map<std::string, double> load_baseline(const std::string &path) {
+    std::map<std::string, double> rates;
+    std::ifstream file(path);
+    std::string name;
+    while (file >> name) {
+        if (name[0] == '#') {
+            std::getline(file, name);
+            continue;
+        }
+        double rate = 0;
+        if (file >> rate) rates[name] = rate;
+    }
+
+    return rates;
+}
+
+static bool save_baseline(const std::string &path, const std::map<std::string, double> &rates) {
+    std::error_code error;
+    const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    if (!directory.empty()) std::filesystem::create_directories(directory, error);
+
+    std::ofstream file(path);
+    file << "# The median rates perf_check compares against on this CPU, written by perf_baseline.\n";
+    file.precision(6);
+    for (const auto &rate : rates) {
+        file << rate.first << ' ' << rate.second << '\n';
+    }
+
+    return bool(file);
+}
+
+int main(int argc, char **argv) {
+    std::string baseline_path, baselines = "baselines";
+    double threshold = 15;
+    int retries = 3;
+    bool update = false, allow_missing = false;
+
+    // Repeat by default, which the command line can still override, and take out the options of this runner
+    std::vector<char *> args = {argv[0]};
+    char repetitions[] = "--benchmark_repetitions=10";
+    args.push_back(repetitions);
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], "--baseline=", 11) == 0) baseline_path = argv[i] + 11;
+        else if (std::strncmp(argv[i], "--baselines=", 12) == 0) baselines = argv[i] + 12;
+        else if (std::strncmp(argv[i], "--threshold=", 12) == 0) threshold = std::atof(argv[i] + 12);
+        else if (std::strncmp(argv[i], "--retries=", 10) == 0) retries = std::atoi(argv[i] + 10);
+        else if (std::strcmp(argv[i], "--allow-missing-baseline") == 0) allow_missing = true;
+        else if (std::strcmp(argv[i], "--update") == 0) update = true;
+        else args.push_back(argv[i]);
+    }
+    if (baseline_path.empty()) baseline_path = (std::filesystem::path(baselines) / cpu_baseline_name()).string();
+
+    int count = int(args.size());
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data())) return 1;
+
+    RateReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+
+    // Run the noisy benchmarks again in the hope of a quieter moment, keeping only their latest rates
+    std::set<std::string> noisy = noisy_benchmarks(reporter.rates, threshold);
+    for (int retry = 0; retry < retries && !noisy.empty(); retry++) {
+        std::printf("\nRunning %zu noisy benchmarks again, retry %d of %d\n", noisy.size(), retry + 1, retries);
+        for (const std::string &name : noisy) reporter.rates.erase(name);
+        benchmark::RunSpecifiedBenchmarks(&reporter, exact_filter(noisy));
+
+        std::map<std::string, std::vector<double>> rerun;
+        for (const std::string &name : noisy) {
+            if (reporter.rates.count(name)) rerun[name] = reporter.rates[name];
+        }
+        noisy = noisy_benchmarks(rerun, threshold);
+    }
+    benchmark::Shutdown();
+
+    if (update) {
+        if (!noisy.empty()) {
+            std::cerr << noisy.size() << " benchmarks still varied by more than " << threshold
+                      << "% between repetitions, so their baselines will be noisy too" << std::endl;
+        }
+        std::map<std::string, double> rates = load_baseline(baseline_path);
+        for (const auto &rate : reporter.rates) rates[rate.first] = median(rate.second);
+        if (!save_baseline(baseline_path, rates)) {
+            std::cerr << "Could not write the baseline " << baseline_path << std::endl;
+            return 1;
+        }
+        std::cout << "Recorded " << reporter.rates.size() << " rates in " << baseline_path << std::endl;
+        return 0;
+    }
+
+    const std::map<std::string, double> baseline = load_baseline(baseline_path);
+    if (baseline.empty()) {
+        std::cerr << "There is no baseline in " << baseline_path << ", record one for this CPU with perf_baseline"
+                  << std::endl;
+        return allow_missing ? 0 : 1;
+    }
+
+    int regressions = 0, unjudged = 0;
+    std::printf("\n%-60s %12s %12s %8s %8s\n", "Benchmark", "Baseline", "Now", "CV", "Change");
+    for (const auto &rate : reporter.rates) {
+        const double now = median(rate.second), cv = variation(rate.second);
+        const auto found = baseline.find(rate.first);
+        if (found == baseline.end()) {
+            std::printf("%-60s %12s %12.4g %7.1f%% %8s\n", rate.first.c_str(), "-", now, cv, "new");
+            continue;
+        }
+
+        // A benchmark that varies more than the threshold between repetitions could hide a regression that large
+        const double change = 100 * (now / found->second - 1);
+        const bool too_noisy = noisy.count(rate.first) > 0, regressed = !too_noisy && change < -threshold;
+        unjudged += too_noisy;
+        regressions += regressed;
+        std::printf("%-60s %12.4g %12.4g %7.1f%% %+7.1f%%%s\n", rate.first.c_str(), found->second, now, cv, change,
+                    regressed ? "  REGRESSED" : too_noisy ? "  TOO NOISY" : "");
+    }
+
+    if (unjudged > 0) {
+        std::printf("\n%d of %zu benchmarks still varied by more than %g%% between repetitions after %d retries\n",
+                    unjudged, reporter.rates.size(), threshold, retries);
+    }
+    if (regressions > 0) {
+        std::printf("\n%d of %zu benchmarks fell more than %g%% below their baseline\n", regressions,
+                    reporter.rates.size(), threshold);
+    }
+    if (regressions > 0 || unjudged > 0) return 1;
+
+    std::printf("\nAll %zu benchmarks are within %g%% of their baseline\n", reporter.rates.size(), threshold);
+    return 0;
+}
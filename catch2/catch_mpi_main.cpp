@@ -0,0 +1,13 @@
+#define CATCH_CONFIG_RUNNER
+
+#include "catch.hpp"
+
+#include <mpi.h>
+
+// Every rank runs the same test cases, which must reach each collective call together.
+int main(int argc, char *argv[]) {
+    MPI_Init(&argc, &argv);
+    const int result = Catch::Session().run(argc, argv);
+    MPI_Finalize();
+    return result;
+}
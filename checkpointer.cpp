@@ -0,0 +1,242 @@
+/**
+ * Implements a class for saving checkpoints of a long running simulation on a background thread.
+ *      - A checkpoint named by a prefix is made of:
+ *          - a compressed grid file "(prefix)-(generation).cgol", see Zoo::save_compressed(path, grid).
+ *          - a manifest file "(prefix).manifest" naming the generation and grid file of the latest checkpoint.
+ *
+ *      - Every file is written under a temporary name and then renamed into place, and the manifest is only
+ *        updated once its grid file is complete, so a crash at any point leaves the last checkpoint intact.
+ *          - The grid file of the previous checkpoint is removed once the manifest no longer names it.
+ *
+ *      - Errors on the writer thread are kept and thrown from the next call to submit or wait.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "checkpointer.h"
+#include "zoo.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * read_manifest(prefix, generation, file)
+ *
+ * Private helper function to read the manifest of the latest checkpoint with a prefix.
+ *
+ * @return
+ *      False if there is no manifest.
+ *
+ * @throws
+ *      std::runtime_error if the manifest is malformed.
+ */
+static bool read_manifest(const std::string &prefix, std::uint64_t &generation, std::string &file) {
+    std::ifstream manifest(prefix + ".manifest");
+    if (!manifest) return false;
+
+    std::string generation_key, file_key;
+    if (!(manifest >> generation_key >> generation >> file_key) || generation_key != "generation" ||
+        file_key != "file") {
+        throw std::runtime_error("Checkpoint manifest is malformed");
+    }
+    manifest >> std::ws;
+    if (!std::getline(manifest, file) || file.empty()) {
+        throw std::runtime_error("Checkpoint manifest is malformed");
+    }
+    return true;
+}
+
+/**
+ * Checkpointer::Checkpointer(prefix)
+ *
+ * Construct a checkpointer and start its writer thread.
+ * An existing checkpoint with the same prefix is kept until the first new one replaces it.
+ *
+ * @example
+ *
+ *      // Checkpoint a world every 1000 steps while it runs
+ *      Checkpointer checkpointer("runs/soup");
+ *      for (int step = 1; step <= steps; step++) {
+ *          world.step();
+ *          if (step % 1000 == 0) checkpointer.submit(world.get_state(), step);
+ *      }
+ *
+ * @param prefix
+ *      The path every file of the checkpoint starts with.
+ */
+Checkpointer::Checkpointer(std::string prefix)
+        : _prefix(std::move(prefix)), _pending_generation(0), _has_pending(false), _busy(false), _stopping(false) {
+    std::uint64_t generation = 0;
+    try {
+        read_manifest(_prefix, generation, _last_file);
+    }
+    catch (const std::runtime_error &) {
+        // A broken manifest is simply replaced by the first checkpoint
+    }
+
+    _writer = std::thread(&Checkpointer::work, this);
+}
+
+/**
+ * Checkpointer::~Checkpointer()
+ *
+ * Finish writing the latest snapshot, then stop the writer thread. Errors are dropped, call wait first to see them.
+ */
+Checkpointer::~Checkpointer() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wake.notify_one();
+    _writer.join();
+}
+
+/**
+ * Checkpointer::submit(grid, generation)
+ *
+ * Hand a snapshot of a grid to the writer thread, and return straight away.
+ * The grid is copied into the pending buffer, replacing any snapshot the writer has not started on yet.
+ *
+ * @param grid
+ *      The grid to checkpoint.
+ *
+ * @param generation
+ *      The generation the grid is a snapshot of.
+ *
+ * @throws
+ *      Rethrows the exception from the last failed write, if there was one since it was last thrown.
+ */
+void Checkpointer::submit(const Grid &grid, std::uint64_t generation) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_error) std::rethrow_exception(std::exchange(_error, nullptr));
+
+        _pending = grid;
+        _pending_generation = generation;
+        _has_pending = true;
+    }
+    _wake.notify_one();
+}
+
+/**
+ * Checkpointer::wait()
+ *
+ * Block until every submitted snapshot has been written or replaced.
+ *
+ * @throws
+ *      Rethrows the exception from the last failed write, if there was one since it was last thrown.
+ */
+void Checkpointer::wait() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idle.wait(lock, [this] { return !_has_pending && !_busy; });
+
+    if (_error) std::rethrow_exception(std::exchange(_error, nullptr));
+}
+
+/**
+ * Checkpointer::work()
+ *
+ * Private helper function run by the writer thread, writing each snapshot as it arrives.
+ */
+void Checkpointer::work() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _wake.wait(lock, [this] { return _has_pending || _stopping; });
+        if (!_has_pending) return;
+
+        // Take the snapshot, leaving the old buffer for the next one to be copied into
+        std::swap(_pending, _writing);
+        const std::uint64_t generation = _pending_generation;
+        _has_pending = false;
+        _busy = true;
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+            write(_writing, generation);
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        if (error) _error = error;
+        _busy = false;
+        _idle.notify_all();
+    }
+}
+
+/**
+ * Checkpointer::write(grid, generation)
+ *
+ * Private helper function to write a checkpoint, then point the manifest at it.
+ *
+ * @throws
+ *      std::runtime_error if a file cannot be written or renamed.
+ */
+void Checkpointer::write(const Grid &grid, std::uint64_t generation) {
+    const std::string file = _prefix + "-" + std::to_string(generation) + ".cgol";
+    const std::string manifest = _prefix + ".manifest";
+
+    Zoo::save_compressed(file + ".tmp", grid);
+    if (std::rename((file + ".tmp").c_str(), file.c_str()) != 0) {
+        throw std::runtime_error("Checkpoint cannot be renamed into place");
+    }
+
+    {
+        std::ofstream output(manifest + ".tmp");
+        output << "generation " << generation << "\n"
+               << "file " << file << "\n";
+        output.close();
+        if (!output) {
+            throw std::runtime_error("Checkpoint manifest cannot be written");
+        }
+    }
+    if (std::rename((manifest + ".tmp").c_str(), manifest.c_str()) != 0) {
+        throw std::runtime_error("Checkpoint manifest cannot be renamed into place");
+    }
+
+    if (!_last_file.empty() && _last_file != file) std::remove(_last_file.c_str());
+    _last_file = file;
+}
+
+/**
+ * Checkpointer::load_latest(prefix, grid, generation)
+ *
+ * Load the latest checkpoint written with a prefix, to resume a simulation from.
+ *
+ * @example
+ *
+ *      // Carry on from where the last run got to, counting generations on from the checkpoint
+ *      Grid grid;
+ *      std::uint64_t generation = 0;
+ *      if (Checkpointer::load_latest("runs/soup", grid, generation)) world.reset(grid, generation);
+ *
+ * @param prefix
+ *      The path every file of the checkpoint starts with.
+ *
+ * @param grid
+ *      Set to the checkpointed grid.
+ *
+ * @param generation
+ *      Set to the generation the grid is a snapshot of.
+ *
+ * @return
+ *      False if there is no checkpoint with the prefix, in which case grid and generation are untouched.
+ *
+ * @throws
+ *      std::runtime_error if the manifest is malformed or its grid file cannot be loaded.
+ */
+bool Checkpointer::load_latest(const std::string &prefix, Grid &grid, std::uint64_t &generation) {
+    std::uint64_t latest = 0;
+    std::string file;
+    if (!read_manifest(prefix, latest, file)) return false;
+
+    grid = Zoo::load_compressed(file);
+    generation = latest;
+    return true;
+}
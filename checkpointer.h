@@ -0,0 +1,59 @@
+/**
+ * Declares a class for saving checkpoints of a long running simulation on a background thread.
+ * Rich documentation for the api and behaviour the Checkpointer class can be found in checkpointer.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * Declare the structure of the Checkpointer class for writing snapshots of a grid without stalling the simulation.
+ *
+ * Snapshots are copied into a pending buffer, and a writer thread swaps it with the buffer it writes from.
+ *      - Both buffers are reused, so a snapshot of a world that has not changed size never allocates.
+ *      - Only the latest snapshot is kept waiting, a newer one replaces it if the writer is still busy.
+ */
+class Checkpointer {
+private:
+    std::string _prefix;
+    Grid _pending, _writing;
+    std::uint64_t _pending_generation;
+    bool _has_pending, _busy, _stopping;
+    std::exception_ptr _error;
+    std::string _last_file;
+
+    std::mutex _mutex;
+    std::condition_variable _wake, _idle;
+    std::thread _writer;
+
+    void work();
+
+    void write(const Grid &grid, std::uint64_t generation);
+
+public:
+    explicit Checkpointer(std::string prefix);
+
+    Checkpointer(const Checkpointer &other) = delete;
+
+    Checkpointer &operator=(const Checkpointer &other) = delete;
+
+    ~Checkpointer();
+
+    void submit(const Grid &grid, std::uint64_t generation);
+
+    void wait();
+
+    static bool load_latest(const std::string &prefix, Grid &grid, std::uint64_t &generation);
+};
@@ -0,0 +1,873 @@
+/**
+ * Implements a class representing a 2d grid world split into blocks across the ranks of an MPI communicator.
+ *      - Boards too large for the memory of one machine are split between many, each stepping its own block.
+ *
+ *      - The ranks are arranged in a grid of columns x rows picked by MPI_Dims_create.
+ *          - Column boundaries fall on whole packed words, so each block steps with the same kernel as a World.
+ *          - Each block is stored with a margin of one word of columns either side and halo_depth rows above
+ *            and below, which hold copies of the cells of the eight blocks around it.
+ *
+ *      - The halos are exchanged with non-blocking messages to all eight neighbours at once.
+ *          - The inside of the block, which needs no halo, is stepped while the messages are in flight,
+ *            then the rim of the block once they have arrived.
+ *          - A halo k cells deep lets the block take k generations per exchange. The cells computed shrink
+ *            by one at each edge every generation, leaving exactly the block after k, in the same way
+ *            as the temporal blocking of a World. Fewer, larger messages for some recomputed cells.
+ *          - On a torus the ranks on opposite edges are neighbours, including a rank with itself.
+ *            Otherwise the halos past the edges of the world are kept dead.
+ *
+ *      - Boards can be loaded and saved as .bgol binary files with MPI-IO, each rank reading or writing
+ *        only the bits of its own block.
+ *          - Blocks do not start on whole bytes of the stream, so the bytes shared by two blocks are
+ *            gathered on the first rank and combined before being written.
+ *
+ * Every rank must call the same functions in the same order, as most of them communicate.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "distributed_world.h"
+#include "kernel.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * The columns of margin either side of a block, one whole word so that the block starts on a word.
+ */
+static const int MARGIN = Grid::WORD_BITS;
+
+/**
+ * The direction to each of the eight neighbouring blocks. The opposite of direction d is 7 - d.
+ */
+static const int DX[] = {-1, 0, 1, -1, 1, -1, 0, 1};
+static const int DY[] = {-1, -1, -1, 0, 0, 1, 1, 1};
+
+/**
+ * The most bytes handed to one MPI-IO call, whose counts are ints.
+ */
+static const std::uint64_t MAX_IO_BYTES = 1ULL << 30;
+
+/**
+ * get_bits(row, x, count)
+ *
+ * Private helper function to read count (1 to 64) cells of a packed row starting at cell x, in the low bits.
+ */
+static Grid::Word get_bits(const Grid::Word *row, int x, int count) {
+    const int word = x / Grid::WORD_BITS, bit = x % Grid::WORD_BITS;
+
+    Grid::Word value = row[word] >> bit;
+    if (bit != 0 && bit + count > Grid::WORD_BITS) value |= row[word + 1] << (Grid::WORD_BITS - bit);
+    return count == Grid::WORD_BITS ? value : value & ((Grid::Word(1) << count) - 1);
+}
+
+/**
+ * put_bits(row, x, count, value)
+ *
+ * Private helper function to write the low count (1 to 64) bits of value to the cells of a packed row from cell x.
+ */
+static void put_bits(Grid::Word *row, int x, int count, Grid::Word value) {
+    const int word = x / Grid::WORD_BITS, bit = x % Grid::WORD_BITS;
+    const Grid::Word mask = count == Grid::WORD_BITS ? ~Grid::Word(0) : (Grid::Word(1) << count) - 1;
+    value &= mask;
+
+    row[word] = (row[word] & ~(mask << bit)) | (value << bit);
+    if (bit != 0 && bit + count > Grid::WORD_BITS) {
+        const int shift = Grid::WORD_BITS - bit;
+        row[word + 1] = (row[word + 1] & ~(mask >> shift)) | (value >> shift);
+    }
+}
+
+/**
+ * pack(cells, x, y, columns, rows, words)
+ *
+ * Private helper function to copy a rectangle of cells into a message, 64 cells of a row to a word.
+ */
+static void pack(const Grid &cells, int x, int y, int columns, int rows, std::vector<Grid::Word> &words) {
+    words.clear();
+    for (int row = y; row < y + rows; row++) {
+        for (int column = 0; column < columns; column += Grid::WORD_BITS) {
+            words.push_back(get_bits(cells.row_words(row), x + column, std::min(Grid::WORD_BITS, columns - column)));
+        }
+    }
+}
+
+/**
+ * unpack(words, cells, x, y, columns, rows)
+ *
+ * Private helper function to copy a message made by pack back into a rectangle of cells.
+ */
+static void unpack(const std::vector<Grid::Word> &words, Grid &cells, int x, int y, int columns, int rows) {
+    std::size_t index = 0;
+    for (int row = y; row < y + rows; row++) {
+        for (int column = 0; column < columns; column += Grid::WORD_BITS) {
+            put_bits(cells.row_words(row), x + column, std::min(Grid::WORD_BITS, columns - column), words[index++]);
+        }
+    }
+}
+
+/**
+ * stream_bits(bytes, bit, count, value), stream_value(bytes, bit, count)
+ *
+ * Private helper functions to OR count (1 to 64) cells into, or read them out of, a .bgol bit stream
+ * starting at a bit, where cell i of the stream is bit (i % 8) of byte i / 8.
+ */
+static void stream_bits(std::vector<unsigned char> &bytes, std::uint64_t bit, int count, Grid::Word value) {
+    const std::size_t index = std::size_t(bit / 8);
+    const int shift = int(bit % 8);
+
+    for (int k = 0; k * 8 < count + shift; k++) {
+        bytes[index + std::size_t(k)] |= (unsigned char) ((k == 0 ? value << shift : value >> (8 * k - shift)) & 0xFF);
+    }
+}
+
+static Grid::Word stream_value(const std::vector<unsigned char> &bytes, std::uint64_t bit, int count) {
+    const std::size_t index = std::size_t(bit / 8);
+    const int shift = int(bit % 8);
+
+    Grid::Word value = 0;
+    for (int k = 0; k * 8 < count + shift; k++) {
+        const Grid::Word byte = bytes[index + std::size_t(k)];
+        value |= k == 0 ? byte >> shift : byte << (8 * k - shift);
+    }
+    return count == Grid::WORD_BITS ? value : value & ((Grid::Word(1) << count) - 1);
+}
+
+/**
+ * transfer(file, offset, bytes, count, write)
+ *
+ * Private helper function to read or write count bytes of a file at an offset, in pieces MPI-IO can count.
+ *
+ * @return
+ *      True if every piece was transferred.
+ */
+static bool transfer(MPI_File file, MPI_Offset offset, unsigned char *bytes, std::uint64_t count, bool write) {
+    for (std::uint64_t done = 0; done < count;) {
+        const int piece = int(std::min(MAX_IO_BYTES, count - done));
+        MPI_Status status;
+        const int result = write ? MPI_File_write_at(file, offset + MPI_Offset(done), bytes + done, piece, MPI_BYTE, &status)
+                                 : MPI_File_read_at(file, offset + MPI_Offset(done), bytes + done, piece, MPI_BYTE, &status);
+        int transferred = 0;
+        MPI_Get_count(&status, MPI_BYTE, &transferred);
+        if (result != MPI_SUCCESS || transferred != piece) return false;
+        done += std::uint64_t(piece);
+    }
+    return true;
+}
+
+/**
+ * all_succeeded(comm, succeeded)
+ *
+ * Private helper function to agree across every rank whether they all succeeded, so they fail together.
+ */
+static bool all_succeeded(MPI_Comm comm, bool succeeded) {
+    int failed = succeeded ? 0 : 1;
+    MPI_Allreduce(MPI_IN_PLACE, &failed, 1, MPI_INT, MPI_MAX, comm);
+    return failed == 0;
+}
+
+/**
+ * DistributedWorld::DistributedWorld(comm, width, height)
+ *
+ * Construct a dead world of width x height cells split across the ranks of a communicator.
+ * The communicator is duplicated, so the messages of the world never mix with any others.
+ *
+ * @example
+ *
+ *      // Split a huge world across every rank, and give each a random block
+ *      DistributedWorld world(MPI_COMM_WORLD, 1 << 20, 1 << 20);
+ *      int x0, y0, x1, y1;
+ *      world.get_block(x0, y0, x1, y1);
+ *      world.set_block_state(random_soup(x1 - x0, y1 - y0, world.get_rank()));
+ *
+ * @param comm
+ *      The communicator of the ranks to split the world across. Every rank must construct the world together.
+ *
+ * @param width
+ *      The width of the whole world.
+ *
+ * @param height
+ *      The height of the whole world.
+ *
+ * @throws
+ *      std::runtime_error if the world is too small to give every rank at least one word of one row.
+ */
+DistributedWorld::DistributedWorld(MPI_Comm comm, int width, int height)
+        : _width(width), _height(height), _halo_depth(1), _current(0), _generation(0) {
+    MPI_Comm_size(comm, &_ranks);
+
+    // Split the ranks into a grid, with more of them along the longer side if it has the words for them
+    int dims[2] = {0, 0};
+    MPI_Dims_create(_ranks, 2, dims);
+    const int words = (std::max(width, 0) + Grid::WORD_BITS - 1) / Grid::WORD_BITS;
+    _columns = width >= height ? dims[0] : dims[1];
+    _rows = _ranks / _columns;
+    if (words < _columns) std::swap(_columns, _rows);
+
+    // Narrow or short worlds that fit neither way round fall back to a single column or row of ranks
+    if (words < _columns || height < _rows) {
+        _columns = height >= _ranks ? 1 : _ranks;
+        _rows = _ranks / _columns;
+    }
+    if (words < _columns || height < _rows) {
+        throw std::runtime_error("The world is too small to split across " + std::to_string(_ranks) + " ranks");
+    }
+
+    MPI_Comm_dup(comm, &_comm);
+    MPI_Comm_rank(_comm, &_rank);
+    _column = _rank % _columns;
+    _row = _rank / _columns;
+
+    int x1 = 0, y1 = 0;
+    block_bounds(_column, _row, _x0, _y0, x1, y1);
+    _block_width = x1 - _x0;
+    _block_height = y1 - _y0;
+
+    // The smallest block limits how deep the halos can be, as they must come from the next block along
+    int last_x0 = 0, last_y0 = 0, unused = 0;
+    block_bounds(_columns - 1, _rows - 1, last_x0, last_y0, unused, unused);
+    _min_block = std::min({Grid::WORD_BITS * (words / _columns), width - last_x0, height / _rows});
+
+    allocate_cells();
+}
+
+/**
+ * DistributedWorld::DistributedWorld(comm, grid)
+ *
+ * Construct a world split across the ranks of a communicator, with each rank taking its own block of the grid.
+ *
+ * @param comm
+ *      The communicator of the ranks to split the world across. Every rank must construct the world together.
+ *
+ * @param grid
+ *      The state of the whole world, the same on every rank.
+ *
+ * @throws
+ *      std::runtime_error if the world is too small to give every rank at least one word of one row.
+ */
+DistributedWorld::DistributedWorld(MPI_Comm comm, const Grid &grid)
+        : DistributedWorld(comm, grid.get_width(), grid.get_height()) {
+    set_block_state(grid.crop(_x0, _y0, _x0 + _block_width, _y0 + _block_height));
+}
+
+/**
+ * DistributedWorld::~DistributedWorld()
+ *
+ * Free the duplicated communicator. Every rank must destroy the world together, before MPI_Finalize.
+ */
+DistributedWorld::~DistributedWorld() {
+    MPI_Comm_free(&_comm);
+}
+
+/**
+ * DistributedWorld::block_bounds(column, row, x0, y0, x1, y1)
+ *
+ * Private helper function to find the cells [x0, x1) x [y0, y1) of the block held by a column and row of ranks.
+ * The words of each row, and the rows, are shared out as evenly as they can be.
+ */
+void DistributedWorld::block_bounds(int column, int row, int &x0, int &y0, int &x1, int &y1) const {
+    const long long words = (_width + Grid::WORD_BITS - 1) / Grid::WORD_BITS;
+    x0 = int(std::min<long long>(_width, Grid::WORD_BITS * (words * column / _columns)));
+    x1 = int(std::min<long long>(_width, Grid::WORD_BITS * (words * (column + 1) / _columns)));
+    y0 = int((long long) _height * row / _rows);
+    y1 = int((long long) _height * (row + 1) / _rows);
+}
+
+/**
+ * DistributedWorld::allocate_cells()
+ *
+ * Private helper function to size both buffers of the block for the margin and the depth of the halos.
+ */
+void DistributedWorld::allocate_cells() {
+    for (Grid &cells : _cells) {
+        cells = Grid(MARGIN + _block_width + MARGIN, _block_height + 2 * _halo_depth);
+    }
+    _current = 0;
+}
+
+/**
+ * DistributedWorld::neighbour(dx, dy, toroidal)
+ *
+ * Private helper function to find the rank holding the next block along in a direction.
+ *
+ * @return
+ *      The rank, or MPI_PROC_NULL past the edge of a world that is not toroidal.
+ */
+int DistributedWorld::neighbour(int dx, int dy, bool toroidal) const {
+    int column = _column + dx, row = _row + dy;
+    if (toroidal) {
+        column = (column + _columns) % _columns;
+        row = (row + _rows) % _rows;
+    } else if (column < 0 || column >= _columns || row < 0 || row >= _rows) {
+        return MPI_PROC_NULL;
+    }
+    return row * _columns + column;
+}
+
+/**
+ * DistributedWorld::exchange(depth, toroidal, requests)
+ *
+ * Private helper function to start sending the edges of the block, depth cells deep, to the eight blocks
+ * around it, and receiving theirs. Call finish_exchange with the same requests to wait for them.
+ */
+void DistributedWorld::exchange(int depth, bool toroidal, MPI_Request *requests) {
+    const Grid &cells = _cells[_current];
+
+    for (int d = 0; d < DIRECTIONS; d++) {
+        const int x = DX[d] > 0 ? _block_width - depth : 0, y = DY[d] > 0 ? _block_height - depth : 0;
+        const int columns = DX[d] != 0 ? depth : _block_width, rows = DY[d] != 0 ? depth : _block_height;
+        const int rank = neighbour(DX[d], DY[d], toroidal);
+
+        pack(cells, MARGIN + x, _halo_depth + y, columns, rows, _send[d]);
+        _receive[d].resize(_send[d].size());
+        MPI_Irecv(_receive[d].data(), int(_receive[d].size()), MPI_UINT64_T, rank, DIRECTIONS - 1 - d, _comm,
+                  &requests[d]);
+        MPI_Isend(_send[d].data(), int(_send[d].size()), MPI_UINT64_T, rank, d, _comm, &requests[DIRECTIONS + d]);
+    }
+}
+
+/**
+ * DistributedWorld::finish_exchange(depth, toroidal, requests)
+ *
+ * Private helper function to wait for the halos started by exchange, and copy them into the margins of the block.
+ * Halos past the edges of a world that is not toroidal are cleared in both buffers, so they stay dead.
+ */
+void DistributedWorld::finish_exchange(int depth, bool toroidal, MPI_Request *requests) {
+    MPI_Waitall(2 * DIRECTIONS, requests, MPI_STATUSES_IGNORE);
+
+    for (int d = 0; d < DIRECTIONS; d++) {
+        const int x = DX[d] > 0 ? _block_width : DX[d] < 0 ? -depth : 0;
+        const int y = DY[d] > 0 ? _block_height : DY[d] < 0 ? -depth : 0;
+        const int columns = DX[d] != 0 ? depth : _block_width, rows = DY[d] != 0 ? depth : _block_height;
+
+        if (neighbour(DX[d], DY[d], toroidal) == MPI_PROC_NULL) {
+            std::fill(_receive[d].begin(), _receive[d].end(), 0);
+            unpack(_receive[d], _cells[1 - _current], MARGIN + x, _halo_depth + y, columns, rows);
+        }
+        unpack(_receive[d], _cells[_current], MARGIN + x, _halo_depth + y, columns, rows);
+    }
+}
+
+/**
+ * DistributedWorld::step_rows(first_row, last_row, first_word, last_word, width)
+ *
+ * Private helper function to compute words [first_word, last_word) of rows [first_row, last_row) of the
+ * next buffer from the current one, treating the buffer as width cells wide.
+ */
+void DistributedWorld::step_rows(int first_row, int last_row, int first_word, int last_word, int width) {
+    if (first_row >= last_row || first_word >= last_word) return;
+
+    const Grid &current = _cells[_current];
+    Grid &next = _cells[1 - _current];
+    for (int y = first_row; y < last_row; y++) {
+        Kernel::step_words(current.row_words(y - 1), current.row_words(y), current.row_words(y + 1),
+                           next.row_words(y), first_word, last_word, width, false, _rule);
+    }
+}
+
+/**
+ * DistributedWorld::pass(depth, toroidal)
+ *
+ * Private helper function to advance the block depth generations on a single exchange of halos depth cells deep.
+ * The inside of the first generation is stepped while the halos are on their way.
+ */
+void DistributedWorld::pass(int depth, bool toroidal) {
+    MPI_Request requests[2 * DIRECTIONS];
+    exchange(depth, toroidal, requests);
+
+    // The edges of a world that is not a torus, past which nothing is ever computed
+    const bool left = !toroidal && _column == 0, right = !toroidal && _column == _columns - 1;
+    const bool top = !toroidal && _row == 0, bottom = !toroidal && _row == _rows - 1;
+    const int width = right ? MARGIN + _block_width : _cells[0].get_width();
+    const int block_words = (MARGIN + _block_width + Grid::WORD_BITS - 1) / Grid::WORD_BITS;
+
+    for (int generation = 1; generation <= depth; generation++) {
+        // The cells still to be computed reach one cell less far into the halo each generation
+        const int reach = depth - generation;
+        const int first_row = top ? _halo_depth : _halo_depth - reach;
+        const int last_row = bottom ? _halo_depth + _block_height : _halo_depth + _block_height + reach;
+        const int first_word = left || reach == 0 ? 1 : 0;
+        const int last_word = right ? block_words
+                                    : (MARGIN + _block_width + reach + Grid::WORD_BITS - 1) / Grid::WORD_BITS;
+
+        if (generation == 1) {
+            // Step the cells whose neighbours are all in the block while the halos arrive, then the rim
+            const int inner_first_row = _halo_depth + 1, inner_last_row = _halo_depth + _block_height - 1;
+            const int inner_first_word = 2, inner_last_word = block_words - 1;
+            step_rows(inner_first_row, inner_last_row, inner_first_word, inner_last_word, width);
+            finish_exchange(depth, toroidal, requests);
+
+            if (inner_first_row < inner_last_row && inner_first_word < inner_last_word) {
+                step_rows(first_row, inner_first_row, first_word, last_word, width);
+                step_rows(inner_last_row, last_row, first_word, last_word, width);
+                step_rows(inner_first_row, inner_last_row, first_word, inner_first_word, width);
+                step_rows(inner_first_row, inner_last_row, inner_last_word, last_word, width);
+            } else {
+                step_rows(first_row, last_row, first_word, last_word, width);
+            }
+        } else {
+            step_rows(first_row, last_row, first_word, last_word, width);
+        }
+        _current = 1 - _current;
+    }
+
+    _generation += std::uint64_t(depth);
+}
+
+/**
+ * DistributedWorld::load_binary(comm, path)
+ *
+ * Load a binary .bgol file into a world split across the ranks of a communicator, each rank reading
+ * only the rows, or parts of rows, of its own block.
+ *
+ * @example
+ *
+ *      // Load a huge board across every rank
+ *      std::unique_ptr<DistributedWorld> world = DistributedWorld::load_binary(MPI_COMM_WORLD, "path/to/file.bgol");
+ *
+ * @param comm
+ *      The communicator of the ranks to split the world across. Every rank must load the world together.
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @return
+ *      Returns the loaded world.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class on every rank if:
+ *          - The file cannot be opened.
+ *          - The file ends unexpectedly, before the (width * height) bits of every cell.
+ *          - The width or height is negative.
+ *          - The world is too small to split across the ranks.
+ */
+std::unique_ptr<DistributedWorld> DistributedWorld::load_binary(MPI_Comm comm, const std::string &filePath) {
+    MPI_File file;
+    if (MPI_File_open(comm, filePath.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &file) != MPI_SUCCESS) {
+        throw std::runtime_error("File cannot be opened");
+    }
+
+    // Every rank reads the same header, so they all agree on whether it is valid
+    MPI_Offset size = 0;
+    MPI_File_get_size(file, &size);
+    int header[2] = {0, 0};
+    const bool read = size >= MPI_Offset(sizeof(header)) &&
+                      transfer(file, 0, reinterpret_cast<unsigned char *>(header), sizeof(header), false);
+    const int width = header[0], height = header[1];
+    const std::uint64_t cells = std::uint64_t(std::max(width, 0)) * std::uint64_t(std::max(height, 0));
+
+    std::unique_ptr<DistributedWorld> world;
+    try {
+        if (!read || MPI_Offset(sizeof(header) + (cells + 7) / 8) > size) {
+            throw std::runtime_error("File ends wrong");
+        }
+        if (width < 0 || height < 0) {
+            throw std::runtime_error("File has an invalid size");
+        }
+        world.reset(new DistributedWorld(comm, width, height));
+    }
+    catch (...) {
+        MPI_File_close(&file);
+        throw;
+    }
+
+    // A block of whole rows is one run of the stream, otherwise each row of the block is read on its own
+    Grid &block = world->_cells[world->_current];
+    const int runs = world->_columns == 1 ? 1 : world->_block_height;
+    const int rows = world->_block_height / runs;
+    std::vector<unsigned char> bytes;
+    bool succeeded = true;
+
+    for (int run = 0; run < runs && succeeded; run++) {
+        const std::uint64_t start = std::uint64_t(world->_y0 + run * rows) * std::uint64_t(width) +
+                                    std::uint64_t(world->_x0);
+        const std::uint64_t end = start + std::uint64_t(rows - 1) * std::uint64_t(width) +
+                                  std::uint64_t(world->_block_width);
+        bytes.assign(std::size_t((end + 7) / 8 - start / 8) + 8, 0);
+        succeeded = transfer(file, MPI_Offset(sizeof(header) + start / 8), bytes.data(), (end + 7) / 8 - start / 8, false);
+
+        for (int row = 0; row < rows && succeeded; row++) {
+            const std::uint64_t bit = start % 8 + std::uint64_t(row) * std::uint64_t(width);
+            for (int x = 0; x < world->_block_width; x += Grid::WORD_BITS) {
+                const int count = std::min(Grid::WORD_BITS, world->_block_width - x);
+                put_bits(block.row_words(world->_halo_depth + run * rows + row), MARGIN + x, count,
+                         stream_value(bytes, bit + std::uint64_t(x), count));
+            }
+        }
+    }
+
+    const bool all = all_succeeded(comm, succeeded);
+    MPI_File_close(&file);
+    if (!all) {
+        throw std::runtime_error("File ends wrong");
+    }
+
+    return world;
+}
+
+/**
+ * DistributedWorld::save_binary(path)
+ *
+ * Save the whole world as a binary .bgol file, each rank writing the bits of its own block.
+ * The bytes at either end of a run of a block are shared with the blocks next to it, so they are
+ * sent to the first rank and ORed together there instead.
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class on every rank if the file cannot be opened or written.
+ */
+void DistributedWorld::save_binary(const std::string &filePath) const {
+    MPI_File file;
+    if (MPI_File_open(_comm, filePath.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file) != MPI_SUCCESS) {
+        throw std::runtime_error("Invalid save directory");
+    }
+
+    int header[2] = {_width, _height};
+    const std::uint64_t payload = (std::uint64_t(_width) * std::uint64_t(_height) + 7) / 8;
+    bool succeeded = MPI_File_set_size(file, MPI_Offset(sizeof(header) + payload)) == MPI_SUCCESS;
+    if (_rank == 0 && succeeded) {
+        succeeded = transfer(file, 0, reinterpret_cast<unsigned char *>(header), sizeof(header), true);
+    }
+
+    // Write the whole bytes of each run of the block, keeping back the shared bytes at its ends
+    const Grid &block = _cells[_current];
+    const int runs = _columns == 1 ? 1 : _block_height;
+    const int rows = _block_height / runs;
+    std::vector<unsigned char> bytes;
+    std::vector<std::uint64_t> shared;
+
+    for (int run = 0; run < runs && succeeded; run++) {
+        const std::uint64_t start = std::uint64_t(_y0 + run * rows) * std::uint64_t(_width) + std::uint64_t(_x0);
+        const std::uint64_t end = start + std::uint64_t(rows - 1) * std::uint64_t(_width) + std::uint64_t(_block_width);
+        const std::uint64_t first = start / 8, last = (end + 7) / 8;
+        bytes.assign(std::size_t(last - first) + 8, 0);
+
+        for (int row = 0; row < rows; row++) {
+            const std::uint64_t bit = start % 8 + std::uint64_t(row) * std::uint64_t(_width);
+            for (int x = 0; x < _block_width; x += Grid::WORD_BITS) {
+                const int count = std::min(Grid::WORD_BITS, _block_width - x);
+                stream_bits(bytes, bit + std::uint64_t(x), count,
+                            get_bits(block.row_words(_halo_depth + run * rows + row), MARGIN + x, count));
+            }
+        }
+
+        // Each shared byte is sent as its offset in the stream above the byte itself
+        const std::uint64_t whole_first = start % 8 != 0 ? first + 1 : first;
+        const std::uint64_t whole_last = std::max(whole_first, end % 8 != 0 ? last - 1 : last);
+        if (whole_first != first) shared.push_back(first << 8 | bytes[0]);
+        if (whole_last != last && last - 1 >= whole_first) shared.push_back((last - 1) << 8 | bytes[last - 1 - first]);
+        succeeded = transfer(file, MPI_Offset(sizeof(header) + whole_first), bytes.data() + (whole_first - first),
+                             whole_last - whole_first, true);
+    }
+
+    // Combine the shared bytes on the first rank
+    int count = int(shared.size());
+    std::vector<int> counts(std::size_t(_ranks), 0), offsets(std::size_t(_ranks), 0);
+    MPI_Gather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, _comm);
+    for (int rank = 1; rank < _ranks; rank++) offsets[rank] = offsets[rank - 1] + counts[rank - 1];
+    std::vector<std::uint64_t> all_shared(std::size_t(offsets.back() + counts.back()));
+    MPI_Gatherv(shared.data(), count, MPI_UINT64_T, all_shared.data(), counts.data(), offsets.data(), MPI_UINT64_T,
+                0, _comm);
+
+    if (_rank == 0) {
+        std::sort(all_shared.begin(), all_shared.end());
+        for (std::size_t i = 0; i < all_shared.size() && succeeded;) {
+            const std::uint64_t offset = all_shared[i] >> 8;
+            unsigned char byte = 0;
+            for (; i < all_shared.size() && all_shared[i] >> 8 == offset; i++) byte |= (unsigned char) (all_shared[i] & 0xFF);
+            succeeded = transfer(file, MPI_Offset(sizeof(header) + offset), &byte, 1, true);
+        }
+    }
+
+    const bool all = all_succeeded(_comm, succeeded);
+    MPI_File_close(&file);
+    if (!all) {
+        throw std::runtime_error("File cannot be written");
+    }
+}
+
+/**
+ * DistributedWorld::get_rank()
+ *
+ * Gets the rank of this process in the communicator of the world.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The rank.
+ */
+int DistributedWorld::get_rank() const {
+    return _rank;
+}
+
+/**
+ * DistributedWorld::get_ranks()
+ *
+ * Gets the number of ranks the world is split across.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of ranks.
+ */
+int DistributedWorld::get_ranks() const {
+    return _ranks;
+}
+
+/**
+ * DistributedWorld::get_width()
+ *
+ * Gets the width of the whole world.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The width of the world.
+ */
+int DistributedWorld::get_width() const {
+    return _width;
+}
+
+/**
+ * DistributedWorld::get_height()
+ *
+ * Gets the height of the whole world.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The height of the world.
+ */
+int DistributedWorld::get_height() const {
+    return _height;
+}
+
+/**
+ * DistributedWorld::get_block(x0, y0, x1, y1)
+ *
+ * Gets the cells [x0, x1) x [y0, y1) of the world held by this rank.
+ * The function should be callable from a constant context.
+ */
+void DistributedWorld::get_block(int &x0, int &y0, int &x1, int &y1) const {
+    x0 = _x0;
+    y0 = _y0;
+    x1 = _x0 + _block_width;
+    y1 = _y0 + _block_height;
+}
+
+/**
+ * DistributedWorld::get_block_state()
+ *
+ * Gets a copy of the cells of the block held by this rank, without its halos.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A grid the size of the block.
+ */
+Grid DistributedWorld::get_block_state() const {
+    Grid block(_block_width, _block_height);
+    for (int y = 0; y < _block_height; y++) {
+        const Grid::Word *row = _cells[_current].row_words(_halo_depth + y);
+        for (int x = 0; x < _block_width; x += Grid::WORD_BITS) {
+            block.row_words(y)[x / Grid::WORD_BITS] = get_bits(row, MARGIN + x, std::min(Grid::WORD_BITS, _block_width - x));
+        }
+    }
+    return block;
+}
+
+/**
+ * DistributedWorld::set_block_state(block)
+ *
+ * Replace the cells of the block held by this rank. Only this rank is changed, so it does not communicate.
+ *
+ * @param block
+ *      A grid the size of the block.
+ *
+ * @throws
+ *      std::runtime_error if the grid is not the size of the block.
+ */
+void DistributedWorld::set_block_state(const Grid &block) {
+    if (block.get_width() != _block_width || block.get_height() != _block_height) {
+        throw std::runtime_error("The state of a block must be the size of the block");
+    }
+
+    for (int y = 0; y < _block_height; y++) {
+        Grid::Word *row = _cells[_current].row_words(_halo_depth + y);
+        for (int x = 0; x < _block_width; x += Grid::WORD_BITS) {
+            put_bits(row, MARGIN + x, std::min(Grid::WORD_BITS, _block_width - x), block.row_words(y)[x / Grid::WORD_BITS]);
+        }
+    }
+}
+
+/**
+ * DistributedWorld::gather(root)
+ *
+ * Collect the blocks of every rank into one grid of the whole world on the root rank.
+ *
+ * @param root
+ *      Optional parameter. The rank to collect the world on. Defaults to 0.
+ *
+ * @return
+ *      The whole world on the root rank, and an empty grid on every other rank.
+ */
+Grid DistributedWorld::gather(int root) const {
+    const Grid mine = get_block_state();
+    const int words = mine.get_words_per_row() * _block_height;
+
+    if (_rank != root) {
+        MPI_Send(mine.row_words(0), words, MPI_UINT64_T, root, 0, _comm);
+        return Grid();
+    }
+
+    Grid world(_width, _height);
+    for (int rank = 0; rank < _ranks; rank++) {
+        int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+        block_bounds(rank % _columns, rank / _columns, x0, y0, x1, y1);
+        if (rank == root) {
+            world.merge(mine, x0, y0);
+            continue;
+        }
+
+        Grid block(x1 - x0, y1 - y0);
+        MPI_Recv(block.row_words(0), block.get_words_per_row() * block.get_height(), MPI_UINT64_T, rank, 0, _comm,
+                 MPI_STATUS_IGNORE);
+        world.merge(block, x0, y0);
+    }
+    return world;
+}
+
+/**
+ * DistributedWorld::get_alive_cells()
+ *
+ * Gets the number of alive cells in the whole world, summed across every rank.
+ *
+ * @return
+ *      The number of alive cells, on every rank.
+ */
+std::uint64_t DistributedWorld::get_alive_cells() const {
+    std::uint64_t alive = 0;
+    for (int y = 0; y < _block_height; y++) {
+        const Grid::Word *row = _cells[_current].row_words(_halo_depth + y);
+        for (int x = 0; x < _block_width; x += Grid::WORD_BITS) {
+            alive += std::uint64_t(__builtin_popcountll(get_bits(row, MARGIN + x, std::min(Grid::WORD_BITS, _block_width - x))));
+        }
+    }
+
+    MPI_Allreduce(MPI_IN_PLACE, &alive, 1, MPI_UINT64_T, MPI_SUM, _comm);
+    return alive;
+}
+
+/**
+ * DistributedWorld::get_generation()
+ *
+ * Gets the number of generations the world has been stepped.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The generation.
+ */
+std::uint64_t DistributedWorld::get_generation() const {
+    return _generation;
+}
+
+/**
+ * DistributedWorld::get_rule()
+ *
+ * Gets the rule the world is stepped by.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The rule, Conway's Game of Life unless it has been changed.
+ */
+const Rule &DistributedWorld::get_rule() const {
+    return _rule;
+}
+
+/**
+ * DistributedWorld::set_rule(rule)
+ *
+ * Sets the rule the world is stepped by, which must be the same on every rank.
+ *
+ * @param rule
+ *      The rule to step by.
+ */
+void DistributedWorld::set_rule(const Rule &rule) {
+    _rule = rule;
+}
+
+/**
+ * DistributedWorld::get_halo_depth()
+ *
+ * Gets the depth of the halos exchanged, which is the most generations taken per exchange.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The depth of the halos in cells.
+ */
+int DistributedWorld::get_halo_depth() const {
+    return _halo_depth;
+}
+
+/**
+ * DistributedWorld::set_halo_depth(depth)
+ *
+ * Sets the depth of the halos exchanged, so that advancing takes up to depth generations per exchange.
+ * Deeper halos send fewer messages, but recompute more cells around the edges of each block.
+ *
+ * @example
+ *
+ *      // Exchange halos every 8 generations instead of every generation
+ *      world.set_halo_depth(8);
+ *      world.advance(1000, true);
+ *
+ * @param depth
+ *      The depth of the halos in cells, which must be the same on every rank.
+ *
+ * @throws
+ *      std::runtime_error if depth is less than 1, more than 64, or more than the width or height of the
+ *      smallest block, as halos must come from the neighbouring blocks alone.
+ */
+void DistributedWorld::set_halo_depth(int depth) {
+    if (depth < 1 || depth > MARGIN || depth > _min_block) {
+        throw std::runtime_error("Halos must be between 1 and " + std::to_string(std::min(MARGIN, _min_block)) +
+                                 " cells deep");
+    }
+
+    const Grid block = get_block_state();
+    _halo_depth = depth;
+    allocate_cells();
+    set_block_state(block);
+}
+
+/**
+ * DistributedWorld::step(toroidal)
+ *
+ * Take one step by the rule of the world, exchanging halos one cell deep.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then the step will consider the world as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom. Defaults to false.
+ */
+void DistributedWorld::step(bool toroidal) {
+    pass(1, toroidal);
+}
+
+/**
+ * DistributedWorld::advance(steps, toroidal)
+ *
+ * Advance multiple steps, taking up to get_halo_depth() generations per exchange of halos.
+ *
+ * @param steps
+ *      The number of steps to advance the world forward.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then the step will consider the world as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom. Defaults to false.
+ */
+void DistributedWorld::advance(int steps, bool toroidal) {
+    for (int remaining = steps; remaining > 0;) {
+        const int depth = std::min(remaining, _halo_depth);
+        pass(depth, toroidal);
+        remaining -= depth;
+    }
+}
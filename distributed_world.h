@@ -0,0 +1,102 @@
+/**
+ * Declares a class representing a 2d grid world split into blocks across the ranks of an MPI communicator.
+ * Rich documentation for the api and behaviour the DistributedWorld class can be found in distributed_world.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+
+#include <mpi.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Declare the structure of the DistributedWorld class for simulating worlds too large for one machine.
+ *
+ * The ranks of the communicator are arranged in a 2d grid, and each holds one block of the world.
+ *      - A block is stored with a margin of halo cells around it, copied from the blocks around it.
+ *      - Every rank must call the same functions in the same order, as most of them communicate.
+ */
+class DistributedWorld {
+private:
+    static const int DIRECTIONS = 8;
+
+    MPI_Comm _comm;
+    int _rank, _ranks, _columns, _rows, _column, _row;
+    int _width, _height, _x0, _y0, _block_width, _block_height, _min_block;
+    int _halo_depth, _current;
+    Grid _cells[2];
+    std::vector<Grid::Word> _send[DIRECTIONS], _receive[DIRECTIONS];
+    Rule _rule;
+    std::uint64_t _generation;
+
+    void block_bounds(int column, int row, int &x0, int &y0, int &x1, int &y1) const;
+
+    void allocate_cells();
+
+    int neighbour(int dx, int dy, bool toroidal) const;
+
+    void exchange(int depth, bool toroidal, MPI_Request *requests);
+
+    void finish_exchange(int depth, bool toroidal, MPI_Request *requests);
+
+    void step_rows(int first_row, int last_row, int first_word, int last_word, int width);
+
+    void pass(int depth, bool toroidal);
+
+public:
+    DistributedWorld(MPI_Comm comm, int width, int height);
+
+    DistributedWorld(MPI_Comm comm, const Grid &grid);
+
+    DistributedWorld(const DistributedWorld &) = delete;
+
+    DistributedWorld &operator=(const DistributedWorld &) = delete;
+
+    ~DistributedWorld();
+
+    static std::unique_ptr<DistributedWorld> load_binary(MPI_Comm comm, const std::string &filePath);
+
+    void save_binary(const std::string &filePath) const;
+
+    int get_rank() const;
+
+    int get_ranks() const;
+
+    int get_width() const;
+
+    int get_height() const;
+
+    void get_block(int &x0, int &y0, int &x1, int &y1) const;
+
+    Grid get_block_state() const;
+
+    void set_block_state(const Grid &block);
+
+    Grid gather(int root = 0) const;
+
+    std::uint64_t get_alive_cells() const;
+
+    std::uint64_t get_generation() const;
+
+    const Rule &get_rule() const;
+
+    void set_rule(const Rule &rule);
+
+    int get_halo_depth() const;
+
+    void set_halo_depth(int depth);
+
+    void step(bool toroidal = false);
+
+    void advance(int steps, bool toroidal = false);
+};
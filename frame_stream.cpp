@@ -0,0 +1,640 @@
+/**
+ * Implements classes for streaming every frame of a running simulation as binary, and reading the stream back.
+ *      - Visualisers and video encoders read frames far faster than the console can print them, so each frame
+ *        is written as packed words rather than text, by a writer thread so stepping never waits on the pipe.
+ *
+ *      - A stream is written to any std::ostream, a file or a named pipe, and starts with a 16 byte header:
+ *          - the magic bytes "GOLF", the version 1, then the width and height of every frame, all little endian.
+ *
+ *      - Each frame follows as a 20 byte record header and a payload:
+ *          - the generation (8 bytes), the kind of frame (1 byte), 1 if the payload is zstd compressed (1 byte),
+ *            2 bytes of padding, the size of the payload as stored (4 bytes) and once decompressed (4 bytes).
+ *          - A key frame (kind 0) holds every packed word of the frame, row by row, as little endian words
+ *            laid out like a Grid, see Grid::row_words(y).
+ *          - A delta frame (kind 1) holds the words that changed since the frame before, as alternating
+ *            varint counts of unchanged words and of changed words, each count of changed words followed by
+ *            those words xor'd with the frame before.
+ *
+ *      - Deltas are written in Encoding::Delta, with a key frame first, every key interval frames after it,
+ *        and whenever a delta would not be smaller than the key frame, so a reader can join at any key frame.
+ *
+ *      - Payloads are compressed with zstd if asked for, which needs a build configured with -DGOL_WITH_ZSTD=ON.
+ *
+ *      - Errors on the writer thread are kept and thrown from the next call to submit or wait.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "frame_stream.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef GOL_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+using Word = Grid::Word;
+
+/**
+ * The magic bytes that start a frame stream, and the version of the format that follows them.
+ */
+static const char STREAM_MAGIC[4] = {'G', 'O', 'L', 'F'};
+static const std::uint32_t STREAM_VERSION = 1;
+
+/**
+ * The sizes of the stream header and of the header of each frame, and the kinds of frame.
+ */
+static const std::size_t STREAM_HEADER_BYTES = 16, FRAME_HEADER_BYTES = 20;
+static const unsigned char KEY_FRAME = 0, DELTA_FRAME = 1;
+
+/**
+ * The zstd level frames are compressed at, the fastest, as frames must keep up with the simulation.
+ */
+static const int COMPRESSION_LEVEL = 1;
+
+/**
+ * put(bytes, value, count)
+ *
+ * Private helper function to write the lowest count bytes of a value as little endian.
+ */
+static void put(char *bytes, std::uint64_t value, int count) {
+    for (int i = 0; i < count; i++) {
+        bytes[i] = char((value >> (8 * i)) & 0xFF);
+    }
+}
+
+/**
+ * get(bytes, count)
+ *
+ * Private helper function to read count bytes as a little endian value.
+ */
+static std::uint64_t get(const char *bytes, int count) {
+    std::uint64_t value = 0;
+    for (int i = 0; i < count; i++) {
+        value |= std::uint64_t(static_cast<unsigned char>(bytes[i])) << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * store_word(bytes, word)
+ *
+ * Private helper function to write a packed word to a payload as little endian, returning the end of it.
+ */
+static char *store_word(char *bytes, Word word) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    std::memcpy(bytes, &word, sizeof(word));
+    return bytes + sizeof(word);
+}
+
+/**
+ * read_word(bytes)
+ *
+ * Private helper function to read 8 bytes of a payload as a little endian word.
+ */
+static Word read_word(const char *bytes) {
+    Word word;
+    std::memcpy(&word, bytes, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+/**
+ * The most bytes an LEB128 varint of 64 bits takes.
+ */
+static const std::size_t MAX_VARINT_BYTES = 10;
+
+/**
+ * store_varint(bytes, value)
+ *
+ * Private helper function to write an LEB128 varint to a payload, returning the end of it.
+ */
+static char *store_varint(char *bytes, std::uint64_t value) {
+    do {
+        *bytes++ = char((value & 0x7F) | (value > 0x7F ? 0x80 : 0));
+        value >>= 7;
+    } while (value != 0);
+    return bytes;
+}
+
+/**
+ * read_varint(bytes, size, index)
+ *
+ * Private helper function to read an LEB128 varint from a payload, advancing index past it.
+ *
+ * @throws
+ *      std::runtime_error if the payload ends in the middle of the varint, or it does not fit in 64 bits.
+ */
+static std::uint64_t read_varint(const char *bytes, std::size_t size, std::size_t &index) {
+    std::uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (index >= size) {
+            throw std::runtime_error("Frame stream has a broken delta");
+        }
+
+        const unsigned char byte = static_cast<unsigned char>(bytes[index++]);
+        value |= std::uint64_t(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return value;
+    }
+    throw std::runtime_error("Frame stream has a broken delta");
+}
+
+/**
+ * The zstd context reused for every frame a writer compresses, or nothing in builds without zstd.
+ */
+struct FrameWriter::Compressor {
+#ifdef GOL_HAVE_ZSTD
+    ZSTD_CCtx *context = ZSTD_createCCtx();
+
+    ~Compressor() {
+        ZSTD_freeCCtx(context);
+    }
+#endif
+};
+
+/**
+ * The zstd context reused for every frame a reader decompresses, or nothing in builds without zstd.
+ */
+struct FrameReader::Decompressor {
+#ifdef GOL_HAVE_ZSTD
+    ZSTD_DCtx *context = ZSTD_createDCtx();
+
+    ~Decompressor() {
+        ZSTD_freeDCtx(context);
+    }
+#endif
+};
+
+/**
+ * FrameWriter::FrameWriter(out, width, height, encoding, compress, key_interval, queue)
+ *
+ * Construct a writer, write the header of the stream and start the writer thread.
+ *
+ * @example
+ *
+ *      // Stream every generation of a world to a visualiser reading from a named pipe
+ *      std::ofstream pipe("/tmp/frames", std::ios::binary);
+ *      FrameWriter frames(pipe, world.get_width(), world.get_height());
+ *      for (int step = 1; step <= steps; step++) {
+ *          world.step();
+ *          frames.submit(world.get_state(), world.get_generation());
+ *      }
+ *      frames.wait();
+ *
+ * @param out
+ *      The stream to write to, which must outlive the writer.
+ *
+ * @param width
+ *      The width of every frame.
+ *
+ * @param height
+ *      The height of every frame.
+ *
+ * @param encoding
+ *      Optional parameter. Whether to write every frame whole, or the changes since the frame before.
+ *      Defaults to Encoding::Delta.
+ *
+ * @param compress
+ *      Optional parameter. If true then every payload is compressed with zstd. Defaults to false.
+ *
+ * @param key_interval
+ *      Optional parameter. The most frames between key frames of a delta stream, 0 for only the first.
+ *      Defaults to 256.
+ *
+ * @param queue
+ *      Optional parameter. The most frames held waiting for the writer before submit blocks. Defaults to 16.
+ *
+ * @throws
+ *      std::runtime_error if a size or count is negative, the queue is empty, compression was asked for
+ *      in a build without zstd, or the header cannot be written.
+ */
+FrameWriter::FrameWriter(std::ostream &out, int width, int height, Encoding encoding, bool compress, int key_interval,
+                         int queue)
+        : _out(out), _width(width), _height(height), _key_interval(key_interval), _encoding(encoding), _first(0),
+          _queued(0), _busy(false), _stopping(false), _since_key(0), _frames(0), _bytes(0) {
+    if (width < 0 || height < 0 || key_interval < 0 || queue < 1) {
+        throw std::runtime_error("Frame stream needs a size and key interval of at least 0 and a queue of 1");
+    }
+    if (compress && !is_compression_available()) {
+        throw std::runtime_error("Frame compression is not built in, configure with GOL_WITH_ZSTD");
+    }
+    if (compress) _compressor.reset(new Compressor());
+
+    _queue.assign(static_cast<std::size_t>(queue), Grid(width, height));
+    _generations.assign(static_cast<std::size_t>(queue), 0);
+
+    char header[STREAM_HEADER_BYTES];
+    std::memcpy(header, STREAM_MAGIC, sizeof(STREAM_MAGIC));
+    put(header + 4, STREAM_VERSION, 4);
+    put(header + 8, std::uint32_t(width), 4);
+    put(header + 12, std::uint32_t(height), 4);
+    if (!_out.write(header, sizeof(header))) {
+        throw std::runtime_error("Frame stream cannot be written");
+    }
+    _bytes = sizeof(header);
+
+    _writer = std::thread(&FrameWriter::work, this);
+}
+
+/**
+ * FrameWriter::~FrameWriter()
+ *
+ * Write every queued frame, then stop the writer thread. Errors are dropped, call wait first to see them.
+ */
+FrameWriter::~FrameWriter() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wake.notify_one();
+    _writer.join();
+}
+
+/**
+ * FrameWriter::is_compression_available()
+ *
+ * Gets whether frames can be compressed, which needs a build configured with GOL_WITH_ZSTD.
+ *
+ * @return
+ *      True if zstd is built in.
+ */
+bool FrameWriter::is_compression_available() {
+#ifdef GOL_HAVE_ZSTD
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * FrameWriter::submit(grid, generation)
+ *
+ * Hand a frame to the writer thread, returning as soon as it has been copied into the queue.
+ * Blocks only while the queue is full, waiting for the writer to finish the oldest frame.
+ *
+ * @param grid
+ *      The frame to write, which must be the size of the stream.
+ *
+ * @param generation
+ *      The generation the frame shows.
+ *
+ * @throws
+ *      std::runtime_error if the grid is the wrong size.
+ *      Rethrows the exception from the last failed write, if there was one since it was last thrown.
+ */
+void FrameWriter::submit(const Grid &grid, std::uint64_t generation) {
+    if (grid.get_width() != _width || grid.get_height() != _height) {
+        throw std::runtime_error("Frames must all be the size of the stream");
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _space.wait(lock, [this] { return _queued < _queue.size() || _error; });
+    if (_error) std::rethrow_exception(std::exchange(_error, nullptr));
+
+    // The writer never touches a slot past the queued frames, so the copy needs no lock
+    const std::size_t slot = (_first + _queued) % _queue.size();
+    lock.unlock();
+    _queue[slot] = grid;
+    _generations[slot] = generation;
+    lock.lock();
+
+    _queued++;
+    lock.unlock();
+    _wake.notify_one();
+}
+
+/**
+ * FrameWriter::wait()
+ *
+ * Block until every submitted frame has been written and the stream flushed.
+ *
+ * @throws
+ *      Rethrows the exception from the last failed write, if there was one since it was last thrown.
+ */
+void FrameWriter::wait() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idle.wait(lock, [this] { return _queued == 0 && !_busy; });
+
+    if (_error) std::rethrow_exception(std::exchange(_error, nullptr));
+}
+
+/**
+ * FrameWriter::get_frames_written()
+ *
+ * Gets the number of frames written so far.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of frames.
+ */
+std::uint64_t FrameWriter::get_frames_written() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _frames;
+}
+
+/**
+ * FrameWriter::get_bytes_written()
+ *
+ * Gets the number of bytes written so far, headers included.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of bytes.
+ */
+std::uint64_t FrameWriter::get_bytes_written() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _bytes;
+}
+
+/**
+ * FrameWriter::work()
+ *
+ * Private helper function run by the writer thread, writing the queued frames in order.
+ * The stream is flushed whenever the writer catches up, so a reader sees each frame without waiting for more.
+ */
+void FrameWriter::work() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _wake.wait(lock, [this] { return _queued > 0 || _stopping; });
+        if (_queued == 0) return;
+
+        const std::size_t slot = _first;
+        const bool last = _queued == 1;
+        _busy = true;
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+            write(_queue[slot], _generations[slot], last);
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        _first = (_first + 1) % _queue.size();
+        _queued--;
+        if (error) {
+            // Frames after a failed one could not be decoded, so they are dropped
+            _error = error;
+            _queued = 0;
+        }
+        _busy = false;
+        _space.notify_all();
+        _idle.notify_all();
+    }
+}
+
+/**
+ * FrameWriter::write(frame, generation, flush)
+ *
+ * Private helper function to encode one frame, as a delta if that is smaller, and write it out.
+ *
+ * @throws
+ *      std::runtime_error if the frame cannot be compressed or written.
+ */
+void FrameWriter::write(const Grid &frame, std::uint64_t generation, bool flush) {
+    const std::size_t words = std::size_t(frame.get_words_per_row()) * std::size_t(_height);
+    const Word *current = words > 0 ? frame.row_words(0) : nullptr;
+
+    const std::size_t key_bytes = words * sizeof(Word);
+    if (_payload.size() < key_bytes) _payload.resize(key_bytes);
+    char *const payload = _payload.data();
+    std::size_t payload_bytes = 0;
+
+    bool key = _encoding == Encoding::Bitplanes || _frames == 0 || (_key_interval > 0 && _since_key >= _key_interval);
+    if (!key) {
+        // Alternate runs of unchanged words with runs of changed words, giving up once it is no smaller
+        const Word *previous = _previous.row_words(0);
+        char *out = payload;
+        for (std::size_t word = 0; word < words;) {
+            const std::size_t same_start = word;
+            while (word < words && current[word] == previous[word]) word++;
+            const std::size_t changed_start = word;
+            while (word < words && current[word] != previous[word]) word++;
+
+            if (std::size_t(out - payload) + 2 * MAX_VARINT_BYTES + (word - changed_start) * sizeof(Word) >= key_bytes) {
+                key = true;
+                break;
+            }
+            out = store_varint(out, changed_start - same_start);
+            out = store_varint(out, word - changed_start);
+            for (std::size_t changed = changed_start; changed < word; changed++) {
+                out = store_word(out, current[changed] ^ previous[changed]);
+            }
+        }
+        payload_bytes = std::size_t(out - payload);
+    }
+    if (key) {
+        for (std::size_t word = 0; word < words; word++) store_word(payload + word * sizeof(Word), current[word]);
+        payload_bytes = key_bytes;
+        _since_key = 0;
+    }
+    _since_key++;
+    if (_encoding == Encoding::Delta) _previous = frame;
+
+    // Compress the payload if asked, into a buffer kept between frames
+    const char *stored = payload;
+    std::size_t stored_bytes = payload_bytes;
+#ifdef GOL_HAVE_ZSTD
+    if (_compressor) {
+        _stored.resize(ZSTD_compressBound(payload_bytes));
+        const std::size_t result = ZSTD_compressCCtx(_compressor->context, _stored.data(), _stored.size(), payload,
+                                                     payload_bytes, COMPRESSION_LEVEL);
+        if (ZSTD_isError(result)) {
+            throw std::runtime_error(std::string("Frame cannot be compressed: ") + ZSTD_getErrorName(result));
+        }
+        stored = _stored.data();
+        stored_bytes = result;
+    }
+#endif
+    if (payload_bytes > UINT32_MAX || stored_bytes > UINT32_MAX) {
+        throw std::runtime_error("Frame is too large for the stream");
+    }
+
+    char header[FRAME_HEADER_BYTES] = {};
+    put(header, generation, 8);
+    header[8] = char(key ? KEY_FRAME : DELTA_FRAME);
+    header[9] = char(_compressor ? 1 : 0);
+    put(header + 12, stored_bytes, 4);
+    put(header + 16, payload_bytes, 4);
+
+    _out.write(header, sizeof(header));
+    _out.write(stored, std::streamsize(stored_bytes));
+    if (flush) _out.flush();
+    if (!_out) {
+        throw std::runtime_error("Frame stream cannot be written");
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _frames++;
+    _bytes += sizeof(header) + stored_bytes;
+}
+
+/**
+ * FrameReader::FrameReader(in)
+ *
+ * Construct a reader and read the header of the stream.
+ *
+ * @example
+ *
+ *      // Count the alive cells of every frame of a stream
+ *      std::ifstream file("path/to/run.golf", std::ios::binary);
+ *      FrameReader frames(file);
+ *      Grid frame;
+ *      std::uint64_t generation;
+ *      while (frames.next(frame, generation)) std::cout << generation << " " << frame.get_alive_cells() << "\n";
+ *
+ * @param in
+ *      The stream to read from, which must outlive the reader.
+ *
+ * @throws
+ *      std::runtime_error if the stream does not start with the header of a known version.
+ */
+FrameReader::FrameReader(std::istream &in) : _in(in), _width(0), _height(0), _has_key(false) {
+    char header[STREAM_HEADER_BYTES];
+    if (!_in.read(header, sizeof(header)) || std::memcmp(header, STREAM_MAGIC, sizeof(STREAM_MAGIC)) != 0) {
+        throw std::runtime_error("Stream is not a frame stream");
+    }
+    if (get(header + 4, 4) != STREAM_VERSION) {
+        throw std::runtime_error("Frame stream has an unknown version");
+    }
+
+    _width = int(std::int32_t(get(header + 8, 4)));
+    _height = int(std::int32_t(get(header + 12, 4)));
+    if (_width < 0 || _height < 0) {
+        throw std::runtime_error("Frame stream has an invalid size");
+    }
+    _current = Grid(_width, _height);
+}
+
+FrameReader::~FrameReader() = default;
+
+/**
+ * FrameReader::get_width()
+ *
+ * Gets the width of every frame of the stream.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The width of a frame.
+ */
+int FrameReader::get_width() const {
+    return _width;
+}
+
+/**
+ * FrameReader::get_height()
+ *
+ * Gets the height of every frame of the stream.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The height of a frame.
+ */
+int FrameReader::get_height() const {
+    return _height;
+}
+
+/**
+ * FrameReader::next(grid, generation)
+ *
+ * Read the next frame of the stream, applying it to the frame before if it is a delta.
+ *
+ * @param grid
+ *      Set to the frame, reusing its storage if it is already the size of the stream.
+ *
+ * @param generation
+ *      Set to the generation the frame shows.
+ *
+ * @return
+ *      False if the stream ended cleanly before the frame, in which case grid and generation are untouched.
+ *
+ * @throws
+ *      std::runtime_error if:
+ *          - The stream ends in the middle of a frame.
+ *          - The frame is of an unknown kind, or its payload is the wrong size or broken.
+ *          - The stream starts with a delta, which has no frame before it to apply to.
+ *          - The frame is compressed and this build has no zstd.
+ */
+bool FrameReader::next(Grid &grid, std::uint64_t &generation) {
+    char header[FRAME_HEADER_BYTES];
+    _in.read(header, sizeof(header));
+    if (_in.gcount() == 0 && _in.eof()) return false;
+    if (std::size_t(_in.gcount()) != sizeof(header)) {
+        throw std::runtime_error("Frame stream ends wrong");
+    }
+
+    const unsigned char kind = static_cast<unsigned char>(header[8]), compressed = static_cast<unsigned char>(header[9]);
+    const std::size_t stored_bytes = get(header + 12, 4), payload_bytes = get(header + 16, 4);
+    const std::size_t words = std::size_t(_current.get_words_per_row()) * std::size_t(_height);
+    if (kind > DELTA_FRAME || compressed > 1 || (!compressed && stored_bytes != payload_bytes) ||
+        (kind == KEY_FRAME ? payload_bytes != words * sizeof(Word) : payload_bytes > words * sizeof(Word))) {
+        throw std::runtime_error("Frame stream has a broken frame");
+    }
+    if (kind == DELTA_FRAME && !_has_key) {
+        throw std::runtime_error("Frame stream starts with a delta");
+    }
+
+    _stored.resize(stored_bytes);
+    if (stored_bytes > 0 && !_in.read(_stored.data(), std::streamsize(stored_bytes))) {
+        throw std::runtime_error("Frame stream ends wrong");
+    }
+
+    const char *payload = _stored.data();
+    if (compressed) {
+#ifdef GOL_HAVE_ZSTD
+        if (!_decompressor) _decompressor.reset(new Decompressor());
+        _payload.resize(payload_bytes);
+        const std::size_t result = ZSTD_decompressDCtx(_decompressor->context, _payload.data(), _payload.size(),
+                                                       _stored.data(), _stored.size());
+        if (ZSTD_isError(result) || result != payload_bytes) {
+            throw std::runtime_error("Frame stream has a broken frame");
+        }
+        payload = _payload.data();
+#else
+        throw std::runtime_error("Frame compression is not built in, configure with GOL_WITH_ZSTD");
+#endif
+    }
+
+    Word *cells = words > 0 ? _current.row_words(0) : nullptr;
+    if (kind == KEY_FRAME) {
+        for (std::size_t word = 0; word < words; word++) cells[word] = read_word(payload + word * sizeof(Word));
+        _has_key = true;
+    } else {
+        for (std::size_t index = 0, word = 0; index < payload_bytes;) {
+            word += read_varint(payload, payload_bytes, index);
+            const std::uint64_t changed = read_varint(payload, payload_bytes, index);
+            if (word > words || changed > words - word || changed > (payload_bytes - index) / sizeof(Word)) {
+                throw std::runtime_error("Frame stream has a broken delta");
+            }
+
+            for (std::uint64_t i = 0; i < changed; i++, word++, index += sizeof(Word)) {
+                cells[word] ^= read_word(payload + index);
+            }
+        }
+    }
+
+    // Keep the padding past the end of each row dead, whatever the stream held there
+    const int words_per_row = _current.get_words_per_row();
+    if (_width % Grid::WORD_BITS != 0) {
+        const Word mask = (Word(1) << (_width % Grid::WORD_BITS)) - 1;
+        for (int y = 0; y < _height; y++) {
+            _current.row_words(y)[words_per_row - 1] &= mask;
+        }
+    }
+
+    grid = _current;
+    generation = get(header, 8);
+    return true;
+}
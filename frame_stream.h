@@ -0,0 +1,114 @@
+/**
+ * Declares classes for streaming every frame of a running simulation as binary, and reading the stream back.
+ * Rich documentation for the api, behaviour and stream format can be found in frame_stream.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+/**
+ * Declare the structure of the FrameWriter class for streaming frames of a grid without stalling the simulation.
+ *
+ * Frames are copied into a ring of queued buffers, and a writer thread encodes and writes them in order.
+ *      - Every frame is kept, submit only blocks once the writer has fallen a whole queue of frames behind.
+ *      - The buffers are reused, so streaming a world of a fixed size never allocates.
+ *      - Frames are submitted from one thread at a time.
+ */
+class FrameWriter {
+public:
+    enum class Encoding {
+        Bitplanes, Delta
+    };
+
+private:
+    struct Compressor;
+
+    std::ostream &_out;
+    int _width, _height, _key_interval;
+    Encoding _encoding;
+    std::unique_ptr<Compressor> _compressor;
+
+    std::vector<Grid> _queue;
+    std::vector<std::uint64_t> _generations;
+    std::size_t _first, _queued;
+    bool _busy, _stopping;
+    std::exception_ptr _error;
+
+    Grid _previous;
+    std::vector<char> _payload, _stored;
+    int _since_key;
+    std::uint64_t _frames, _bytes;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _wake, _space, _idle;
+    std::thread _writer;
+
+    void work();
+
+    void write(const Grid &frame, std::uint64_t generation, bool flush);
+
+public:
+    FrameWriter(std::ostream &out, int width, int height, Encoding encoding = Encoding::Delta, bool compress = false,
+                int key_interval = 256, int queue = 16);
+
+    FrameWriter(const FrameWriter &other) = delete;
+
+    FrameWriter &operator=(const FrameWriter &other) = delete;
+
+    ~FrameWriter();
+
+    void submit(const Grid &grid, std::uint64_t generation);
+
+    void wait();
+
+    std::uint64_t get_frames_written() const;
+
+    std::uint64_t get_bytes_written() const;
+
+    static bool is_compression_available();
+};
+
+/**
+ * Declare the structure of the FrameReader class for reading a frame stream back a frame at a time.
+ */
+class FrameReader {
+private:
+    struct Decompressor;
+
+    std::istream &_in;
+    int _width, _height;
+    std::unique_ptr<Decompressor> _decompressor;
+    Grid _current;
+    bool _has_key;
+    std::vector<char> _stored, _payload;
+
+public:
+    explicit FrameReader(std::istream &in);
+
+    FrameReader(const FrameReader &other) = delete;
+
+    FrameReader &operator=(const FrameReader &other) = delete;
+
+    ~FrameReader();
+
+    int get_width() const;
+
+    int get_height() const;
+
+    bool next(Grid &grid, std::uint64_t &generation);
+};
@@ -0,0 +1,50 @@
+/**
+ * Implements the GpuEngine class for builds without CUDA, which have no GPU to step a world on.
+ * Configure with -DGOL_WITH_CUDA=ON to build gpu_engine.cu in its place.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "gpu_engine.h"
+
+#ifndef GOL_HAVE_CUDA
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <stdexcept>
+
+struct GpuEngine::Buffers {};
+
+/**
+ * GpuEngine::GpuEngine(grid, rule)
+ *
+ * @throws
+ *      std::runtime_error always, as this build has no GPU engine.
+ */
+GpuEngine::GpuEngine(const Grid &grid, const Rule &rule)
+        : _width(grid.get_width()), _height(grid.get_height()), _words(grid.get_words_per_row()), _rule(rule) {
+    throw std::runtime_error("The GPU engine is not built in, configure with GOL_WITH_CUDA");
+}
+
+GpuEngine::GpuEngine(const GpuEngine &other)
+        : _width(other._width), _height(other._height), _words(other._words), _rule(other._rule) {}
+
+GpuEngine::~GpuEngine() = default;
+
+/**
+ * GpuEngine::is_available()
+ *
+ * @return
+ *      False, as this build has no GPU engine.
+ */
+bool GpuEngine::is_available() {
+    return false;
+}
+
+const Rule &GpuEngine::get_rule() const {
+    return _rule;
+}
+
+void GpuEngine::advance(std::uint64_t, bool) {}
+
+void GpuEngine::download(Grid &, int) const {}
+#endif
@@ -0,0 +1,288 @@
+/**
+ * Implements a class holding a world in the memory of a GPU and stepping it there, on CUDA.
+ *      - Dense random soups on huge boards keep every core of a CPU busy, a GPU steps them far faster.
+ *
+ *      - The cells are kept in two device buffers laid out like a Grid, a row of packed words at a time.
+ *          - Each step is one kernel launch with a thread per packed word, reading the nine words around it
+ *            and writing the next state of its 64 cells, then the buffers swap.
+ *          - Stepping never copies cells between the host and the device. They are only copied back by
+ *            download, which a World calls when its state is read, for only the rows of a window if asked.
+ *
+ *      - Words are stepped by the same bit-sliced count as the CPU kernel, see kernel_impl.h.
+ *          - The eight neighbours are summed into four bit planes, ones, twos, fours and eights, so the
+ *            count of each of the 64 cells is spread across the planes.
+ *          - Any Life-like rule is applied by reading its birth and survival masks for each count.
+ *
+ *      - Updating can be performed on a torus or inside a dead border, exactly as for a World.
+ *
+ * Built only when configured with -DGOL_WITH_CUDA=ON, see gpu_engine.cpp for the build without it.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "gpu_engine.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <cuda_runtime.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using Word = Grid::Word;
+
+/**
+ * The shape of a block of threads, in packed words by rows.
+ */
+static const int BLOCK_WORDS = 32;
+static const int BLOCK_ROWS = 8;
+
+/**
+ * check(result)
+ *
+ * Private helper function to turn a failed CUDA call into an exception.
+ *
+ * @throws
+ *      std::runtime_error if the result is not cudaSuccess.
+ */
+static void check(cudaError_t result) {
+    if (result != cudaSuccess) {
+        throw std::runtime_error(std::string("The GPU engine failed: ") + cudaGetErrorString(result));
+    }
+}
+
+/**
+ * add(value, ones, twos, fours, eights)
+ *
+ * Private helper function to add one neighbour to the bit planes of the count of every cell of a word.
+ */
+__device__ __forceinline__ void add(Word value, Word &ones, Word &twos, Word &fours, Word &eights) {
+    const Word carry_ones = ones & value;
+    ones ^= value;
+    const Word carry_twos = twos & carry_ones;
+    twos ^= carry_ones;
+    const Word carry_fours = fours & carry_twos;
+    fours ^= carry_twos;
+    eights |= carry_fours;
+}
+
+/**
+ * neighbours(line, word, words, last_bit, toroidal, west, east)
+ *
+ * Private helper function to find the western and eastern neighbours of every cell of a word of a row.
+ * Neighbours past the ends of the row come from the opposite end if toroidal, otherwise they are dead.
+ */
+__device__ __forceinline__ void neighbours(const Word *line, int word, int words, int last_bit, bool toroidal,
+                                           Word &west, Word &east) {
+    const Word value = line[word];
+
+    Word west_carry = word > 0 ? line[word - 1] >> 63 : toroidal ? (line[words - 1] >> last_bit) & 1 : 0;
+    Word east_carry = word + 1 < words ? line[word + 1] << 63 : 0;
+    if (word == words - 1 && toroidal) east_carry |= (line[0] & 1) << last_bit;
+
+    west = (value << 1) | west_carry;
+    east = (value >> 1) | east_carry;
+}
+
+/**
+ * step_kernel(current, next, width, height, words, toroidal, birth, survival)
+ *
+ * Compute the next state of one packed word of the world per thread.
+ */
+__global__ void step_kernel(const Word *current, Word *next, int width, int height, int words, bool toroidal,
+                            unsigned birth, unsigned survival) {
+    const int word = blockIdx.x * blockDim.x + threadIdx.x, y = blockIdx.y * blockDim.y + threadIdx.y;
+    if (word >= words || y >= height) return;
+
+    const int last_bit = (width - 1) % 64;
+    const Word *row = current + std::size_t(y) * words;
+    const Word *above = y > 0 ? row - words : toroidal ? current + std::size_t(height - 1) * words : nullptr;
+    const Word *below = y < height - 1 ? row + words : toroidal ? current : nullptr;
+
+    Word ones = 0, twos = 0, fours = 0, eights = 0, west = 0, east = 0;
+    const Word *lines[] = {above, below};
+    for (const Word *line : lines) {
+        if (line == nullptr) continue;
+        neighbours(line, word, words, last_bit, toroidal, west, east);
+        add(west, ones, twos, fours, eights);
+        add(line[word], ones, twos, fours, eights);
+        add(east, ones, twos, fours, eights);
+    }
+    neighbours(row, word, words, last_bit, toroidal, west, east);
+    add(west, ones, twos, fours, eights);
+    add(east, ones, twos, fours, eights);
+
+    // Pick out the cells with each count the rule gives birth to or lets survive
+    const Word alive = row[word];
+    Word result = 0;
+    for (int count = 0; count <= 8; count++) {
+        const unsigned born = (birth >> count) & 1, survives = (survival >> count) & 1;
+        if (!born && !survives) continue;
+
+        const Word equal = (count & 1 ? ones : ~ones) & (count & 2 ? twos : ~twos) &
+                           (count & 4 ? fours : ~fours) & (count & 8 ? eights : ~eights);
+        result |= equal & ((born ? ~alive : 0) | (survives ? alive : 0));
+    }
+
+    // The last word shifts live cells into its padding, which must stay clear
+    if (word == words - 1 && last_bit != 63) result &= (Word(1) << (last_bit + 1)) - 1;
+
+    next[std::size_t(y) * words + word] = result;
+}
+
+/**
+ * The two device buffers of cells, the current state and the next.
+ */
+struct GpuEngine::Buffers {
+    Word *current = nullptr, *next = nullptr;
+    std::size_t bytes = 0;
+
+    explicit Buffers(std::size_t bytes) : bytes(bytes) {
+        if (bytes == 0) return;
+        check(cudaMalloc(&current, bytes));
+        if (cudaMalloc(&next, bytes) != cudaSuccess) {
+            cudaFree(current);
+            throw std::runtime_error("The GPU engine could not allocate device memory");
+        }
+    }
+
+    ~Buffers() {
+        cudaFree(current);
+        cudaFree(next);
+    }
+};
+
+/**
+ * GpuEngine::GpuEngine(grid, rule)
+ *
+ * Construct an engine holding a copy of the cells of a grid in device memory.
+ *
+ * @example
+ *
+ *      // Step a huge soup on the GPU, copying it back once at the end
+ *      GpuEngine engine(soup);
+ *      engine.advance(10000, true);
+ *      engine.download(soup);
+ *
+ * @param grid
+ *      The cells to start from.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step the cells by. Defaults to Conway's Game of Life.
+ *
+ * @throws
+ *      std::runtime_error if there is no GPU, or it has not enough memory for two copies of the grid.
+ */
+GpuEngine::GpuEngine(const Grid &grid, const Rule &rule)
+        : _width(grid.get_width()), _height(grid.get_height()), _words(grid.get_words_per_row()), _rule(rule) {
+    if (!is_available()) {
+        throw std::runtime_error("The GPU engine has no GPU to run on");
+    }
+
+    _buffers.reset(new Buffers(std::size_t(_height) * std::size_t(_words) * sizeof(Word)));
+    if (_buffers->bytes > 0) {
+        check(cudaMemcpy(_buffers->current, grid.row_words(0), _buffers->bytes, cudaMemcpyHostToDevice));
+    }
+}
+
+/**
+ * GpuEngine::GpuEngine(other)
+ *
+ * Construct an engine holding its own copy of the cells of another, copied within device memory.
+ */
+GpuEngine::GpuEngine(const GpuEngine &other)
+        : _width(other._width), _height(other._height), _words(other._words), _rule(other._rule) {
+    _buffers.reset(new Buffers(other._buffers->bytes));
+    if (_buffers->bytes > 0) {
+        check(cudaMemcpy(_buffers->current, other._buffers->current, _buffers->bytes, cudaMemcpyDeviceToDevice));
+    }
+}
+
+/**
+ * GpuEngine::~GpuEngine()
+ *
+ * Free the device buffers.
+ */
+GpuEngine::~GpuEngine() = default;
+
+/**
+ * GpuEngine::is_available()
+ *
+ * Gets whether there is a CUDA device to step worlds on.
+ *
+ * @return
+ *      True if at least one device can be used.
+ */
+bool GpuEngine::is_available() {
+    int devices = 0;
+    return cudaGetDeviceCount(&devices) == cudaSuccess && devices > 0;
+}
+
+/**
+ * GpuEngine::get_rule()
+ *
+ * Gets the rule the engine steps its cells by.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The rule.
+ */
+const Rule &GpuEngine::get_rule() const {
+    return _rule;
+}
+
+/**
+ * GpuEngine::advance(steps, toroidal)
+ *
+ * Advance the cells in device memory, without copying anything back to the host.
+ *
+ * @param steps
+ *      The number of steps to advance the cells forward.
+ *
+ * @param toroidal
+ *      If true then the step will consider the grid as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom.
+ *
+ * @throws
+ *      std::runtime_error if a step fails to launch or run.
+ */
+void GpuEngine::advance(std::uint64_t steps, bool toroidal) {
+    if (_buffers->bytes == 0) return;
+
+    const dim3 threads(BLOCK_WORDS, BLOCK_ROWS);
+    const dim3 blocks((_words + BLOCK_WORDS - 1) / BLOCK_WORDS, (_height + BLOCK_ROWS - 1) / BLOCK_ROWS);
+    for (std::uint64_t step = 0; step < steps; step++) {
+        step_kernel<<<blocks, threads>>>(_buffers->current, _buffers->next, _width, _height, _words, toroidal,
+                                         _rule.get_birth(), _rule.get_survival());
+        std::swap(_buffers->current, _buffers->next);
+    }
+    check(cudaGetLastError());
+}
+
+/**
+ * GpuEngine::download(grid, first_row)
+ *
+ * Copy the current cells back from device memory, waiting for any steps still running.
+ * A grid shorter than the world takes only the rows from first_row down, so a window costs only its rows.
+ *
+ * @param grid
+ *      The grid to copy the cells into, which must be as wide as the grid the engine was made from.
+ *
+ * @param first_row
+ *      Optional parameter. The row of the world to copy into the top row of the grid. Defaults to 0.
+ *
+ * @throws
+ *      std::runtime_error if the grid is the wrong width or runs past the bottom of the world, or a step failed.
+ */
+void GpuEngine::download(Grid &grid, int first_row) const {
+    if (grid.get_width() != _width || first_row < 0 || grid.get_height() > _height - first_row) {
+        throw std::runtime_error("The GPU engine can only download rows of its own width within the world");
+    }
+
+    const std::size_t row_bytes = std::size_t(_words) * sizeof(Word);
+    if (row_bytes > 0 && grid.get_height() > 0) {
+        check(cudaMemcpy(grid.row_words(0), _buffers->current + std::size_t(first_row) * std::size_t(_words),
+                         std::size_t(grid.get_height()) * row_bytes, cudaMemcpyDeviceToHost));
+    }
+}
@@ -0,0 +1,48 @@
+/**
+ * Declares a class holding a world in the memory of a GPU and stepping it there.
+ * Rich documentation for the api and behaviour the GpuEngine class can be found in gpu_engine.cu.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+
+#include <cstdint>
+#include <memory>
+
+/**
+ * Declare the structure of the GpuEngine class for stepping dense worlds on a GPU.
+ *
+ * The cells stay in device memory between calls to advance, and are only copied back by download.
+ * Builds without GOL_WITH_CUDA have no GPU, so constructing an engine throws, see gpu_engine.cpp.
+ */
+class GpuEngine {
+private:
+    struct Buffers;
+
+    std::unique_ptr<Buffers> _buffers;
+    int _width, _height, _words;
+    Rule _rule;
+
+public:
+    GpuEngine(const Grid &grid, const Rule &rule = Rule());
+
+    GpuEngine(const GpuEngine &other);
+
+    GpuEngine &operator=(const GpuEngine &) = delete;
+
+    ~GpuEngine();
+
+    static bool is_available();
+
+    const Rule &get_rule() const;
+
+    void advance(std::uint64_t steps, bool toroidal);
+
+    void download(Grid &grid, int first_row = 0) const;
+};
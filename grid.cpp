@@ -3,10 +3,14 @@
  *      - New cells are initialized to Cell::DEAD.
  *      - Grids can be resized while retaining their contents in the remaining area.
  *      - Grids can be rotated, cropped, and merged together.
+ *      - Rectangles of cells can be filled or copied between grids, and rows read, a word at a time.
  *      - Grids can return counts of the alive and dead cells.
  *      - Grids can be serialized directly to an ascii std::ostream.
  *
- * You are encouraged to use STL container types as an underlying storage mechanism for the grid cells.
+ * Cells are stored bit-packed in a std::vector of 64 bit words, one bit per cell, with each row padded
+ * out to a whole number of words. Bulk operations work a word at a time rather than cell by cell.
+ * Grid::get_unchecked and Grid::set_unchecked skip the bounds check, for loops that have checked already.
+ * Grids of 2 MiB or more are allocated aligned to huge pages, so stepping through them needs far fewer TLB entries.
  *
  * @author 962940
  * @date March, 2020
@@ -15,6 +19,181 @@
 
 // Include the minimal number of headers needed to support your implementation.
 // #include ...
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * count_bits(word)
+ *
+ * Private helper function to count the number of set bits in a word.
+ *
+ * @param word
+ *      The word to count.
+ *
+ * @return
+ *      The number of 1 bits in the word.
+ */
+static int count_bits(Grid::Word word) {
+    return __builtin_popcountll(word);
+}
+
+/**
+ * low_bits(count)
+ *
+ * Private helper function to build a mask of the lowest count bits of a word.
+ *
+ * @param count
+ *      The number of bits to set, between 0 and 64.
+ *
+ * @return
+ *      A word with the lowest count bits set.
+ */
+static Grid::Word low_bits(int count) {
+    return count >= Grid::WORD_BITS ? ~Grid::Word(0) : (Grid::Word(1) << count) - 1;
+}
+
+/**
+ * load_bits(row, words, bit)
+ *
+ * Private helper function to read the 64 bits of a packed row starting at an arbitrary bit offset.
+ * Bits past the end of the row are read as zero.
+ *
+ * @param row
+ *      The first word of the row.
+ *
+ * @param words
+ *      The number of words in the row.
+ *
+ * @param bit
+ *      The offset of the first bit to read.
+ *
+ * @return
+ *      A word where bit i is bit (bit + i) of the row.
+ */
+static Grid::Word load_bits(const Grid::Word *row, int words, int bit) {
+    int index = bit / Grid::WORD_BITS, shift = bit % Grid::WORD_BITS;
+    if (index >= words) return 0;
+
+    Grid::Word value = row[index] >> shift;
+    if (shift != 0 && index + 1 < words)
+        value |= row[index + 1] << (Grid::WORD_BITS - shift);
+
+    return value;
+}
+
+/**
+ * copy_bits(source, source_words, source_bit, target, target_bit, count)
+ *
+ * Private helper function to copy a run of bits from one packed row into another at any offsets.
+ * Only the partial target words at either end of the run are masked to keep the bits around it,
+ * every whole word between them is one shift from two source words, or a plain copy when the offsets line up.
+ *
+ * @param source
+ *      The first word of the row to read.
+ *
+ * @param source_words
+ *      The number of words in the source row.
+ *
+ * @param source_bit
+ *      The offset of the first bit to read.
+ *
+ * @param target
+ *      The first word of the row to write.
+ *
+ * @param target_bit
+ *      The offset of the first bit to write.
+ *
+ * @param count
+ *      The number of bits to copy.
+ */
+static void copy_bits(const Grid::Word *source, int source_words, int source_bit, Grid::Word *target, int target_bit,
+                      int count) {
+    // Write the masked bits of a part of a target word
+    auto copy_part = [&](int bits) {
+        const int index = target_bit / Grid::WORD_BITS, shift = target_bit % Grid::WORD_BITS;
+        const Grid::Word mask = low_bits(bits) << shift;
+        target[index] = (target[index] & ~mask) | ((load_bits(source, source_words, source_bit) << shift) & mask);
+        source_bit += bits;
+        target_bit += bits;
+        count -= bits;
+    };
+
+    if (count > 0 && target_bit % Grid::WORD_BITS != 0) {
+        copy_part(std::min(Grid::WORD_BITS - target_bit % Grid::WORD_BITS, count));
+    }
+
+    // Every bit read for a whole word lies within the run, so both source words it spans exist
+    const int whole = count / Grid::WORD_BITS, shift = source_bit % Grid::WORD_BITS;
+    const Grid::Word *from = source + source_bit / Grid::WORD_BITS;
+    Grid::Word *to = target + target_bit / Grid::WORD_BITS;
+    if (shift == 0) {
+        std::copy(from, from + whole, to);
+    } else {
+        for (int i = 0; i < whole; i++) {
+            to[i] = (from[i] >> shift) | (from[i + 1] << (Grid::WORD_BITS - shift));
+        }
+    }
+    source_bit += whole * Grid::WORD_BITS;
+    target_bit += whole * Grid::WORD_BITS;
+    count -= whole * Grid::WORD_BITS;
+
+    if (count > 0) copy_part(count);
+}
+
+/**
+ * fill_bits(row, x0, x1, value)
+ *
+ * Private helper function to set or clear bits [x0, x1) of a packed row, a word at a time.
+ */
+static void fill_bits(Grid::Word *row, int x0, int x1, bool value) {
+    while (x0 < x1) {
+        const int index = x0 / Grid::WORD_BITS, shift = x0 % Grid::WORD_BITS;
+        const int bits = std::min(Grid::WORD_BITS - shift, x1 - x0);
+        const Grid::Word mask = low_bits(bits) << shift;
+
+        row[index] = value ? row[index] | mask : row[index] & ~mask;
+        x0 += bits;
+    }
+}
+
+/**
+ * reverse_bits(word)
+ *
+ * Private helper function to mirror the bit order of a word, bit 0 becomes bit 63 and so on.
+ *
+ * @param word
+ *      The word to mirror.
+ *
+ * @return
+ *      The mirrored word.
+ */
+static Grid::Word reverse_bits(Grid::Word word) {
+    word = ((word >> 1) & 0x5555555555555555ULL) | ((word & 0x5555555555555555ULL) << 1);
+    word = ((word >> 2) & 0x3333333333333333ULL) | ((word & 0x3333333333333333ULL) << 2);
+    word = ((word >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((word & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    return __builtin_bswap64(word);
+}
+
+/**
+ * transpose_block(block)
+ *
+ * Private helper function to transpose a 64x64 matrix of bits held as 64 words, in place.
+ * Bit c of word r moves to bit r of word c. The off-diagonal halves of the matrix are swapped,
+ * then the quarters within each, and so on down to single bits, so 6 rounds of 32 swaps do the lot.
+ *
+ * @param block
+ *      The 64 words of the matrix, one per row.
+ */
+static void transpose_block(Grid::Word *block) {
+    Grid::Word mask = 0x00000000FFFFFFFFULL;
+    for (int half = 32; half != 0; half >>= 1, mask ^= mask << half) {
+        for (int row = 0; row < Grid::WORD_BITS; row = ((row | half) + 1) & ~half) {
+            const Grid::Word swapped = ((block[row] >> half) ^ block[row | half]) & mask;
+            block[row] ^= swapped << half;
+            block[row | half] ^= swapped;
+        }
+    }
+}
 
 /**
  * Grid::Grid()
@@ -74,11 +253,12 @@ Grid::Grid(int square_size) : Grid(square_size, square_size) {}
  *      The height of the grid.
  */
 Grid::Grid(int width, int height) {
-    // Create a new Vector of Cells
+    // Create a new Vector of packed words, each row rounded up to a whole word
     _width = width;
     _height = height;
+    _words_per_row = (width + WORD_BITS - 1) / WORD_BITS;
 
-    cells = std::vector<Cell>(width * height, Cell::DEAD);
+    words.assign(std::size_t(_words_per_row) * std::size_t(height), 0);
 }
 
 /**
@@ -187,11 +367,10 @@ int Grid::get_total_cells() const {
  *      The number of alive cells.
  */
 int Grid::get_alive_cells() const {
-    // Loop over and count all alive cells
+    // Count the set bits a word at a time, padding bits are always zero
     int count = 0;
-    for (int i = 0; i < _width * _height; i++) {
-        if (cells[i] == ALIVE)
-            count++;
+    for (Word word : words) {
+        count += count_bits(word);
     }
 
     return count;
@@ -221,14 +400,8 @@ int Grid::get_alive_cells() const {
  *      The number of dead cells.
  */
 int Grid::get_dead_cells() const {
-    // Loop over and count all dead cells
-    int count = 0;
-    for (int i = 0; i < _width * _height; i++) {
-        if (cells[i] == DEAD)
-            count++;
-    }
-
-    return count;
+    // Every cell that is not alive is dead
+    return get_total_cells() - get_alive_cells();
 }
 
 /**
@@ -275,26 +448,109 @@ void Grid::resize(int square_size) {
  */
 
 void Grid::resize(int new_width, int new_height) {
-    std::vector<Cell> newCells(new_width * new_height); // Create a new Cell array with the new width and height.
-    for (int x = 0; x < new_width; x++) { // Loop through the width.
-        for (int y = 0; y < new_height; y++) { // Loop through the height.
-            if (x < _width && y < _height) // If the coordinate is within the old array, copy it over to the new array.
-                newCells[x + new_width * y] = get(x, y);
-            else
-                newCells[x + new_width * y] = Cell::DEAD;
+    resize(new_width, new_height, 0, 0);
+}
+
+/**
+ * Grid::resize(width, height, x, y)
+ *
+ * Resize the current grid to a new width and height, moving its content so that its upper left corner lands
+ * at (x, y). Positive offsets grow the grid at the left and top edges, negative ones cut cells off them.
+ * Cells moved outside the new size are dropped, and new cells are Grid::DEAD.
+ *
+ * The rows are rewritten within the same storage where they can be, copying a row span at a time in order,
+ * top down when they get narrower and bottom up when they get wider or move down. Shrinking keeps the capacity,
+ * so growing back to the old size later does not allocate. Anything else is copied into a new buffer moved in.
+ *
+ * @example
+ *
+ *      // Make a grid
+ *      Grid grid(4, 4);
+ *
+ *      // Grow the grid by 2 cells at every edge, its old cell (0, 0) is now cell (2, 2)
+ *      grid.resize(8, 8, 2, 2);
+ *
+ * @param new_width
+ *      The new width for the grid.
+ *
+ * @param new_height
+ *      The new height for the grid.
+ *
+ * @param x
+ *      The x coordinate in the resized grid of the old upper left corner.
+ *
+ * @param y
+ *      The y coordinate in the resized grid of the old upper left corner.
+ */
+void Grid::resize(int new_width, int new_height, int x, int y) {
+    const int old_words = _words_per_row, new_words = (new_width + WORD_BITS - 1) / WORD_BITS;
+    const std::size_t new_size = std::size_t(new_words) * std::size_t(std::max(new_height, 0));
+
+    // The rows and columns of the old grid that land inside the new one
+    const int first = std::max(0, -y), last = std::max(first, std::min(_height, new_height - y));
+    const int left = std::max(0, -x), right = std::max(left, std::min(_width, new_width - x));
+
+    // Rows that stay where they are only need the cells past a narrower edge cleared
+    if (x == 0 && y == 0 && new_words == old_words) {
+        for (int row = 0; row < last && new_words > 0; row++) {
+            row_words(row)[new_words - 1] &= low_bits(right - (new_words - 1) * WORD_BITS);
+        }
+        words.resize(new_size);
+        _width = new_width;
+        _height = new_height;
+        return;
+    }
+
+    // Going down, each new row must end before the old rows still to be read. Going up, it must start after them.
+    bool down = true, up = true;
+    for (int row = 0; row < new_height && (down || up); row++) {
+        const std::size_t start = std::size_t(row) * std::size_t(new_words), end = start + std::size_t(new_words);
+        const int below = std::max(first, row - y + 1), above = std::min(last, row - y);
+        if (below < last && end > std::size_t(below) * std::size_t(old_words)) down = false;
+        if (above > first && start < std::size_t(above) * std::size_t(old_words)) up = false;
+    }
+
+    if (!down && !up) {
+        Grid resized(new_width, new_height); // Create a new dead grid with the new width and height.
+        // Copy the kept region over, a word at a time, leaving the rest of the new grid dead.
+        if (right > left && last > first) resized.copy_rect(*this, left, first, right, last, left + x, first + y);
+
+        // Take ownership of the new storage.
+        *this = std::move(resized);
+        return;
+    }
+
+    // An old row overlapping its own new row is taken out before the new row is cleared
+    if (new_size > words.size()) words.resize(new_size);
+    std::vector<Word> scratch;
+    for (int i = 0; i < new_height; i++) {
+        const int row = down ? i : new_height - 1 - i, source = row - y;
+        Word *target = words.data() + std::size_t(row) * std::size_t(new_words);
+        if (source < first || source >= last) {
+            std::fill(target, target + new_words, 0);
+            continue;
         }
+
+        const Word *old_row = words.data() + std::size_t(source) * std::size_t(old_words);
+        if (old_row < target + new_words && target < old_row + old_words) {
+            scratch.assign(old_row, old_row + old_words);
+            old_row = scratch.data();
+        }
+        std::fill(target, target + new_words, 0);
+        copy_bits(old_row, old_words, left, target, left + x, right - left);
     }
+    words.resize(new_size);
 
-    // Assign the new variables to the object.
-    cells = newCells;
     _width = new_width;
     _height = new_height;
+    _words_per_row = new_words;
 }
 
 /**
  * Grid::get_index(x, y)
  *
- * Private helper function to determine the 1d index of a 2d coordinate.
+ * Private helper function to determine the 1d index of the word holding a 2d coordinate.
+ * The cell is bit (x % Grid::WORD_BITS) of that word.
  * Should not be visible from outside the Grid class.
  * The function should be callable from a constant context.
  *
@@ -305,11 +561,11 @@ void Grid::resize(int new_width, int new_height) {
  *      The y coordinate of the cell.
  *
  * @return
- *      The 1d offset from the start of the data array where the desired cell is located.
+ *      The 1d offset from the start of the word array where the desired cell is located.
  */
 
 int Grid::get_index(int x, int y) const {
-    return x + _width * y;
+    return x / WORD_BITS + _words_per_row * y;
 }
 
 /**
@@ -372,7 +628,7 @@ Cell Grid::get(int x, int y) const {
  *      std::exception or sub-class if x,y is not a valid coordinate within the grid.
  */
 void Grid::set(int x, int y, Cell value) {
-    Cell &cell = Grid::operator()(x, y);
+    CellReference cell = Grid::operator()(x, y);
     cell = value;
 }
 
@@ -380,6 +636,7 @@ void Grid::set(int x, int y, Cell value) {
  * Grid::operator()(x, y)
  *
  * Gets a modifiable reference to the value at the desired coordinate.
+ * As cells are bit-packed the reference is a Grid::CellReference handle rather than a Cell&.
  * Should be implemented by invoking Grid::get_index(x, y).
  *
  * @example
@@ -395,7 +652,7 @@ void Grid::set(int x, int y, Cell value) {
  *
  *      // Extract a reference to an individual cell to avoid calculating it's
  *      // 1d index multiple times if you need to access the cell more than once.
- *      Cell &cell_reference = grid(1, 2);
+ *      Grid::CellReference cell_reference = grid(1, 2);
  *      cell_reference = Cell::DEAD;
  *      cell_reference = Cell::ALIVE;
  *
@@ -411,18 +668,18 @@ void Grid::set(int x, int y, Cell value) {
  * @throws
  *      std::runtime_error or sub-class if x,y is not a valid coordinate within the grid.
  */
-Cell &Grid::operator()(int x, int y) {
+Grid::CellReference Grid::operator()(int x, int y) {
     if (!valid_coordinate(x, y)) {
         throw std::runtime_error("Invalid Coordinate");
     } else {
-        return cells[get_index(x, y)];
+        return CellReference(words[get_index(x, y)], Word(1) << (x % WORD_BITS));
     }
 }
 
 /**
  * Grid::operator()(x, y)
  *
- * Gets a read-only reference to the value at the desired coordinate.
+ * Gets the read-only value at the desired coordinate.
  * The operator should be callable from a constant context.
  * Should be implemented by invoking Grid::get_index(x, y).
  *
@@ -444,16 +701,297 @@ Cell &Grid::operator()(int x, int y) {
  *      The y coordinate of the cell to access.
  *
  * @return
- *      A read-only reference to the desired cell.
+ *      The value of the desired cell.
  *
  * @throws
  *      std::exception or sub-class if x,y is not a valid coordinate within the grid.
  */
-const Cell &Grid::operator()(int x, int y) const {
+Cell Grid::operator()(int x, int y) const {
     if (!valid_coordinate(x, y)) {
         throw std::runtime_error("Invalid Coordinate");
     } else {
-        return cells[get_index(x, y)];
+        return (words[get_index(x, y)] >> (x % WORD_BITS)) & 1 ? ALIVE : DEAD;
+    }
+}
+
+/**
+ * Grid::CellReference::CellReference(word, mask)
+ *
+ * Construct a handle to the single cell selected by mask within a packed word.
+ *
+ * @param word
+ *      The word holding the cell.
+ *
+ * @param mask
+ *      A word with only the bit of the cell set.
+ */
+Grid::CellReference::CellReference(Word &word, Word mask) : _word(word), _mask(mask) {}
+
+/**
+ * Grid::CellReference::operator Cell()
+ *
+ * Read the value of the referenced cell.
+ *
+ * @return
+ *      Cell::ALIVE if the bit is set, Cell::DEAD otherwise.
+ */
+Grid::CellReference::operator Cell() const {
+    return (_word & _mask) ? ALIVE : DEAD;
+}
+
+/**
+ * Grid::CellReference::operator=(value)
+ *
+ * Overwrite the value of the referenced cell.
+ *
+ * @param value
+ *      The value to be written to the cell.
+ *
+ * @return
+ *      Returns a reference to this handle to enable operator chaining.
+ */
+Grid::CellReference &Grid::CellReference::operator=(Cell value) {
+    _word = value == ALIVE ? (_word | _mask) : (_word & ~_mask);
+    return *this;
+}
+
+/**
+ * Grid::CellReference::operator=(other)
+ *
+ * Copy the value of one referenced cell into another, as assigning through a Cell& would.
+ *
+ * @param other
+ *      The handle to read the value from.
+ *
+ * @return
+ *      Returns a reference to this handle to enable operator chaining.
+ */
+Grid::CellReference &Grid::CellReference::operator=(const CellReference &other) {
+    return operator=(static_cast<Cell>(other));
+}
+
+/**
+ * Grid::get_words_per_row()
+ *
+ * Gets the number of packed words used to store each row of the grid.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The width of the grid in words, rounded up.
+ */
+int Grid::get_words_per_row() const {
+    return _words_per_row;
+}
+
+/**
+ * Grid::row_words(y)
+ *
+ * Gets direct access to the packed words of a row, for code that processes 64 cells at a time.
+ * The row is not bounds checked. Writers must keep the bits past the width of the grid zero.
+ *
+ * @example
+ *
+ *      // Make a grid
+ *      Grid grid(100, 4);
+ *
+ *      // Make cells 0 to 63 of row 2 alive in one go
+ *      grid.row_words(2)[0] = ~Grid::Word(0);
+ *
+ * @param y
+ *      The y coordinate of the row.
+ *
+ * @return
+ *      A pointer to the first of get_words_per_row() words of the row.
+ */
+Grid::Word *Grid::row_words(int y) {
+    return words.data() + _words_per_row * y;
+}
+
+/**
+ * Grid::row_words(y)
+ *
+ * Gets read-only access to the packed words of a row.
+ * The function should be callable from a constant context.
+ *
+ * @param y
+ *      The y coordinate of the row.
+ *
+ * @return
+ *      A pointer to the first of get_words_per_row() words of the row.
+ */
+const Grid::Word *Grid::row_words(int y) const {
+    return words.data() + _words_per_row * y;
+}
+
+/**
+ * Grid::row_span(y)
+ *
+ * Gets a view of the packed words of a row, checking that the row exists.
+ * Writers must keep the bits past the width of the grid zero, as for Grid::row_words(y).
+ *
+ * @example
+ *
+ *      // Make a grid
+ *      Grid grid(100, 4);
+ *
+ *      // Count the alive cells of row 2
+ *      int alive = 0;
+ *      for (Grid::Word word : grid.row_span(2)) alive += __builtin_popcountll(word);
+ *
+ * @param y
+ *      The y coordinate of the row.
+ *
+ * @return
+ *      A span of the get_words_per_row() words of the row.
+ *
+ * @throws
+ *      std::runtime_error if y is not a row of the grid.
+ */
+Grid::RowSpan Grid::row_span(int y) {
+    if (y < 0 || y >= _height) {
+        throw std::runtime_error("Invalid Row");
+    }
+
+    return RowSpan(row_words(y), _words_per_row);
+}
+
+/**
+ * Grid::row_span(y)
+ *
+ * Gets a read-only view of the packed words of a row, checking that the row exists.
+ * The function should be callable from a constant context.
+ *
+ * @param y
+ *      The y coordinate of the row.
+ *
+ * @return
+ *      A span of the get_words_per_row() words of the row.
+ *
+ * @throws
+ *      std::runtime_error if y is not a row of the grid.
+ */
+Grid::ConstRowSpan Grid::row_span(int y) const {
+    if (y < 0 || y >= _height) {
+        throw std::runtime_error("Invalid Row");
+    }
+
+    return ConstRowSpan(row_words(y), _words_per_row);
+}
+
+/**
+ * Grid::fill(value)
+ *
+ * Overwrite every cell of the grid with the same value, a word at a time.
+ *
+ * @example
+ *
+ *      // Make a grid and bring every cell to life
+ *      Grid grid(100, 4);
+ *      grid.fill(Cell::ALIVE);
+ *
+ * @param value
+ *      The value to be written to every cell.
+ */
+void Grid::fill(Cell value) {
+    fill(0, 0, _width, _height, value);
+}
+
+/**
+ * Grid::fill(x0, y0, x1, y1, value)
+ *
+ * Overwrite the cells of a rectangle spanning [x0, x1) by [y0, y1) with the same value, a word at a time.
+ *
+ * @example
+ *
+ *      // Make a grid
+ *      Grid grid(100, 100);
+ *
+ *      // Bring a 10x5 block to life with its upper left corner at (3, 7)
+ *      grid.fill(3, 7, 13, 12, Cell::ALIVE);
+ *
+ * @param x0
+ *      Left coordinate of the rectangle on x-axis.
+ *
+ * @param y0
+ *      Top coordinate of the rectangle on y-axis.
+ *
+ * @param x1
+ *      Right coordinate of the rectangle on x-axis (1 greater than the largest index).
+ *
+ * @param y1
+ *      Bottom coordinate of the rectangle on y-axis (1 greater than the largest index).
+ *
+ * @param value
+ *      The value to be written to every cell of the rectangle.
+ *
+ * @throws
+ *      std::runtime_error if the rectangle does not lie within the grid or has a negative size.
+ */
+void Grid::fill(int x0, int y0, int x1, int y1, Cell value) {
+    if (x0 < 0 || x1 > _width || y0 < 0 || y1 > _height || x1 < x0 || y1 < y0) {
+        throw std::runtime_error("The rectangle must lie within the grid");
+    }
+
+    for (int y = y0; y < y1; y++) {
+        fill_bits(row_words(y), x0, x1, value == ALIVE);
+    }
+}
+
+/**
+ * Grid::copy_rect(source, x0, y0, x1, y1, x, y)
+ *
+ * Copy the cells of a rectangle spanning [x0, x1) by [y0, y1) of a source grid into this grid,
+ * with its upper left corner at (x, y). Cells outside the rectangle are kept.
+ * Each row is copied a word at a time, shifting the words when the offsets do not line up.
+ *
+ * @example
+ *
+ *      // Make two grids
+ *      Grid x(100, 100), y(50, 50);
+ *
+ *      // Copy the 20x10 block of x at (5, 5) into y at (30, 40)
+ *      y.copy_rect(x, 5, 5, 25, 15, 30, 40);
+ *
+ * @param source
+ *      The grid to copy the cells from, which may be this grid.
+ *
+ * @param x0
+ *      Left coordinate of the rectangle in the source on x-axis.
+ *
+ * @param y0
+ *      Top coordinate of the rectangle in the source on y-axis.
+ *
+ * @param x1
+ *      Right coordinate of the rectangle in the source on x-axis (1 greater than the largest index).
+ *
+ * @param y1
+ *      Bottom coordinate of the rectangle in the source on y-axis (1 greater than the largest index).
+ *
+ * @param x
+ *      The x coordinate of where to place the upper left corner of the rectangle.
+ *
+ * @param y
+ *      The y coordinate of where to place the upper left corner of the rectangle.
+ *
+ * @throws
+ *      std::runtime_error if the rectangle does not lie within the source or does not fit within this grid.
+ */
+void Grid::copy_rect(const Grid &source, int x0, int y0, int x1, int y1, int x, int y) {
+    if (x0 < 0 || x1 > source._width || y0 < 0 || y1 > source._height || x1 < x0 || y1 < y0) {
+        throw std::runtime_error("The rectangle must lie within the source grid");
+    }
+    if (x < 0 || y < 0 || x1 - x0 > _width - x || y1 - y0 > _height - y) {
+        throw std::runtime_error("The rectangle must fit within the grid");
+    }
+
+    // Rows of a grid copied onto itself may overlap, so take them out first
+    if (&source == this) {
+        copy_rect(crop(x0, y0, x1, y1), 0, 0, x1 - x0, y1 - y0, x, y);
+        return;
+    }
+
+    for (int row = y0; row < y1; row++) {
+        copy_bits(source.row_words(row), source._words_per_row, x0, row_words(y + row - y0), x, x1 - x0);
     }
 }
 
@@ -497,14 +1035,9 @@ Grid Grid::crop(int x0, int y0, int x1, int y1) const {
         throw std::exception();
     }
 
-    // Create a new grid
+    // Create a new grid, and shift each word of the window out of the old rows into it
     Grid newGrid = Grid(x1 - x0, y1 - y0);
-    // Assign each value from the old grid
-    for (int y = y0; y < y1; y++) {
-        for (int x = x0; x < x1; x++) {
-            newGrid.set(x - x0, y - y0, get(x, y));
-        }
-    }
+    newGrid.copy_rect(*this, x0, y0, x1, y1, 0, 0);
 
     return newGrid;
 }
@@ -552,14 +1085,23 @@ void Grid::merge(const Grid& other, int x0, int y0, bool alive_only) {
         throw std::exception();
     }
 
-    // If we are only merging alive cells, check if other has any alive cells
-    if (alive_only && other.get_alive_cells() <= 0) return;
+    // Overwriting is a plain copy of the other grid into the region
+    if (!alive_only) {
+        copy_rect(other, 0, 0, other.get_width(), other.get_height(), x0, y0);
+        return;
+    }
 
     for (int y = 0, yy = y0; y < other.get_height(); y++, yy++) {
-        for (int x = 0, xx = x0; x < other.get_width(); x++, xx++) {
-            // If we're checking alive only, make sure the cell is alive, else just copy it over
-            !alive_only ? set(xx, yy, other.get(x, y)) : other.get(x, y) == ALIVE ? set(xx, yy, other.get(x, y)) : set(
-                    xx, yy, get(xx, yy));
+        const Word *source = other.row_words(y);
+        Word *target = row_words(yy);
+        for (int i = 0; i < other._words_per_row; i++) {
+            // Each source word lands across at most two target words, OR the alive cells into both
+            int bit = x0 + i * WORD_BITS, index = bit / WORD_BITS, shift = bit % WORD_BITS;
+            int count = std::min(WORD_BITS, other._width - i * WORD_BITS);
+            Word value = source[i];
+
+            target[index] |= value << shift;
+            if (shift != 0 && shift + count > WORD_BITS) target[index + 1] |= value >> (WORD_BITS - shift);
         }
     }
 }
@@ -592,46 +1134,101 @@ Grid Grid::rotate(int rotation) const {
     // Create a new grid, with the width and height changed based on the rotation wanted
     Grid newGrid = Grid(rotationTimes % 2 == 0 ? get_width() : get_height(),
                         rotationTimes % 2 == 0 ? get_height() : get_width());
-    // Loop through every index in the new grid
-    for (int y = 0; y < newGrid.get_height(); y++) {
-        for (int x = 0; x < newGrid.get_width(); x++) {
-            int newX = x;
-            int newY = y;
-            // Calculate where it should get its value from: 0 - 0 Degrees, 1 - 90, 2 - 180, 3 - 270
-            switch (rotationTimes) {
-                case 0:
-                    newX = x;
-                    newY = y;
-                    break;
-                case 1:
-                    newX = y;
-                    newY = get_height() - x - 1;
-                    break;
-                case 2:
-                    newX = get_width() - x - 1;
-                    newY = get_height() - y - 1;
-                    break;
-                case 3:
-                    newX = get_width() - y - 1;
-                    newY = x;
-                    break;
-                default:
-                    break;
+
+    // Build the new rows from the old ones: 0 - 0 Degrees, 1 - 90, 2 - 180, 3 - 270
+    switch (rotationTimes) {
+        case 0:
+            newGrid.words = words;
+            break;
+        case 2: {
+            // Each new row is an old row read backwards. Mirroring the whole padded row moves the
+            // padding to the front, so the cells are then read out from just past the padding.
+            std::vector<Word> mirrored(_words_per_row);
+            int padding = _words_per_row * WORD_BITS - _width;
+            for (int y = 0; y < _height; y++) {
+                const Word *source = row_words(_height - y - 1);
+                for (int i = 0; i < _words_per_row; i++) {
+                    mirrored[i] = reverse_bits(source[_words_per_row - i - 1]);
+                }
+                Word *target = newGrid.row_words(y);
+                for (int i = 0; i < _words_per_row; i++) {
+                    target[i] = load_bits(mirrored.data(), _words_per_row, padding + i * WORD_BITS);
+                }
             }
-            // Set the new value in the rotated grid
-            newGrid.set(x, y, get(newX, newY));
+            break;
         }
+        default:
+            if (_width > SCATTER_EDGE || _height > SCATTER_EDGE) {
+                rotate_quarter(newGrid, rotationTimes == 1);
+                break;
+            }
+
+            // A small pattern has so few cells that scattering only the alive bits of each old word is quicker
+            for (int y = 0; y < _height; y++) {
+                const Word *source = row_words(y);
+                for (int i = 0; i < _words_per_row; i++) {
+                    for (Word word = source[i]; word != 0; word &= word - 1) {
+                        int x = i * WORD_BITS + __builtin_ctzll(word);
+                        int newX = rotationTimes == 1 ? _height - y - 1 : y;
+                        int newY = rotationTimes == 1 ? x : _width - x - 1;
+                        newGrid.words[newGrid.get_index(newX, newY)] |= Word(1) << (newX % WORD_BITS);
+                    }
+                }
+            }
+            break;
     }
 
     return newGrid;
 }
 
+/**
+ * Grid::rotate_quarter(rotated, clockwise)
+ *
+ * Private helper function to fill a dead grid of the transposed size with this grid turned a quarter turn,
+ * clockwise or anticlockwise, by transposing 64x64 blocks of bits.
+ *      - Word j of a new row holds 64 old rows, so they are gathered into a block along with an old word of
+ *        each, transposed, and each old column of the block becomes word j of its new row.
+ *      - Clockwise turns gather the old rows bottom up, which mirrors the new rows. Anticlockwise turns
+ *        gather them top down and write the new rows bottom up.
+ *      - Blocks with no alive cells are skipped, as the new grid is already dead.
+ * Should not be visible from outside the Grid class.
+ * The function should be callable from a constant context.
+ *
+ * @param rotated
+ *      A dead grid as wide as this grid is tall, and as tall as this grid is wide.
+ *
+ * @param clockwise
+ *      True for a turn of 90 degrees, false for 270 degrees.
+ */
+void Grid::rotate_quarter(Grid &rotated, bool clockwise) const {
+    Word block[WORD_BITS];
+    for (int j = 0; j < rotated._words_per_row; j++) {
+        for (int i = 0; i < _words_per_row; i++) {
+            Word any = 0;
+            for (int k = 0; k < WORD_BITS; k++) {
+                const int y = clockwise ? _height - 1 - (j * WORD_BITS + k) : j * WORD_BITS + k;
+                block[k] = y >= 0 && y < _height ? row_words(y)[i] : 0;
+                any |= block[k];
+            }
+            if (any == 0) continue;
+
+            transpose_block(block);
+            const int columns = std::min(WORD_BITS, _width - i * WORD_BITS);
+            for (int r = 0; r < columns; r++) {
+                const int x = i * WORD_BITS + r;
+                rotated.row_words(clockwise ? x : _width - 1 - x)[j] = block[r];
+            }
+        }
+    }
+}
+
 /**
  * operator<<(output_stream, grid)
  *
  * Serializes a grid to an ascii output stream.
  * The grid is printed wrapped in a border of - (dash), | (pipe), and + (plus) characters.
  * Alive cells are shown as # (hash) characters, dead cells with ' ' (space) characters.
+ * The picture is built in memory and written to the stream in one go, without flushing it.
  *
  * The function should be callable on a constant Grid.
  *
@@ -662,29 +1259,24 @@ Grid Grid::rotate(int rotation) const {
  *      Returns a reference to the output stream to enable operator chaining.
  */
 std::ostream &operator<<(std::ostream &output_stream, const Grid &grid) {
-    // Loop through the grid, with an extra value on each side for the border
-    for (int y = -1; y <= grid.get_height(); y++) {
-        for (int x = -1; x <= grid.get_width(); x++) {
-            char character;
-            // If the index is at the border, check what symbol it should be
-            if (x == -1 || x == grid.get_width()) {
-                if (y == -1 || y == grid.get_height()) {
-                    character = '+';
-                } else {
-                    character = '|';
-                }
-            } else if (y == -1 || y == grid.get_height()) {
-                character = '-';
-            } else {
-                // If it's not at the border, check if dead or alive
-                character = grid.get(x, y) == ALIVE ? '#' : ' ';
-            }
-            output_stream << character;
+    const int width = grid.get_width(), height = grid.get_height();
+    const std::string border = "+" + std::string(std::size_t(width), '-') + "+\n";
+
+    // Build the whole picture in one buffer, so it reaches the stream in a single write
+    std::string picture;
+    picture.reserve(std::size_t(width + 3) * std::size_t(height + 2));
+    picture += border;
+    for (int y = 0; y < height; y++) {
+        const Grid::Word *row = grid.row_words(y);
+        picture += '|';
+        for (int x = 0; x < width; x++) {
+            picture += (row[x / Grid::WORD_BITS] >> (x % Grid::WORD_BITS)) & 1 ? '#' : ' ';
         }
-        output_stream << std::endl;
+        picture += "|\n";
     }
+    picture += border;
 
-    return output_stream;
+    return output_stream.write(picture.data(), std::streamsize(picture.size()));
 }
 
 /**
@@ -697,15 +1289,20 @@ std::ostream &operator<<(std::ostream &output_stream, const Grid &grid) {
  *      string representing the grid in ASCII
  */
 std::string Grid::to_string() const {
-    std::stringstream ss;
-    for (int y = 0; y < get_height(); y++) {
-        for (int x = 0; x < get_width(); x++) {
-            ss << (get(x, y) == ALIVE ? '#' : ' ');
+    // Size the string up front and write each row straight out of its packed words
+    std::string text(std::size_t(_width + 1) * std::size_t(_height), ' ');
+    char *line = &text[0];
+    for (int y = 0; y < _height; y++, line += _width + 1) {
+        const Word *row = row_words(y);
+        for (int i = 0; i < _words_per_row; i++) {
+            for (Word word = row[i]; word != 0; word &= word - 1) {
+                line[i * WORD_BITS + __builtin_ctzll(word)] = '#';
+            }
         }
-        ss << std::endl;
+        line[_width] = '\n';
     }
 
-    return ss.str();
+    return text;
 }
 
 /**
@@ -12,7 +12,10 @@
 
 // Add the minimal number of includes you need in order to declare the class.
 // #include ...
+#include "huge_pages.h"
+
 #include <vector>
+#include <cstdint>
 #include <cmath>
 #include <iostream>
 #include <sstream>
@@ -27,14 +30,76 @@ enum Cell : char {
 
 /**
  * Declare the structure of the Grid class for representing a 2d grid of cells.
+ *
+ * Cells are bit-packed, one bit per cell, into rows of 64 bit words.
+ *      - Row y starts at row_words(y) and is get_words_per_row() words long.
+ *      - Cell x of a row is bit (x % 64) of word (x / 64), a set bit is Cell::ALIVE.
+ *      - Bits past the width of the grid in the last word of each row are always zero.
+ *      - Large grids are backed by huge pages where the system allows it, see huge_pages.cpp.
  */
 class Grid {
+public:
+    using Word = std::uint64_t;
+
+    static constexpr int WORD_BITS = 64;
+
+    /**
+     * A modifiable handle to a single bit-packed cell, returned by Grid::operator()(x, y).
+     */
+    class CellReference {
+    private:
+        Word &_word;
+        Word _mask;
+
+    public:
+        CellReference(Word &word, Word mask);
+
+        operator Cell() const;
+
+        CellReference &operator=(Cell value);
+
+        CellReference &operator=(const CellReference &other);
+    };
+
+    /**
+     * A view of the packed words of one row, returned by Grid::row_span(y), which checks the row is in bounds.
+     * Usable in range-based for loops, and indexable by word. Indexing is not checked, as for row_words(y).
+     */
+    template <typename W>
+    class Span {
+    private:
+        W *_first;
+        int _size;
+
+    public:
+        Span(W *first, int size) : _first(first), _size(size) {}
+
+        W *begin() const { return _first; }
+
+        W *end() const { return _first + _size; }
+
+        int size() const { return _size; }
+
+        W &operator[](int index) const { return _first[index]; }
+    };
+
+    using RowSpan = Span<Word>;
+
+    using ConstRowSpan = Span<const Word>;
+
 private:
-    std::vector<Cell> cells;
-    int _width, _height;
+    std::vector<Word, HugePages::Allocator<Word>> words;
+    int _width, _height, _words_per_row;
+
+    /**
+     * Grids up to this size in both directions are turned a quarter turn cell by cell rather than by transposing.
+     */
+    static constexpr int SCATTER_EDGE = 16;
 
     int get_index(int x, int y) const;
 
+    void rotate_quarter(Grid &rotated, bool clockwise) const;
+
 public:
     Grid();
 
@@ -56,13 +121,35 @@ public:
 
     void resize(int new_width, int new_height);
 
+    void resize(int new_width, int new_height, int x, int y);
+
     Cell get(int x, int y) const;
 
     void set(int x, int y, Cell value);
 
-    Cell &operator()(int x, int y);
+    CellReference operator()(int x, int y);
+
+    Cell operator()(int x, int y) const;
+
+    int get_words_per_row() const;
+
+    Word *row_words(int y);
+
+    const Word *row_words(int y) const;
+
+    RowSpan row_span(int y);
+
+    ConstRowSpan row_span(int y) const;
+
+    Cell get_unchecked(int x, int y) const;
+
+    void set_unchecked(int x, int y, Cell value);
+
+    void fill(Cell value);
 
-    const Cell &operator()(int x, int y) const;
+    void fill(int x0, int y0, int x1, int y1, Cell value);
+
+    void copy_rect(const Grid &source, int x0, int y0, int x1, int y1, int x, int y);
 
     Grid crop(int x0, int y0, int x1, int y1) const;
 
@@ -78,3 +165,26 @@ public:
 
     bool valid_coordinate(int x, int y) const;
 };
+
+/**
+ * Grid::get_unchecked(x, y)
+ *
+ * Reads a cell without checking the coordinate, for loops that have already checked their bounds.
+ * Defined here so that it inlines into those loops, see Grid::get(x, y) for the checked version.
+ */
+inline Cell Grid::get_unchecked(int x, int y) const {
+    const Word word = words[std::size_t(_words_per_row) * std::size_t(y) + std::size_t(x / WORD_BITS)];
+    return (word >> (x % WORD_BITS)) & 1 ? ALIVE : DEAD;
+}
+
+/**
+ * Grid::set_unchecked(x, y, value)
+ *
+ * Writes a cell without checking the coordinate, for loops that have already checked their bounds.
+ * Defined here so that it inlines into those loops, see Grid::set(x, y, value) for the checked version.
+ */
+inline void Grid::set_unchecked(int x, int y, Cell value) {
+    const Word mask = Word(1) << (x % WORD_BITS);
+    Word &word = words[std::size_t(_words_per_row) * std::size_t(y) + std::size_t(x / WORD_BITS)];
+    word = value == ALIVE ? (word | mask) : (word & ~mask);
+}
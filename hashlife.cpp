@@ -0,0 +1,566 @@
+/**
+ * Implements a class representing an unbounded Game of Life plane simulated with Gosper's HashLife algorithm.
+ *      - https://www.conwaylife.com/wiki/HashLife
+ *
+ *      - The plane is stored as a quadtree. A node of level k is a square of 2^k by 2^k cells made of
+ *        four level k - 1 quadrants, down to level 0 nodes which are single cells.
+ *          - Nodes are canonical, every distinct square is built once and looked up in a hash table
+ *            after that, so repeated and empty regions cost almost nothing to store.
+ *          - The root node is centred on the origin, cell (x, y) of the plane is cell (x, y) of a Grid.
+ *
+ *      - The future of a node is memoised. The centre half of a level k node can be advanced by up to
+ *        2^(k - 2) generations using only the node itself, because nothing outside it can travel far
+ *        enough to affect the centre in that time.
+ *          - That RESULT is computed recursively from the results of overlapping sub-nodes and stored
+ *            on the node, so an oscillating or repeating pattern is only ever simulated once.
+ *          - Advancing by any number of generations is broken down into jumps of powers of two.
+ *
+ *      - Any Life-like rule can be simulated, except those giving birth with 0 neighbours, under which
+ *        the empty plane around the pattern would not stay empty.
+ *
+ *      - When the table grows too large it is rebuilt with just the nodes of the current pattern.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "hashlife.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * The number of nodes the table may hold before it is rebuilt with only the nodes still in use.
+ */
+static const std::size_t MAX_NODES = std::size_t(1) << 21;
+
+/**
+ * HashLife::Store::Key::operator==(other)
+ *
+ * Compare two node keys by the identity of their quadrants.
+ */
+bool HashLife::Store::Key::operator==(const Key &other) const {
+    return nw == other.nw && ne == other.ne && sw == other.sw && se == other.se;
+}
+
+/**
+ * HashLife::Store::KeyHash::operator()(key)
+ *
+ * Hash a node key by mixing the addresses of its canonical quadrants.
+ */
+std::size_t HashLife::Store::KeyHash::operator()(const Key &key) const {
+    std::uint64_t hash = 0;
+    for (const Node *quadrant : {key.nw, key.ne, key.sw, key.se}) {
+        hash = (hash ^ reinterpret_cast<std::uintptr_t>(quadrant)) * 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 29;
+    }
+    return std::size_t(hash);
+}
+
+/**
+ * HashLife::Store::StepHash::operator()(key)
+ *
+ * Hash a node and the power of two it was advanced by.
+ */
+std::size_t HashLife::Store::StepHash::operator()(const std::pair<const Node *, int> &key) const {
+    std::uint64_t hash = (reinterpret_cast<std::uintptr_t>(key.first) ^ std::uint64_t(key.second)) * 0x9E3779B97F4A7C15ULL;
+    return std::size_t(hash ^ (hash >> 31));
+}
+
+/**
+ * HashLife::Store::Store(rule)
+ *
+ * Construct a table holding only the two single cell nodes, for the results of stepping by a rule.
+ */
+HashLife::Store::Store(const Rule &rule) : rule(rule) {
+    nodes.push_back(Node{nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr});
+    dead = &nodes.back();
+    nodes.push_back(Node{nullptr, nullptr, nullptr, nullptr, 0, 1, nullptr});
+    alive = &nodes.back();
+    empty.push_back(dead);
+}
+
+/**
+ * HashLife::HashLife()
+ *
+ * Construct an empty plane at generation 0.
+ *
+ * @example
+ *
+ *      // Make an empty plane
+ *      HashLife life;
+ */
+HashLife::HashLife() : HashLife(Rule()) {}
+
+/**
+ * HashLife::HashLife(rule)
+ *
+ * Construct an empty plane at generation 0, to be stepped by a rule.
+ *
+ * @example
+ *
+ *      // Make an empty plane of HighLife
+ *      HashLife life(Rule::highlife());
+ *
+ * @param rule
+ *      The rule to step the plane by.
+ *
+ * @throws
+ *      std::runtime_error if the rule gives birth to cells with 0 neighbours.
+ */
+HashLife::HashLife(const Rule &rule) : _store(std::make_unique<Store>(rule)), _generation(0) {
+    if (rule.get_birth() & 1) {
+        throw std::runtime_error("The HashLife engine cannot simulate a rule with birth on 0 neighbours");
+    }
+    _root = empty(3);
+}
+
+/**
+ * HashLife::HashLife(grid, rule)
+ *
+ * Construct a plane at generation 0 holding the cells of a grid, with the grid's upper left corner
+ * at the origin. Everything outside the grid is dead.
+ *
+ * @example
+ *
+ *      // Make a plane with a glider at the origin
+ *      HashLife life(Zoo::glider());
+ *
+ *      // This should be a compiler error! We want to prevent this from being allowed.
+ *      HashLife bad_life = Zoo::glider();
+ *
+ * @param grid
+ *      The cells to start from.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step the plane by. Defaults to Conway's Game of Life.
+ *
+ * @throws
+ *      std::runtime_error if the rule gives birth to cells with 0 neighbours.
+ */
+HashLife::HashLife(const Grid &grid, const Rule &rule) : HashLife(rule) {
+    int level = 3;
+    while ((std::int64_t(1) << (level - 1)) < std::max(grid.get_width(), grid.get_height())) level++;
+
+    std::int64_t half = std::int64_t(1) << (level - 1);
+    _root = build(grid, -half, -half, level);
+}
+
+/**
+ * HashLife::HashLife(other)
+ *
+ * Construct a copy of a plane at the same generation, with the nodes of its pattern rebuilt in a table
+ * of its own. Memoised results are not copied, so the copy recomputes the futures it needs.
+ *
+ * @example
+ *
+ *      // Make a plane with a glider, and a copy of it to advance on another thread
+ *      HashLife life(Zoo::glider());
+ *      HashLife copy = life;
+ *
+ * @param other
+ *      The plane to copy.
+ */
+HashLife::HashLife(const HashLife &other)
+        : _store(std::make_unique<Store>(other._store->rule)), _generation(other._generation) {
+    std::unordered_map<const Node *, const Node *> adopted;
+    _root = adopt(other._root, adopted);
+}
+
+/**
+ * HashLife::operator=(other)
+ *
+ * Replace the plane with a copy of another, with the nodes of its pattern rebuilt in a table of its own.
+ *
+ * @param other
+ *      The plane to copy.
+ *
+ * @return
+ *      A reference to this plane.
+ */
+HashLife &HashLife::operator=(const HashLife &other) {
+    if (this != &other) *this = HashLife(other);
+    return *this;
+}
+
+/**
+ * HashLife::~HashLife()
+ *
+ * Destroy the plane and its table of nodes.
+ */
+HashLife::~HashLife() = default;
+
+/**
+ * HashLife::get_rule()
+ *
+ * Gets the rule the plane is stepped by.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A reference to the rule.
+ */
+const Rule &HashLife::get_rule() const {
+    return _store->rule;
+}
+
+/**
+ * HashLife::get_generation()
+ *
+ * Gets the number of generations the plane has been advanced since it was constructed.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The current generation.
+ */
+std::uint64_t HashLife::get_generation() const {
+    return _generation;
+}
+
+/**
+ * HashLife::get_population()
+ *
+ * Gets the number of alive cells on the whole plane, in constant time.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of alive cells.
+ */
+std::uint64_t HashLife::get_population() const {
+    return _root->population;
+}
+
+/**
+ * HashLife::get_node_count()
+ *
+ * Gets the number of canonical nodes held in the table, as a measure of memory use.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of nodes.
+ */
+std::size_t HashLife::get_node_count() const {
+    return _store->nodes.size();
+}
+
+/**
+ * HashLife::join(nw, ne, sw, se)
+ *
+ * Private helper function to find or create the canonical node with the given quadrants.
+ *
+ * @return
+ *      The node one level above its quadrants.
+ */
+const HashLife::Node *HashLife::join(const Node *nw, const Node *ne, const Node *sw, const Node *se) {
+    Store::Key key{nw, ne, sw, se};
+    auto found = _store->table.find(key);
+    if (found != _store->table.end()) return found->second;
+
+    _store->nodes.push_back(Node{nw, ne, sw, se, nw->level + 1,
+                                 nw->population + ne->population + sw->population + se->population, nullptr});
+    const Node *node = &_store->nodes.back();
+    _store->table.emplace(key, node);
+
+    return node;
+}
+
+/**
+ * HashLife::empty(level)
+ *
+ * Private helper function to get the canonical node of the given level with no alive cells.
+ */
+const HashLife::Node *HashLife::empty(int level) {
+    while ((int) _store->empty.size() <= level) {
+        const Node *below = _store->empty.back();
+        _store->empty.push_back(join(below, below, below, below));
+    }
+
+    return _store->empty[level];
+}
+
+/**
+ * HashLife::centre(node)
+ *
+ * Private helper function to get the node one level down covering the centre of a node of level 2 or more.
+ */
+const HashLife::Node *HashLife::centre(const Node *node) {
+    return join(node->nw->se, node->ne->sw, node->sw->ne, node->se->nw);
+}
+
+/**
+ * HashLife::expand(node)
+ *
+ * Private helper function to surround a node with dead cells, giving a node one level up with the
+ * same centre.
+ */
+const HashLife::Node *HashLife::expand(const Node *node) {
+    const Node *border = empty(node->level - 1);
+    return join(join(border, border, border, node->nw), join(border, border, node->ne, border),
+                join(border, node->sw, border, border), join(node->se, border, border, border));
+}
+
+/**
+ * HashLife::base_successor(node)
+ *
+ * Private helper function to advance the centre 2x2 cells of a level 2 node by one generation,
+ * by applying the rule of the plane directly to its 4x4 cells.
+ *
+ * @return
+ *      The level 1 node holding the next state of the centre cells.
+ */
+const HashLife::Node *HashLife::base_successor(const Node *node) {
+    if (node->result) return node->result;
+
+    // Unpack the 16 cells, quadrant by quadrant, into a 4x4 array
+    int cells[4][4];
+    const Node *quadrants[2][2] = {{node->nw, node->ne}, {node->sw, node->se}};
+    for (int qy = 0; qy < 2; qy++) {
+        for (int qx = 0; qx < 2; qx++) {
+            const Node *quadrant = quadrants[qy][qx];
+            cells[qy * 2][qx * 2] = (int) quadrant->nw->population;
+            cells[qy * 2][qx * 2 + 1] = (int) quadrant->ne->population;
+            cells[qy * 2 + 1][qx * 2] = (int) quadrant->sw->population;
+            cells[qy * 2 + 1][qx * 2 + 1] = (int) quadrant->se->population;
+        }
+    }
+
+    const Node *next[2][2];
+    for (int y = 1; y <= 2; y++) {
+        for (int x = 1; x <= 2; x++) {
+            int neighbours = -cells[y][x];
+            for (int yy = y - 1; yy <= y + 1; yy++) {
+                for (int xx = x - 1; xx <= x + 1; xx++) {
+                    neighbours += cells[yy][xx];
+                }
+            }
+            const unsigned mask = cells[y][x] ? _store->rule.get_survival() : _store->rule.get_birth();
+            bool alive = (mask >> neighbours) & 1;
+            next[y - 1][x - 1] = alive ? _store->alive : _store->dead;
+        }
+    }
+
+    node->result = join(next[0][0], next[0][1], next[1][0], next[1][1]);
+    return node->result;
+}
+
+/**
+ * HashLife::successor(node, exponent)
+ *
+ * Private helper function to advance the centre half of a node by 2^exponent generations.
+ * The exponent must be at most node->level - 2. Results of the largest possible jump are stored on
+ * the node, smaller jumps in a separate table.
+ *
+ * The node is split into 9 overlapping sub-nodes a level down, which are each advanced (or, for
+ * smaller jumps, simply centred), regrouped into 4 overlapping nodes, and advanced again.
+ *
+ * @return
+ *      The node one level down holding the advanced centre.
+ */
+const HashLife::Node *HashLife::successor(const Node *node, int exponent) {
+    if (node->population == 0) return empty(node->level - 1);
+    if (node->level == 2) return base_successor(node);
+
+    const bool full = exponent == node->level - 2;
+    if (full && node->result) return node->result;
+    if (!full) {
+        auto found = _store->steps.find({node, exponent});
+        if (found != _store->steps.end()) return found->second;
+    }
+
+    // The 9 overlapping sub-nodes, in rows from the upper left
+    const Node *parts[9] = {
+            node->nw, join(node->nw->ne, node->ne->nw, node->nw->se, node->ne->sw), node->ne,
+            join(node->nw->sw, node->nw->se, node->sw->nw, node->sw->ne), centre(node),
+            join(node->ne->sw, node->ne->se, node->se->nw, node->se->ne),
+            node->sw, join(node->sw->ne, node->se->nw, node->sw->se, node->se->sw), node->se
+    };
+
+    // A full jump spends half its generations here, a smaller jump spends none
+    for (const Node *&part : parts) {
+        part = full ? successor(part, exponent - 1) : centre(part);
+    }
+
+    const int inner = full ? exponent - 1 : exponent;
+    const Node *result = join(successor(join(parts[0], parts[1], parts[3], parts[4]), inner),
+                              successor(join(parts[1], parts[2], parts[4], parts[5]), inner),
+                              successor(join(parts[3], parts[4], parts[6], parts[7]), inner),
+                              successor(join(parts[4], parts[5], parts[7], parts[8]), inner));
+
+    if (full) {
+        node->result = result;
+    } else {
+        _store->steps.emplace(std::make_pair(node, exponent), result);
+    }
+
+    return result;
+}
+
+/**
+ * HashLife::build(grid, x, y, level)
+ *
+ * Private helper function to build the node covering the square of the plane with its upper left corner
+ * at (x, y), reading alive cells from a grid placed at the origin.
+ */
+const HashLife::Node *HashLife::build(const Grid &grid, std::int64_t x, std::int64_t y, int level) {
+    std::int64_t size = std::int64_t(1) << level;
+    if (x >= grid.get_width() || y >= grid.get_height() || x + size <= 0 || y + size <= 0) return empty(level);
+    if (level == 0) return grid.get_unchecked(int(x), int(y)) == ALIVE ? _store->alive : _store->dead;
+
+    std::int64_t half = size / 2;
+    return join(build(grid, x, y, level - 1), build(grid, x + half, y, level - 1),
+                build(grid, x, y + half, level - 1), build(grid, x + half, y + half, level - 1));
+}
+
+/**
+ * HashLife::paint(node, x, y, grid, x0, y0)
+ *
+ * Private helper function to write the alive cells of a node with its upper left corner at (x, y)
+ * into a grid whose upper left corner is at (x0, y0), skipping empty and out of view nodes.
+ */
+void HashLife::paint(const Node *node, std::int64_t x, std::int64_t y, Grid &grid,
+                     std::int64_t x0, std::int64_t y0) const {
+    std::int64_t size = std::int64_t(1) << node->level;
+    if (node->population == 0 || x >= x0 + grid.get_width() || y >= y0 + grid.get_height() ||
+        x + size <= x0 || y + size <= y0)
+        return;
+
+    if (node->level == 0) {
+        grid.set_unchecked(int(x - x0), int(y - y0), ALIVE);
+        return;
+    }
+
+    std::int64_t half = size / 2;
+    paint(node->nw, x, y, grid, x0, y0);
+    paint(node->ne, x + half, y, grid, x0, y0);
+    paint(node->sw, x, y + half, grid, x0, y0);
+    paint(node->se, x + half, y + half, grid, x0, y0);
+}
+
+/**
+ * HashLife::adopt(node, adopted)
+ *
+ * Private helper function to rebuild a node of another table, and every node below it, in this table.
+ *
+ * @param node
+ *      The node to rebuild, from any table.
+ *
+ * @param adopted
+ *      The nodes rebuilt so far, by the node they were rebuilt from, so shared quadrants are rebuilt once.
+ *
+ * @return
+ *      The canonical node of this table with the same cells.
+ */
+const HashLife::Node *HashLife::adopt(const Node *node, std::unordered_map<const Node *, const Node *> &adopted) {
+    if (node->level == 0) return node->population ? _store->alive : _store->dead;
+    auto found = adopted.find(node);
+    if (found != adopted.end()) return found->second;
+
+    const Node *fresh = join(adopt(node->nw, adopted), adopt(node->ne, adopted),
+                             adopt(node->sw, adopted), adopt(node->se, adopted));
+    adopted.emplace(node, fresh);
+    return fresh;
+}
+
+/**
+ * HashLife::collect()
+ *
+ * Private helper function to rebuild the table with only the nodes of the current pattern,
+ * dropping everything else, memoised results included.
+ */
+void HashLife::collect() {
+    std::unique_ptr<Store> old = std::move(_store);
+    _store = std::make_unique<Store>(old->rule);
+
+    std::unordered_map<const Node *, const Node *> adopted;
+    _root = adopt(_root, adopted);
+}
+
+/**
+ * HashLife::advance(generations)
+ *
+ * Advance the plane by any number of generations, as a series of jumps of powers of two.
+ * Before each jump the root is padded with dead cells until nothing can reach its edge in time.
+ *
+ * @example
+ *
+ *      // Make a plane with an r-pentomino
+ *      HashLife life(Zoo::r_pentomino());
+ *
+ *      // Advance it a billion generations
+ *      life.advance(1000000000);
+ *
+ * @param generations
+ *      The number of generations to advance the plane forward.
+ */
+void HashLife::advance(std::uint64_t generations) {
+    for (int exponent = 0; exponent < 64; exponent++) {
+        if (!((generations >> exponent) & 1)) continue;
+
+        if (_store->nodes.size() > MAX_NODES) collect();
+
+        // Make sure the pattern sits in the centre quarter of the root, and the jump fits inside it
+        while (_root->level < exponent + 3 || centre(centre(_root))->population != _root->population) {
+            _root = expand(_root);
+        }
+
+        _root = successor(_root, exponent);
+        _generation += std::uint64_t(1) << exponent;
+    }
+}
+
+/**
+ * HashLife::jump(exponent)
+ *
+ * Advance the plane by exactly 2^exponent generations in a single jump.
+ *
+ * @example
+ *
+ *      // Make a plane with a glider
+ *      HashLife life(Zoo::glider());
+ *
+ *      // Advance it 2^40 generations
+ *      life.jump(40);
+ *
+ * @param exponent
+ *      The power of two to advance by, between 0 and 63.
+ */
+void HashLife::jump(int exponent) {
+    advance(std::uint64_t(1) << exponent);
+}
+
+/**
+ * HashLife::to_grid(x0, y0, width, height)
+ *
+ * Copy a rectangular window of the plane out into a Grid.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Make a plane from a grid
+ *      HashLife life(grid);
+ *
+ *      // Read the same area back
+ *      Grid same = life.to_grid(0, 0, grid.get_width(), grid.get_height());
+ *
+ * @param x0
+ *      The x coordinate of the upper left corner of the window.
+ *
+ * @param y0
+ *      The y coordinate of the upper left corner of the window.
+ *
+ * @param width
+ *      The width of the window.
+ *
+ * @param height
+ *      The height of the window.
+ *
+ * @return
+ *      A grid holding the cells inside the window.
+ */
+Grid HashLife::to_grid(std::int64_t x0, std::int64_t y0, int width, int height) const {
+    Grid grid(width, height);
+    std::int64_t half = std::int64_t(1) << (_root->level - 1);
+    paint(_root, -half, -half, grid, x0, y0);
+
+    return grid;
+}
@@ -0,0 +1,126 @@
+/**
+ * Declares a class representing an unbounded Game of Life plane simulated with Gosper's HashLife algorithm.
+ * Rich documentation for the api and behaviour the HashLife class can be found in hashlife.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Declare the structure of the HashLife class for jumping patterns far forwards in time.
+ *
+ * The plane is a quadtree of canonical nodes, so every distinct square of cells is stored only once
+ * and its future is only ever computed once.
+ *      - Every HashLife owns its table, a copy rebuilds the nodes of the pattern in a table of its own,
+ *        so copies evolve independently and can be advanced from different threads.
+ */
+class HashLife {
+public:
+    /**
+     * A square of 2^level by 2^level cells, split into four quadrants one level down.
+     * Level 0 nodes are single cells and have no quadrants.
+     */
+    struct Node {
+        const Node *nw, *ne, *sw, *se;
+        int level;
+        std::uint64_t population;
+        mutable const Node *result;
+    };
+
+private:
+    /**
+     * The table of canonical nodes, owned by a single HashLife.
+     */
+    struct Store {
+        struct Key {
+            const Node *nw, *ne, *sw, *se;
+
+            bool operator==(const Key &other) const;
+        };
+
+        struct KeyHash {
+            std::size_t operator()(const Key &key) const;
+        };
+
+        struct StepHash {
+            std::size_t operator()(const std::pair<const Node *, int> &key) const;
+        };
+
+        std::deque<Node> nodes;
+        std::unordered_map<Key, const Node *, KeyHash> table;
+        std::unordered_map<std::pair<const Node *, int>, const Node *, StepHash> steps;
+        std::vector<const Node *> empty;
+        const Node *dead, *alive;
+        Rule rule;
+
+        explicit Store(const Rule &rule);
+    };
+
+    std::unique_ptr<Store> _store;
+    const Node *_root;
+    std::uint64_t _generation;
+
+    const Node *join(const Node *nw, const Node *ne, const Node *sw, const Node *se);
+
+    const Node *empty(int level);
+
+    const Node *centre(const Node *node);
+
+    const Node *expand(const Node *node);
+
+    const Node *base_successor(const Node *node);
+
+    const Node *successor(const Node *node, int exponent);
+
+    const Node *adopt(const Node *node, std::unordered_map<const Node *, const Node *> &adopted);
+
+    const Node *build(const Grid &grid, std::int64_t x, std::int64_t y, int level);
+
+    void paint(const Node *node, std::int64_t x, std::int64_t y, Grid &grid,
+               std::int64_t x0, std::int64_t y0) const;
+
+    void collect();
+
+public:
+    HashLife();
+
+    explicit HashLife(const Rule &rule);
+
+    explicit HashLife(const Grid &grid, const Rule &rule = Rule());
+
+    HashLife(const HashLife &other);
+
+    HashLife(HashLife &&other) noexcept = default;
+
+    HashLife &operator=(const HashLife &other);
+
+    HashLife &operator=(HashLife &&other) noexcept = default;
+
+    ~HashLife();
+
+    const Rule &get_rule() const;
+
+    std::uint64_t get_generation() const;
+
+    std::uint64_t get_population() const;
+
+    std::size_t get_node_count() const;
+
+    void advance(std::uint64_t generations);
+
+    void jump(int exponent);
+
+    Grid to_grid(std::int64_t x0, std::int64_t y0, int width, int height) const;
+};
@@ -0,0 +1,77 @@
+/**
+ * Implements a HugePages namespace with an allocator backing large buffers with huge pages where possible.
+ *      - Stepping a large grid streams through all of it, so with ordinary 4 KiB pages nearly every row
+ *        needs its own TLB entry. A 2 MiB huge page covers 256 rows of 64 Ki cells each.
+ *
+ *      - Allocations of at least HugePages::PAGE_BYTES are aligned to a huge page, and on Linux marked
+ *        with madvise(MADV_HUGEPAGE) so transparent huge pages back them even if the system only enables
+ *        them when asked.
+ *          - The advice is only a hint, the memory works the same without huge pages.
+ *      - Smaller allocations come from operator new as usual.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "huge_pages.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+/**
+ * HugePages::allocate(bytes)
+ *
+ * Allocate a block of memory, aligned to a huge page if it is at least as big as one.
+ *
+ * @example
+ *
+ *      // Allocate 64 MiB for a grid, then give it back
+ *      void *cells = HugePages::allocate(std::size_t(64) << 20);
+ *      HugePages::deallocate(cells, std::size_t(64) << 20);
+ *
+ * @param bytes
+ *      The size of the block.
+ *
+ * @return
+ *      A pointer to the block, which must be freed with HugePages::deallocate and the same size.
+ *
+ * @throws
+ *      std::bad_alloc if there is not enough memory.
+ */
+void *HugePages::allocate(std::size_t bytes) {
+    if (bytes < PAGE_BYTES) return ::operator new(bytes);
+
+    // aligned_alloc needs a whole number of alignments
+    const std::size_t rounded = (bytes + PAGE_BYTES - 1) / PAGE_BYTES * PAGE_BYTES;
+    void *pointer = std::aligned_alloc(PAGE_BYTES, rounded);
+    if (!pointer) throw std::bad_alloc();
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    madvise(pointer, rounded, MADV_HUGEPAGE);
+#endif
+    return pointer;
+}
+
+/**
+ * HugePages::deallocate(pointer, bytes)
+ *
+ * Free a block allocated by HugePages::allocate.
+ *
+ * @param pointer
+ *      The block to free.
+ *
+ * @param bytes
+ *      The size the block was allocated with.
+ */
+void HugePages::deallocate(void *pointer, std::size_t bytes) {
+    if (bytes < PAGE_BYTES) {
+        ::operator delete(pointer);
+    } else {
+        std::free(pointer);
+    }
+}
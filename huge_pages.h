@@ -0,0 +1,50 @@
+/**
+ * Declares a HugePages namespace with an allocator backing large buffers with huge pages where possible.
+ * Rich documentation for the api and behaviour the HugePages namespace can be found in huge_pages.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the namespace.
+// #include ...
+#include <cstddef>
+
+/**
+ * Declare the interface of the HugePages namespace for allocating memory a step of a simulation streams through.
+ */
+namespace HugePages {
+    /**
+     * The size of a huge page, allocations at least this big are aligned to it and offered to the kernel as huge pages.
+     */
+    static const std::size_t PAGE_BYTES = std::size_t(2) << 20;
+
+    void *allocate(std::size_t bytes);
+
+    void deallocate(void *pointer, std::size_t bytes);
+
+    /**
+     * A standard library allocator handing out memory from HugePages::allocate.
+     * Declared here as containers instantiate it for their element type.
+     */
+    template<class T>
+    struct Allocator {
+        using value_type = T;
+
+        Allocator() = default;
+
+        template<class U>
+        Allocator(const Allocator<U> &) {}
+
+        T *allocate(std::size_t count) { return static_cast<T *>(HugePages::allocate(count * sizeof(T))); }
+
+        void deallocate(T *pointer, std::size_t count) { HugePages::deallocate(pointer, count * sizeof(T)); }
+
+        template<class U>
+        bool operator==(const Allocator<U> &) const { return true; }
+
+        template<class U>
+        bool operator!=(const Allocator<U> &) const { return false; }
+    };
+}
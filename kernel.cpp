@@ -0,0 +1,426 @@
+/**
+ * Implements a Kernel namespace with the word-parallel update rule used to step a World.
+ *      - Rows are read and written in the bit-packed format of Grid::row_words(y).
+ *      - 64 cells are updated at once by summing the 8 neighbour bits of every cell in a word with
+ *        bitwise full adders, so no cell is ever visited on its own.
+ *
+ *      - Words in the middle of a row only need their neighbouring words in the same three rows.
+ *      - The first and last word of a row are edge words, which pull in the opposite end of the row
+ *        when the world is toroidal and dead cells otherwise.
+ *      - Wrapping from the top edge to the bottom is up to the caller, who chooses which rows to pass in.
+ *
+ *      - Any Life-like rule can be applied to the neighbour counts, see rule.cpp.
+ *          - Conway, HighLife, Seeds and Day & Night each have a kernel compiled for their rule alone,
+ *            so Conway's rule costs exactly what it did before other rules were supported.
+ *          - Every other rule is read from its masks of neighbour counts by a generic kernel, which
+ *            adds one term per neighbour count the rule mentions.
+ *
+ *      - The middle words of each row are handed to the widest implementation the CPU supports, picked
+ *        once at startup: AVX-512, AVX2 or NEON, falling back to plain 64 bit words.
+ *          - The vector implementations live in kernel_*.cpp, each built for its own instruction set.
+ *          - Every implementation produces identical results, one may be forced with Kernel::set_implementation.
+ *
+ *      - Many small worlds of the same size can be stepped side by side instead, see Kernel::step_batch.
+ *          - The same word of each world sits next to the others, so each lane of a vector steps its own world.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "kernel.h"
+#include "kernel_impl.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <stdexcept>
+
+#if defined(__aarch64__) && defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+/**
+ * An entry in the dispatch table of interior implementations, widest first.
+ */
+struct Implementation {
+    const char *name;
+
+    Kernel::InteriorFunction (*interior)(Kernel::RuleKernel kernel);
+
+    Kernel::BatchFunction (*batch)(Kernel::RuleKernel kernel);
+
+    bool (*supported)();
+};
+
+/**
+ * scalar_interior(kernel), scalar_batch(kernel)
+ *
+ * Private helper functions returning the plain 64 bit word implementation, which is always available.
+ */
+static Kernel::InteriorFunction scalar_interior(Kernel::RuleKernel kernel) {
+    return interior_for<ScalarOps>(kernel);
+}
+
+static Kernel::BatchFunction scalar_batch(Kernel::RuleKernel kernel) {
+    return batch_for<ScalarOps>(kernel);
+}
+
+/**
+ * cpu_supports_avx512(), cpu_supports_avx2(), cpu_supports_neon(), cpu_supports_scalar()
+ *
+ * Private helper functions asking the CPU (and operating system) which instruction sets can be used.
+ */
+static bool cpu_supports_avx512() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_cpu_supports("avx512f");
+#else
+    return false;
+#endif
+}
+
+static bool cpu_supports_avx2() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+static bool cpu_supports_neon() {
+#if defined(__aarch64__) && defined(__linux__)
+    return (getauxval(AT_HWCAP) & HWCAP_ASIMD) != 0;
+#elif defined(__aarch64__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+static bool cpu_supports_scalar() {
+    return true;
+}
+
+static const Implementation implementations[] = {
+        {"avx512", &Kernel::avx512_interior, &Kernel::avx512_batch, &cpu_supports_avx512},
+        {"avx2",   &Kernel::avx2_interior,   &Kernel::avx2_batch,   &cpu_supports_avx2},
+        {"neon",   &Kernel::neon_interior,   &Kernel::neon_batch,   &cpu_supports_neon},
+        {"scalar", &scalar_interior,         &scalar_batch,         &cpu_supports_scalar},
+};
+
+/**
+ * usable(implementation)
+ *
+ * Private helper function to check an implementation was compiled in and can run on this CPU.
+ */
+static bool usable(const Implementation &implementation) {
+    return implementation.interior(Kernel::CONWAY) != nullptr && implementation.supported();
+}
+
+/**
+ * active()
+ *
+ * Private helper function holding the implementation in use, initialised to the first usable
+ * entry of the dispatch table the first time a row is stepped.
+ */
+static const Implementation *&active() {
+    static const Implementation *selected = [] {
+        const Implementation *implementation = implementations;
+        while (!usable(*implementation)) implementation++; // scalar at the end is always usable
+        return implementation;
+    }();
+    return selected;
+}
+
+/**
+ * Interiors
+ *
+ * The interior and batch functions of an implementation, one of each for each rule kernel.
+ */
+struct Interiors {
+    Kernel::InteriorFunction functions[Kernel::RULE_KERNELS];
+    Kernel::BatchFunction batches[Kernel::RULE_KERNELS];
+
+    explicit Interiors(const Implementation &implementation) : functions(), batches() {
+        for (int kernel = 0; kernel < Kernel::RULE_KERNELS; kernel++) {
+            functions[kernel] = implementation.interior(Kernel::RuleKernel(kernel));
+            batches[kernel] = implementation.batch(Kernel::RuleKernel(kernel));
+        }
+    }
+};
+
+/**
+ * active_interiors()
+ *
+ * Private helper function caching the interior functions of the active implementation.
+ */
+static Interiors &active_interiors() {
+    static Interiors interiors(*active());
+    return interiors;
+}
+
+/**
+ * rule_kernel(rule)
+ *
+ * Private helper function to pick the kernel compiled for a rule, or the generic kernel if there is none.
+ */
+static Kernel::RuleKernel rule_kernel(const Rule &rule) {
+    if (rule == Rule::conway()) return Kernel::CONWAY;
+    if (rule == Rule::highlife()) return Kernel::HIGHLIFE;
+    if (rule == Rule::seeds()) return Kernel::SEEDS;
+    if (rule == Rule::day_and_night()) return Kernel::DAY_AND_NIGHT;
+    return Kernel::GENERIC;
+}
+
+/**
+ * edge_word<R>(above, row, below, index, width, toroidal, birth, survival)
+ *
+ * Private helper function to compute the next state of the first or last word in a row by rule R.
+ * Neighbour bits past the ends of the row come from the opposite end if toroidal, otherwise they are dead.
+ * Bits of the result past the width of the row are cleared.
+ *
+ * @return
+ *      The next state of word index of the row.
+ */
+template<class R>
+static Kernel::Word edge_word(const Kernel::Word *above, const Kernel::Word *row, const Kernel::Word *below,
+                              int index, int width, bool toroidal, unsigned birth, unsigned survival) {
+    const int words = (width + Grid::WORD_BITS - 1) / Grid::WORD_BITS;
+    const int last_bit = (width - 1) % Grid::WORD_BITS;
+
+    // The neighbour shifted in from the left of bit 0, and in from the right of the last cell
+    auto west_carry = [&](const Kernel::Word *line) -> Kernel::Word {
+        if (index > 0) return line[index - 1] >> (Grid::WORD_BITS - 1);
+        return toroidal ? (line[words - 1] >> last_bit) & 1 : 0;
+    };
+    auto east_carry = [&](const Kernel::Word *line) -> Kernel::Word {
+        Kernel::Word carry = index + 1 < words ? line[index + 1] << (Grid::WORD_BITS - 1) : 0;
+        if (index == words - 1 && toroidal) carry |= (line[0] & 1) << last_bit;
+        return carry;
+    };
+
+    Kernel::Word next = next_state<ScalarOps, R>((above[index] << 1) | west_carry(above), above[index],
+                                                 (above[index] >> 1) | east_carry(above),
+                                                 (row[index] << 1) | west_carry(row), row[index],
+                                                 (row[index] >> 1) | east_carry(row),
+                                                 (below[index] << 1) | west_carry(below), below[index],
+                                                 (below[index] >> 1) | east_carry(below), birth, survival);
+
+    // The last word shifts live cells into its padding, which must stay clear
+    if (index == words - 1 && last_bit != Grid::WORD_BITS - 1)
+        next &= (Kernel::Word(1) << (last_bit + 1)) - 1;
+
+    return next;
+}
+
+/**
+ * edge_word(above, row, below, index, width, toroidal, kernel, birth, survival)
+ *
+ * Private helper function to compute the next state of an edge word, by Conway's rule directly and by
+ * reading the masks of any other rule.
+ */
+static Kernel::Word edge_word(const Kernel::Word *above, const Kernel::Word *row, const Kernel::Word *below,
+                              int index, int width, bool toroidal, Kernel::RuleKernel kernel,
+                              unsigned birth, unsigned survival) {
+    if (kernel == Kernel::CONWAY) return edge_word<ConwayRule>(above, row, below, index, width, toroidal, 0, 0);
+    return edge_word<GenericRule>(above, row, below, index, width, toroidal, birth, survival);
+}
+
+/**
+ * Kernel::step_row(above, row, below, next, width, toroidal, rule)
+ *
+ * Compute the next state of a whole bit-packed row.
+ *
+ * @example
+ *
+ *      // Step row 1 of a 3 row grid into another grid of the same size
+ *      Kernel::step_row(current.row_words(0), current.row_words(1), current.row_words(2),
+ *                       next.row_words(1), current.get_width(), false);
+ *
+ * @param above
+ *      The packed row above, or a row of dead words if there is none.
+ *
+ * @param row
+ *      The packed row to update.
+ *
+ * @param below
+ *      The packed row below, or a row of dead words if there is none.
+ *
+ * @param next
+ *      Where to write the packed next state of the row.
+ *
+ * @param width
+ *      The number of cells in each row.
+ *
+ * @param toroidal
+ *      If true then the left edge of the row wraps to the right edge.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step the cells by. Defaults to Conway's Game of Life.
+ */
+void Kernel::step_row(const Word *above, const Word *row, const Word *below, Word *next, int width, bool toroidal,
+                      const Rule &rule) {
+    step_words(above, row, below, next, 0, (width + Grid::WORD_BITS - 1) / Grid::WORD_BITS, width, toroidal, rule);
+}
+
+/**
+ * Kernel::step_words(above, row, below, next, first, last, width, toroidal, rule)
+ *
+ * Compute the next state of the words [first, last) of a bit-packed row.
+ * Only next[first] to next[last - 1] are written.
+ *
+ * @param above
+ *      The packed row above, or a row of dead words if there is none.
+ *
+ * @param row
+ *      The packed row to update.
+ *
+ * @param below
+ *      The packed row below, or a row of dead words if there is none.
+ *
+ * @param next
+ *      The packed row to write the next state into.
+ *
+ * @param first
+ *      The index of the first word to update.
+ *
+ * @param last
+ *      The index one past the last word to update.
+ *
+ * @param width
+ *      The number of cells in each row.
+ *
+ * @param toroidal
+ *      If true then the left edge of the row wraps to the right edge.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step the cells by. Defaults to Conway's Game of Life.
+ */
+void Kernel::step_words(const Word *above, const Word *row, const Word *below, Word *next,
+                        int first, int last, int width, bool toroidal, const Rule &rule) {
+    const int words = (width + Grid::WORD_BITS - 1) / Grid::WORD_BITS;
+    const RuleKernel kernel = rule_kernel(rule);
+    const unsigned birth = rule.get_birth(), survival = rule.get_survival();
+
+    // Peel off the edge words, which need to know about the ends of the row
+    if (first == 0 && last > 0) {
+        next[0] = edge_word(above, row, below, 0, width, toroidal, kernel, birth, survival);
+        first = 1;
+    }
+    if (last == words && last > first) {
+        next[words - 1] = edge_word(above, row, below, words - 1, width, toroidal, kernel, birth, survival);
+        last = words - 1;
+    }
+
+    // Every remaining word has a neighbouring word on both sides
+    if (first < last) active_interiors().functions[kernel](above, row, below, next, first, last, birth, survival);
+}
+
+/**
+ * Kernel::step_batch(above, row, below, next, count, stride, width, toroidal, rule)
+ *
+ * Compute the next state of one row of count equally sized worlds laid out side by side, so that
+ * a vector of words holds the same word of as many worlds as it has lanes.
+ * Word w of world i of a row is at index w * stride + i, and every row has the same layout.
+ *
+ * @example
+ *
+ *      // Step row y of 1000 worlds of 32x32 cells, each row being 1000 words one per world
+ *      Kernel::step_batch(current + (y - 1) * 1000, current + y * 1000, current + (y + 1) * 1000,
+ *                         next + y * 1000, 1000, 1000, 32, false);
+ *
+ * @param above
+ *      The packed row above of the first world, or a row of dead words if there is none.
+ *
+ * @param row
+ *      The packed row to update of the first world.
+ *
+ * @param below
+ *      The packed row below of the first world, or a row of dead words if there is none.
+ *
+ * @param next
+ *      Where to write the packed next state of the row of the first world.
+ *
+ * @param count
+ *      The number of worlds to update.
+ *
+ * @param stride
+ *      The distance between consecutive words of a world's row, at least count.
+ *
+ * @param width
+ *      The number of cells in each row of each world.
+ *
+ * @param toroidal
+ *      If true then the left edge of each world's row wraps to its right edge.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step the cells by. Defaults to Conway's Game of Life.
+ */
+void Kernel::step_batch(const Word *above, const Word *row, const Word *below, Word *next,
+                        int count, int stride, int width, bool toroidal, const Rule &rule) {
+    if (count <= 0 || width <= 0) return;
+
+    active_interiors().batches[rule_kernel(rule)](above, row, below, next, count, stride, width, toroidal,
+                                                  rule.get_birth(), rule.get_survival());
+}
+
+/**
+ * Kernel::get_implementation()
+ *
+ * Gets the name of the implementation used to step the middle words of each row.
+ *
+ * @example
+ *
+ *      // Print which instruction set worlds are being stepped with
+ *      std::cout << Kernel::get_implementation() << std::endl;
+ *
+ * @return
+ *      One of "avx512", "avx2", "neon" or "scalar".
+ */
+std::string Kernel::get_implementation() {
+    return active()->name;
+}
+
+/**
+ * Kernel::set_implementation(name)
+ *
+ * Force a particular implementation to be used instead of the widest one the CPU supports.
+ * Should not be called while any world is being stepped.
+ *
+ * @example
+ *
+ *      // Compare against the plain 64 bit word implementation
+ *      Kernel::set_implementation("scalar");
+ *
+ * @param name
+ *      The name of the implementation, as listed by Kernel::get_implementations().
+ *
+ * @throws
+ *      std::runtime_error if the implementation does not exist or cannot run on this CPU.
+ */
+void Kernel::set_implementation(const std::string &name) {
+    for (const Implementation &implementation : implementations) {
+        if (name == implementation.name && usable(implementation)) {
+            active() = &implementation;
+            active_interiors() = Interiors(implementation);
+            return;
+        }
+    }
+
+    throw std::runtime_error("Kernel implementation " + name + " is not available");
+}
+
+/**
+ * Kernel::get_implementations()
+ *
+ * Lists the implementations that were compiled in and can run on this CPU, widest first.
+ *
+ * @return
+ *      The names of the usable implementations, always ending with "scalar".
+ */
+std::vector<std::string> Kernel::get_implementations() {
+    std::vector<std::string> names;
+    for (const Implementation &implementation : implementations) {
+        if (usable(implementation)) names.emplace_back(implementation.name);
+    }
+
+    return names;
+}
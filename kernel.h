@@ -0,0 +1,38 @@
+/**
+ * Declares a Kernel namespace with the word-parallel update rule used to step a World.
+ * Rich documentation for the api and behaviour the Kernel namespace can be found in kernel.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the namespace.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Declare the interface of the Kernel namespace for computing the next state of bit-packed rows.
+ */
+namespace Kernel {
+    using Word = Grid::Word;
+
+    void step_row(const Word *above, const Word *row, const Word *below, Word *next, int width, bool toroidal,
+                  const Rule &rule = Rule());
+
+    void step_words(const Word *above, const Word *row, const Word *below, Word *next,
+                    int first, int last, int width, bool toroidal, const Rule &rule = Rule());
+
+    void step_batch(const Word *above, const Word *row, const Word *below, Word *next,
+                    int count, int stride, int width, bool toroidal, const Rule &rule = Rule());
+
+    std::string get_implementation();
+
+    void set_implementation(const std::string &name);
+
+    std::vector<std::string> get_implementations();
+}
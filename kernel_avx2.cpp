@@ -0,0 +1,72 @@
+/**
+ * Implements the AVX2 variant of the Kernel namespace, updating 4 words (256 cells) per instruction.
+ * Compiled with AVX2 enabled, and only ever called once Kernel has checked the CPU supports it.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "kernel_impl.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+namespace {
+    struct Avx2Ops {
+        using Vector = __m256i;
+        static constexpr int LANES = 4;
+
+        static Vector load(const std::uint64_t *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+
+        static void store(std::uint64_t *p, Vector v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+
+        static Vector west(Vector v, Vector previous) {
+            return _mm256_or_si256(_mm256_slli_epi64(v, 1), _mm256_srli_epi64(previous, 63));
+        }
+
+        static Vector east(Vector v, Vector next) {
+            return _mm256_or_si256(_mm256_srli_epi64(v, 1), _mm256_slli_epi64(next, 63));
+        }
+
+        static Vector xor3(Vector a, Vector b, Vector c) { return _mm256_xor_si256(_mm256_xor_si256(a, b), c); }
+
+        static Vector majority(Vector a, Vector b, Vector c) {
+            return _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_xor_si256(a, b)));
+        }
+
+        static Vector bit_xor(Vector a, Vector b) { return _mm256_xor_si256(a, b); }
+
+        static Vector bit_and(Vector a, Vector b) { return _mm256_and_si256(a, b); }
+
+        static Vector bit_or(Vector a, Vector b) { return _mm256_or_si256(a, b); }
+
+        static Vector and_not(Vector a, Vector b) { return _mm256_andnot_si256(a, b); }
+
+        static Vector bit_not(Vector a) { return _mm256_xor_si256(a, _mm256_set1_epi64x(-1)); }
+
+        static Vector shift_left(Vector a, int bits) { return _mm256_sll_epi64(a, _mm_cvtsi32_si128(bits)); }
+
+        static Vector shift_right(Vector a, int bits) { return _mm256_srl_epi64(a, _mm_cvtsi32_si128(bits)); }
+
+        static Vector broadcast(std::uint64_t word) { return _mm256_set1_epi64x((long long) word); }
+    };
+}
+
+Kernel::InteriorFunction Kernel::avx2_interior(RuleKernel kernel) {
+    return interior_for<Avx2Ops>(kernel);
+}
+
+Kernel::BatchFunction Kernel::avx2_batch(RuleKernel kernel) {
+    return batch_for<Avx2Ops>(kernel);
+}
+
+#else
+
+Kernel::InteriorFunction Kernel::avx2_interior(RuleKernel) {
+    return nullptr;
+}
+
+Kernel::BatchFunction Kernel::avx2_batch(RuleKernel) {
+    return nullptr;
+}
+
+#endif
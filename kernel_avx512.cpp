@@ -0,0 +1,72 @@
+/**
+ * Implements the AVX-512 variant of the Kernel namespace, updating 8 words (512 cells) per instruction.
+ * Each full adder collapses into a pair of three input ternary logic instructions.
+ * Compiled with AVX-512F enabled, and only ever called once Kernel has checked the CPU supports it.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "kernel_impl.h"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+
+namespace {
+    struct Avx512Ops {
+        using Vector = __m512i;
+        static constexpr int LANES = 8;
+
+        static Vector load(const std::uint64_t *p) { return _mm512_loadu_si512(p); }
+
+        static void store(std::uint64_t *p, Vector v) { _mm512_storeu_si512(p, v); }
+
+        static Vector west(Vector v, Vector previous) {
+            return _mm512_or_si512(_mm512_slli_epi64(v, 1), _mm512_srli_epi64(previous, 63));
+        }
+
+        static Vector east(Vector v, Vector next) {
+            return _mm512_or_si512(_mm512_srli_epi64(v, 1), _mm512_slli_epi64(next, 63));
+        }
+
+        // Truth tables for a ^ b ^ c and for at least two of a, b, c being set
+        static Vector xor3(Vector a, Vector b, Vector c) { return _mm512_ternarylogic_epi64(a, b, c, 0x96); }
+
+        static Vector majority(Vector a, Vector b, Vector c) { return _mm512_ternarylogic_epi64(a, b, c, 0xE8); }
+
+        static Vector bit_xor(Vector a, Vector b) { return _mm512_xor_si512(a, b); }
+
+        static Vector bit_and(Vector a, Vector b) { return _mm512_and_si512(a, b); }
+
+        static Vector bit_or(Vector a, Vector b) { return _mm512_or_si512(a, b); }
+
+        static Vector and_not(Vector a, Vector b) { return _mm512_andnot_si512(a, b); }
+
+        static Vector bit_not(Vector a) { return _mm512_ternarylogic_epi64(a, a, a, 0x55); }
+
+        static Vector shift_left(Vector a, int bits) { return _mm512_sll_epi64(a, _mm_cvtsi32_si128(bits)); }
+
+        static Vector shift_right(Vector a, int bits) { return _mm512_srl_epi64(a, _mm_cvtsi32_si128(bits)); }
+
+        static Vector broadcast(std::uint64_t word) { return _mm512_set1_epi64((long long) word); }
+    };
+}
+
+Kernel::InteriorFunction Kernel::avx512_interior(RuleKernel kernel) {
+    return interior_for<Avx512Ops>(kernel);
+}
+
+Kernel::BatchFunction Kernel::avx512_batch(RuleKernel kernel) {
+    return batch_for<Avx512Ops>(kernel);
+}
+
+#else
+
+Kernel::InteriorFunction Kernel::avx512_interior(RuleKernel) {
+    return nullptr;
+}
+
+Kernel::BatchFunction Kernel::avx512_batch(RuleKernel) {
+    return nullptr;
+}
+
+#endif
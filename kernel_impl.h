@@ -0,0 +1,385 @@
+/**
+ * Declares the word-parallel update rule shared by every instruction set variant of the Kernel namespace.
+ * This header is private to kernel.cpp and the kernel_*.cpp files, each of which may be compiled with
+ * different instruction set flags. Everything here is deliberately kept out of other headers and given
+ * internal linkage, so that code built for one instruction set is never picked by the linker for another.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace Kernel {
+    /**
+     * Computes the next state of words [first, last) of a packed row, where each of those words has a
+     * neighbouring word on both sides in all three rows. The birth and survival masks are only read by
+     * the generic kernel, the specialised kernels have their rule compiled in.
+     */
+    using InteriorFunction = void (*)(const std::uint64_t *above, const std::uint64_t *row,
+                                      const std::uint64_t *below, std::uint64_t *next, int first, int last,
+                                      unsigned birth, unsigned survival);
+
+    /**
+     * The rules with a kernel of their own, and the generic kernel for every other rule.
+     */
+    enum RuleKernel {
+        CONWAY,
+        HIGHLIFE,
+        SEEDS,
+        DAY_AND_NIGHT,
+        GENERIC,
+        RULE_KERNELS
+    };
+
+    /**
+     * Computes the next state of one row of count worlds stepped side by side, see Kernel::step_batch.
+     */
+    using BatchFunction = void (*)(const std::uint64_t *above, const std::uint64_t *row,
+                                   const std::uint64_t *below, std::uint64_t *next, int count, int stride,
+                                   int width, bool toroidal, unsigned birth, unsigned survival);
+
+    // Each variant returns nullptr if the compiler was not allowed to use that instruction set.
+    InteriorFunction avx2_interior(RuleKernel kernel);
+
+    InteriorFunction avx512_interior(RuleKernel kernel);
+
+    InteriorFunction neon_interior(RuleKernel kernel);
+
+    BatchFunction avx2_batch(RuleKernel kernel);
+
+    BatchFunction avx512_batch(RuleKernel kernel);
+
+    BatchFunction neon_batch(RuleKernel kernel);
+}
+
+namespace {
+
+    /**
+     * Plain 64 bit words, one word per lane. Every variant falls back to these for leftover words.
+     */
+    struct ScalarOps {
+        using Vector = std::uint64_t;
+        static constexpr int LANES = 1;
+
+        static Vector load(const std::uint64_t *p) { return *p; }
+
+        static void store(std::uint64_t *p, Vector v) { *p = v; }
+
+        static Vector west(Vector v, Vector previous) { return (v << 1) | (previous >> 63); }
+
+        static Vector east(Vector v, Vector next) { return (v >> 1) | (next << 63); }
+
+        static Vector xor3(Vector a, Vector b, Vector c) { return a ^ b ^ c; }
+
+        static Vector majority(Vector a, Vector b, Vector c) { return (a & b) | (c & (a ^ b)); }
+
+        static Vector bit_xor(Vector a, Vector b) { return a ^ b; }
+
+        static Vector bit_and(Vector a, Vector b) { return a & b; }
+
+        static Vector bit_or(Vector a, Vector b) { return a | b; }
+
+        static Vector and_not(Vector a, Vector b) { return ~a & b; }
+
+        static Vector bit_not(Vector a) { return ~a; }
+
+        static Vector shift_left(Vector a, int bits) { return a << bits; }
+
+        static Vector shift_right(Vector a, int bits) { return a >> bits; }
+
+        static Vector broadcast(std::uint64_t word) { return word; }
+    };
+
+    /**
+     * The neighbour count of every cell of a vector of words, as bit planes. Bit i of ones, twos, fours and
+     * eights together hold the count of cell i in binary.
+     */
+    template<class Ops>
+    struct Counts {
+        typename Ops::Vector ones, twos, fours, eights;
+    };
+
+    /**
+     * count<Ops, EIGHTS>(above_west, above, above_east, west, east, below_west, below, below_east)
+     *
+     * Count the alive neighbours of every cell of a vector of words at once.
+     * Bit i of each argument holds one neighbour of cell i, so the neighbour count of all the cells
+     * is built up in bit planes using full adders.
+     * The eights plane is only worked out if EIGHTS is set, otherwise a count of 8 reads as 0.
+     */
+    template<class Ops, bool EIGHTS>
+    inline Counts<Ops> count(typename Ops::Vector above_west, typename Ops::Vector above,
+                             typename Ops::Vector above_east, typename Ops::Vector west,
+                             typename Ops::Vector east, typename Ops::Vector below_west,
+                             typename Ops::Vector below, typename Ops::Vector below_east) {
+        // Sum the three cells above and the three below as 2 bit numbers, and the two beside as another
+        auto above_ones = Ops::xor3(above_west, above, above_east);
+        auto above_twos = Ops::majority(above_west, above, above_east);
+        auto below_ones = Ops::xor3(below_west, below, below_east);
+        auto below_twos = Ops::majority(below_west, below, below_east);
+        auto side_ones = Ops::bit_xor(west, east);
+        auto side_twos = Ops::bit_and(west, east);
+
+        // Add the three partial sums together into the ones, twos and fours bits of the neighbour count
+        Counts<Ops> counts;
+        counts.ones = Ops::xor3(above_ones, below_ones, side_ones);
+        auto carry = Ops::majority(above_ones, below_ones, side_ones);
+        auto pairs = Ops::xor3(above_twos, below_twos, side_twos);
+        auto fours = Ops::majority(above_twos, below_twos, side_twos);
+        auto twos_carry = Ops::bit_and(pairs, carry);
+        counts.twos = Ops::bit_xor(pairs, carry);
+        counts.fours = Ops::bit_xor(fours, twos_carry);
+        counts.eights = EIGHTS ? Ops::bit_and(fours, twos_carry) : Ops::bit_xor(fours, fours);
+        return counts;
+    }
+
+    /**
+     * equals<Ops, EIGHTS>(counts, n)
+     *
+     * Find the cells with exactly n alive neighbours.
+     * Without the eights plane a count of 8 reads as 0, so only counts 1 to 7 can be told apart.
+     */
+    template<class Ops, bool EIGHTS>
+    inline typename Ops::Vector equals(const Counts<Ops> &counts, int n) {
+        auto plane = [](typename Ops::Vector bits, bool set) { return set ? bits : Ops::bit_not(bits); };
+        auto low = Ops::bit_and(Ops::bit_and(plane(counts.ones, n & 1), plane(counts.twos, n & 2)),
+                                plane(counts.fours, n & 4));
+        return EIGHTS ? Ops::bit_and(low, plane(counts.eights, n & 8)) : low;
+    }
+
+    /**
+     * apply<Ops, EIGHTS>(counts, centre, birth, survival)
+     *
+     * Apply a rule given by masks of neighbour counts, a term at a time for each count the rule mentions.
+     * With constant masks the loop folds away into just the terms of that rule.
+     */
+    template<class Ops, bool EIGHTS>
+    inline typename Ops::Vector apply(const Counts<Ops> &counts, typename Ops::Vector centre,
+                                      unsigned birth, unsigned survival) {
+        auto next = Ops::bit_xor(centre, centre);
+        for (int n = 0; n <= 8; n++) {
+            const bool born = (birth >> n) & 1, survives = (survival >> n) & 1;
+            if (!born && !survives) continue;
+
+            auto matches = equals<Ops, EIGHTS>(counts, n);
+            if (!born) matches = Ops::bit_and(centre, matches);
+            else if (!survives) matches = Ops::and_not(centre, matches);
+            next = Ops::bit_or(next, matches);
+        }
+        return next;
+    }
+
+    /**
+     * The rule of Conway's Game of Life.
+     * Alive next step with exactly 3 neighbours, or with 2 neighbours if already alive.
+     * A count of 8 has all three bits clear so falls out as dead as well.
+     */
+    struct ConwayRule {
+        static constexpr bool EIGHTS = false;
+
+        template<class Ops>
+        static typename Ops::Vector next(const Counts<Ops> &counts, typename Ops::Vector centre, unsigned, unsigned) {
+            return Ops::bit_and(Ops::and_not(counts.fours, counts.twos), Ops::bit_or(counts.ones, centre));
+        }
+    };
+
+    /**
+     * A rule fixed at compile time by its masks of neighbour counts.
+     * The eights plane is only counted if the rule tells 0 and 8 neighbours apart.
+     */
+    template<unsigned BIRTH, unsigned SURVIVAL>
+    struct FixedRule {
+        static constexpr bool EIGHTS = ((BIRTH | SURVIVAL) & 0x101) != 0;
+
+        template<class Ops>
+        static typename Ops::Vector next(const Counts<Ops> &counts, typename Ops::Vector centre, unsigned, unsigned) {
+            return apply<Ops, EIGHTS>(counts, centre, BIRTH, SURVIVAL);
+        }
+    };
+
+    using HighLifeRule = FixedRule<1 << 3 | 1 << 6, 1 << 2 | 1 << 3>;
+    using SeedsRule = FixedRule<1 << 2, 0>;
+    using DayAndNightRule = FixedRule<1 << 3 | 1 << 6 | 1 << 7 | 1 << 8, 1 << 3 | 1 << 4 | 1 << 6 | 1 << 7 | 1 << 8>;
+
+    /**
+     * Any rule, read from its masks of neighbour counts as each vector is stepped.
+     */
+    struct GenericRule {
+        static constexpr bool EIGHTS = true;
+
+        template<class Ops>
+        static typename Ops::Vector next(const Counts<Ops> &counts, typename Ops::Vector centre,
+                                         unsigned birth, unsigned survival) {
+            return apply<Ops, EIGHTS>(counts, centre, birth, survival);
+        }
+    };
+
+    /**
+     * next_state<Ops, R>(above_west, above, above_east, west, centre, east, below_west, below, below_east,
+     *                    birth, survival)
+     *
+     * Apply rule R to every cell of a vector of words at once.
+     *
+     * @return
+     *      The next state of the cells in centre.
+     */
+    template<class Ops, class R>
+    inline typename Ops::Vector next_state(typename Ops::Vector above_west, typename Ops::Vector above,
+                                           typename Ops::Vector above_east, typename Ops::Vector west,
+                                           typename Ops::Vector centre, typename Ops::Vector east,
+                                           typename Ops::Vector below_west, typename Ops::Vector below,
+                                           typename Ops::Vector below_east, unsigned birth, unsigned survival) {
+        return R::template next<Ops>(count<Ops, R::EIGHTS>(above_west, above, above_east, west, east,
+                                                            below_west, below, below_east),
+                                     centre, birth, survival);
+    }
+
+    /**
+     * step_at<Ops, R>(above, row, below, next, index, birth, survival)
+     *
+     * Compute the vector of words starting at index, reading the neighbouring words either side.
+     */
+    template<class Ops, class R>
+    inline void step_at(const std::uint64_t *above, const std::uint64_t *row, const std::uint64_t *below,
+                        std::uint64_t *next, int index, unsigned birth, unsigned survival) {
+        auto a = Ops::load(above + index), c = Ops::load(row + index), b = Ops::load(below + index);
+        Ops::store(next + index, next_state<Ops, R>(
+                Ops::west(a, Ops::load(above + index - 1)), a, Ops::east(a, Ops::load(above + index + 1)),
+                Ops::west(c, Ops::load(row + index - 1)), c, Ops::east(c, Ops::load(row + index + 1)),
+                Ops::west(b, Ops::load(below + index - 1)), b, Ops::east(b, Ops::load(below + index + 1)),
+                birth, survival));
+    }
+
+    /**
+     * interior<Ops, R>(above, row, below, next, first, last, birth, survival)
+     *
+     * Compute words [first, last) of a row a whole vector at a time, then finish any leftover words singly.
+     */
+    template<class Ops, class R>
+    void interior(const std::uint64_t *above, const std::uint64_t *row, const std::uint64_t *below,
+                  std::uint64_t *next, int first, int last, unsigned birth, unsigned survival) {
+        int i = first;
+        for (; i + Ops::LANES <= last; i += Ops::LANES) {
+            step_at<Ops, R>(above, row, below, next, i, birth, survival);
+        }
+        for (; i < last; i++) {
+            step_at<ScalarOps, R>(above, row, below, next, i, birth, survival);
+        }
+    }
+
+    /**
+     * interior_for<Ops>(kernel)
+     *
+     * Pick the interior function of an instruction set for one of the rule kernels.
+     */
+    template<class Ops>
+    Kernel::InteriorFunction interior_for(Kernel::RuleKernel kernel) {
+        switch (kernel) {
+            case Kernel::CONWAY:
+                return &interior<Ops, ConwayRule>;
+            case Kernel::HIGHLIFE:
+                return &interior<Ops, HighLifeRule>;
+            case Kernel::SEEDS:
+                return &interior<Ops, SeedsRule>;
+            case Kernel::DAY_AND_NIGHT:
+                return &interior<Ops, DayAndNightRule>;
+            default:
+                return &interior<Ops, GenericRule>;
+        }
+    }
+
+    /**
+     * batch_at<Ops, R>(above, row, below, next, index, stride, width, toroidal, birth, survival)
+     *
+     * Compute one row of the vector of worlds starting at world index. Word w of world i of a row is
+     * at w * stride + i, so each lane of a vector holds the same word of a different world.
+     * The neighbours past the ends of each world's row are dead, or wrap around if toroidal.
+     */
+    template<class Ops, class R>
+    inline void batch_at(const std::uint64_t *above, const std::uint64_t *row, const std::uint64_t *below,
+                         std::uint64_t *next, int index, int stride, int width, bool toroidal,
+                         unsigned birth, unsigned survival) {
+        const int words = (width + 63) / 64, last_bit = (width - 1) % 64;
+        const std::uint64_t *lines[3] = {above + index, row + index, below + index};
+
+        for (int word = 0; word < words; word++) {
+            typename Ops::Vector west[3], centre[3], east[3];
+            for (int line = 0; line < 3; line++) {
+                const std::uint64_t *words_of = lines[line];
+                auto v = Ops::load(words_of + word * stride);
+                centre[line] = v;
+
+                // The cell west of the first cell of the row is the last cell, and east of the last is the first
+                if (word > 0) {
+                    west[line] = Ops::west(v, Ops::load(words_of + (word - 1) * stride));
+                } else if (toroidal) {
+                    auto last = Ops::load(words_of + (words - 1) * stride);
+                    west[line] = Ops::bit_or(Ops::shift_left(v, 1),
+                                             Ops::shift_right(Ops::shift_left(last, 63 - last_bit), 63));
+                } else {
+                    west[line] = Ops::shift_left(v, 1);
+                }
+
+                if (word < words - 1) {
+                    east[line] = Ops::east(v, Ops::load(words_of + (word + 1) * stride));
+                } else if (toroidal) {
+                    auto first = Ops::load(words_of);
+                    east[line] = Ops::bit_or(Ops::shift_right(v, 1),
+                                             Ops::shift_right(Ops::shift_left(first, 63), 63 - last_bit));
+                } else {
+                    east[line] = Ops::shift_right(v, 1);
+                }
+            }
+
+            auto result = next_state<Ops, R>(west[0], centre[0], east[0], west[1], centre[1], east[1],
+                                             west[2], centre[2], east[2], birth, survival);
+
+            // The last word shifts live cells into its padding, which must stay clear
+            if (word == words - 1 && last_bit != 63) {
+                result = Ops::bit_and(result, Ops::broadcast((std::uint64_t(1) << (last_bit + 1)) - 1));
+            }
+            Ops::store(next + index + word * stride, result);
+        }
+    }
+
+    /**
+     * batch<Ops, R>(above, row, below, next, count, stride, width, toroidal, birth, survival)
+     *
+     * Compute one row of count worlds a whole vector of worlds at a time, then finish any leftover worlds singly.
+     */
+    template<class Ops, class R>
+    void batch(const std::uint64_t *above, const std::uint64_t *row, const std::uint64_t *below,
+               std::uint64_t *next, int count, int stride, int width, bool toroidal,
+               unsigned birth, unsigned survival) {
+        int i = 0;
+        for (; i + Ops::LANES <= count; i += Ops::LANES) {
+            batch_at<Ops, R>(above, row, below, next, i, stride, width, toroidal, birth, survival);
+        }
+        for (; i < count; i++) {
+            batch_at<ScalarOps, R>(above, row, below, next, i, stride, width, toroidal, birth, survival);
+        }
+    }
+
+    /**
+     * batch_for<Ops>(kernel)
+     *
+     * Pick the batch function of an instruction set for one of the rule kernels.
+     */
+    template<class Ops>
+    Kernel::BatchFunction batch_for(Kernel::RuleKernel kernel) {
+        switch (kernel) {
+            case Kernel::CONWAY:
+                return &batch<Ops, ConwayRule>;
+            case Kernel::HIGHLIFE:
+                return &batch<Ops, HighLifeRule>;
+            case Kernel::SEEDS:
+                return &batch<Ops, SeedsRule>;
+            case Kernel::DAY_AND_NIGHT:
+                return &batch<Ops, DayAndNightRule>;
+            default:
+                return &batch<Ops, GenericRule>;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * Implements the NEON variant of the Kernel namespace, updating 2 words (128 cells) per instruction.
+ * NEON is part of the base ARMv8 instruction set, so no extra compiler flags are needed to build it.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "kernel_impl.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+
+namespace {
+    struct NeonOps {
+        using Vector = uint64x2_t;
+        static constexpr int LANES = 2;
+
+        static Vector load(const std::uint64_t *p) { return vld1q_u64(p); }
+
+        static void store(std::uint64_t *p, Vector v) { vst1q_u64(p, v); }
+
+        static Vector west(Vector v, Vector previous) { return vorrq_u64(vshlq_n_u64(v, 1), vshrq_n_u64(previous, 63)); }
+
+        static Vector east(Vector v, Vector next) { return vorrq_u64(vshrq_n_u64(v, 1), vshlq_n_u64(next, 63)); }
+
+        static Vector xor3(Vector a, Vector b, Vector c) { return veorq_u64(veorq_u64(a, b), c); }
+
+        // Take the bits of c where a and b differ, otherwise a (which then equals b)
+        static Vector majority(Vector a, Vector b, Vector c) { return vbslq_u64(veorq_u64(a, b), c, a); }
+
+        static Vector bit_xor(Vector a, Vector b) { return veorq_u64(a, b); }
+
+        static Vector bit_and(Vector a, Vector b) { return vandq_u64(a, b); }
+
+        static Vector bit_or(Vector a, Vector b) { return vorrq_u64(a, b); }
+
+        // vbicq computes first & ~second
+        static Vector and_not(Vector a, Vector b) { return vbicq_u64(b, a); }
+
+        static Vector bit_not(Vector a) { return vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(a))); }
+
+        // vshlq shifts right for negative counts
+        static Vector shift_left(Vector a, int bits) { return vshlq_u64(a, vdupq_n_s64(bits)); }
+
+        static Vector shift_right(Vector a, int bits) { return vshlq_u64(a, vdupq_n_s64(-bits)); }
+
+        static Vector broadcast(std::uint64_t word) { return vdupq_n_u64(word); }
+    };
+}
+
+Kernel::InteriorFunction Kernel::neon_interior(RuleKernel kernel) {
+    return interior_for<NeonOps>(kernel);
+}
+
+Kernel::BatchFunction Kernel::neon_batch(RuleKernel kernel) {
+    return batch_for<NeonOps>(kernel);
+}
+
+#else
+
+Kernel::InteriorFunction Kernel::neon_interior(RuleKernel) {
+    return nullptr;
+}
+
+Kernel::BatchFunction Kernel::neon_batch(RuleKernel) {
+    return nullptr;
+}
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * Implements a class giving read only access to the bytes of a file mapped into memory.
+ *      - On POSIX systems the file is mapped with mmap, so pages are read in from disk as they are touched
+ *        and nothing is copied into the process.
+ *      - Elsewhere the file is read into a buffer in one go.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "mapped_file.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GOL_HAVE_MMAP 1
+#else
+#include <fstream>
+#endif
+
+/**
+ * MappedFile::MappedFile(path)
+ *
+ * Map the whole of a file into memory for reading.
+ *
+ * @example
+ *
+ *      // Map a file and read its first byte
+ *      MappedFile file("path/to/file.bgol");
+ *      if (file.size() > 0) std::cout << int(file.data()[0]) << std::endl;
+ *
+ * @param path
+ *      The std::string path to the file to map.
+ *
+ * @throws
+ *      std::runtime_error if the file cannot be opened or mapped.
+ */
+MappedFile::MappedFile(const std::string &path) : _data(nullptr), _size(0) {
+#ifdef GOL_HAVE_MMAP
+    const int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("File failed to open");
+    }
+
+    struct stat status{};
+    if (::fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode)) {
+        ::close(descriptor);
+        throw std::runtime_error("File failed to open");
+    }
+
+    _size = std::size_t(status.st_size);
+    if (_size > 0) {
+        void *mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(descriptor);
+            throw std::runtime_error("File failed to map");
+        }
+
+        // Files are read front to back, so let the kernel read ahead aggressively
+        ::madvise(mapping, _size, MADV_SEQUENTIAL);
+        _data = static_cast<const unsigned char *>(mapping);
+    }
+
+    // The mapping keeps the file alive on its own
+    ::close(descriptor);
+#else
+    std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("File failed to open");
+    }
+
+    _buffer.resize(std::size_t(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(_buffer.data()), std::streamsize(_buffer.size()));
+    if (!file) {
+        throw std::runtime_error("File failed to read");
+    }
+
+    _data = _buffer.data();
+    _size = _buffer.size();
+#endif
+}
+
+/**
+ * MappedFile::MappedFile(other)
+ *
+ * Move a mapping into a new MappedFile, leaving the other empty.
+ */
+MappedFile::MappedFile(MappedFile &&other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)),
+          _buffer(std::move(other._buffer)) {}
+
+/**
+ * MappedFile::operator=(other)
+ *
+ * Move a mapping into this MappedFile, unmapping whatever it held before.
+ */
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+        std::swap(_data, other._data);
+        std::swap(_size, other._size);
+        std::swap(_buffer, other._buffer);
+    }
+    return *this;
+}
+
+/**
+ * MappedFile::~MappedFile()
+ *
+ * Unmap the file.
+ */
+MappedFile::~MappedFile() {
+#ifdef GOL_HAVE_MMAP
+    if (_data) ::munmap(const_cast<unsigned char *>(_data), _size);
+#endif
+}
+
+/**
+ * MappedFile::data()
+ *
+ * Gets the bytes of the file.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A pointer to the first of size() bytes, or nullptr if the file is empty.
+ */
+const unsigned char *MappedFile::data() const {
+    return _data;
+}
+
+/**
+ * MappedFile::size()
+ *
+ * Gets the size of the file in bytes.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of bytes in the file.
+ */
+std::size_t MappedFile::size() const {
+    return _size;
+}
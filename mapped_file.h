@@ -0,0 +1,43 @@
+/**
+ * Declares a class giving read only access to the bytes of a file mapped into memory.
+ * Rich documentation for the api and behaviour the MappedFile class can be found in mapped_file.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Declare the structure of the MappedFile class for reading whole files without copying them.
+ *
+ * A MappedFile owns its mapping and unmaps it when destroyed, so it can be moved but not copied.
+ */
+class MappedFile {
+private:
+    const unsigned char *_data;
+    std::size_t _size;
+    std::vector<unsigned char> _buffer;
+
+public:
+    explicit MappedFile(const std::string &path);
+
+    MappedFile(const MappedFile &other) = delete;
+
+    MappedFile &operator=(const MappedFile &other) = delete;
+
+    MappedFile(MappedFile &&other) noexcept;
+
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    ~MappedFile();
+
+    const unsigned char *data() const;
+
+    std::size_t size() const;
+};
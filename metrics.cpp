@@ -0,0 +1,139 @@
+/**
+ * Implements a class for collecting per step metrics from a World and exporting them.
+ *      - Each step records the time it took, how many cells it computed and changed, how many tiles
+ *        were active and the population it left behind, see World::set_metrics(metrics).
+ *
+ *      - Steps can be exported as JSON lines, one object per step written as it is recorded.
+ *          - {"generation":1,"step_ns":1200,"cells_processed":4096,"cells_changed":8,"active_tiles":1,"population":5}
+ *
+ *      - Steps can be exported as Prometheus style metrics, totalled over the run and written by flush.
+ *          - https://prometheus.io/docs/instrumenting/exposition_formats/
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "metrics.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+
+/**
+ * write_metric(out, name, type, help, value)
+ *
+ * Private helper function to write one metric in the Prometheus text format.
+ */
+template<typename T>
+static void write_metric(std::ostream &out, const char *name, const char *type, const char *help, T value) {
+    out << "# HELP " << name << " " << help << "\n"
+        << "# TYPE " << name << " " << type << "\n"
+        << name << " " << value << "\n";
+}
+
+/**
+ * Metrics::Metrics(out, format)
+ *
+ * Construct a metrics recorder writing to a stream in a format. The stream must outlive the recorder.
+ *
+ * @example
+ *
+ *      // Write a JSON line for every step of a world to the console
+ *      Metrics metrics(std::cout, Metrics::Format::JsonLines);
+ *      world.set_metrics(&metrics);
+ *      world.advance(100);
+ *
+ * @param out
+ *      The stream to write the metrics to.
+ *
+ * @param format
+ *      The format to write the metrics in.
+ */
+Metrics::Metrics(std::ostream &out, Format format)
+        : _out(out), _format(format), _last(), _steps(0), _nanoseconds(0), _max_nanoseconds(0), _cells_processed(0),
+          _cells_changed(0) {}
+
+/**
+ * Metrics::get_format()
+ *
+ * Gets the format the metrics are written in.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The format.
+ */
+Metrics::Format Metrics::get_format() const {
+    return _format;
+}
+
+/**
+ * Metrics::get_steps()
+ *
+ * Gets the number of steps recorded so far.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of steps.
+ */
+std::uint64_t Metrics::get_steps() const {
+    return _steps;
+}
+
+/**
+ * Metrics::get_last()
+ *
+ * Gets the measurements of the last step recorded.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A reference to the last step's measurements, all zero if nothing has been recorded.
+ */
+const StepStats &Metrics::get_last() const {
+    return _last;
+}
+
+/**
+ * Metrics::record(stats)
+ *
+ * Record the measurements of a step, adding them to the totals and writing a JSON line if that is the format.
+ *
+ * @param stats
+ *      The measurements of the step.
+ */
+void Metrics::record(const StepStats &stats) {
+    _last = stats;
+    _steps++;
+    _nanoseconds += stats.nanoseconds;
+    _max_nanoseconds = std::max(_max_nanoseconds, stats.nanoseconds);
+    _cells_processed += stats.cells_processed;
+    _cells_changed += stats.cells_changed;
+
+    if (_format == Format::JsonLines) {
+        _out << "{\"generation\":" << stats.generation
+             << ",\"step_ns\":" << stats.nanoseconds
+             << ",\"cells_processed\":" << stats.cells_processed
+             << ",\"cells_changed\":" << stats.cells_changed
+             << ",\"active_tiles\":" << stats.active_tiles
+             << ",\"population\":" << stats.population << "}\n";
+    }
+}
+
+/**
+ * Metrics::flush()
+ *
+ * Write out the totals if that is the format, and flush the stream.
+ * Counters cover every step recorded, gauges hold the values left by the last step.
+ */
+void Metrics::flush() {
+    if (_format == Format::Prometheus) {
+        write_metric(_out, "gol_steps_total", "counter", "Steps recorded.", _steps);
+        write_metric(_out, "gol_step_seconds_total", "counter", "Time spent stepping.", double(_nanoseconds) * 1e-9);
+        write_metric(_out, "gol_step_seconds_max", "gauge", "Time taken by the slowest step.",
+                     double(_max_nanoseconds) * 1e-9);
+        write_metric(_out, "gol_cells_processed_total", "counter", "Cells computed by the steps.", _cells_processed);
+        write_metric(_out, "gol_cells_changed_total", "counter", "Cells changed by the steps.", _cells_changed);
+        write_metric(_out, "gol_active_tiles", "gauge", "Tiles computed by the last step.", _last.active_tiles);
+        write_metric(_out, "gol_population", "gauge", "Alive cells after the last step.", _last.population);
+        write_metric(_out, "gol_generation", "gauge", "Generation reached by the last step.", _last.generation);
+    }
+    _out.flush();
+}
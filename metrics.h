@@ -0,0 +1,59 @@
+/**
+ * Declares a class for collecting per step metrics from a World and exporting them.
+ * Rich documentation for the api and behaviour the Metrics class can be found in metrics.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include <cstdint>
+#include <ostream>
+
+/**
+ * The measurements of a single step of a World.
+ */
+struct StepStats {
+    std::uint64_t generation;
+    std::uint64_t nanoseconds;
+    std::uint64_t cells_processed;
+    std::uint64_t cells_changed;
+    int active_tiles;
+    int population;
+};
+
+/**
+ * Declare the structure of the Metrics class for recording the steps of a world to a stream.
+ *
+ * A World only measures its steps once it has been given a Metrics to record them in.
+ *      - JSON lines are written as each step is recorded, one object per step.
+ *      - Prometheus counters are totalled as steps are recorded, and written out by flush.
+ */
+class Metrics {
+public:
+    enum class Format {
+        JsonLines,
+        Prometheus
+    };
+
+private:
+    std::ostream &_out;
+    Format _format;
+    StepStats _last;
+    std::uint64_t _steps, _nanoseconds, _max_nanoseconds, _cells_processed, _cells_changed;
+
+public:
+    Metrics(std::ostream &out, Format format);
+
+    Format get_format() const;
+
+    std::uint64_t get_steps() const;
+
+    const StepStats &get_last() const;
+
+    void record(const StepStats &stats);
+
+    void flush();
+};
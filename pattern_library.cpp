@@ -0,0 +1,309 @@
+/**
+ * Implements a class holding a library of patterns, each packed in all eight of its orientations.
+ *      - Building a scenario places the same few creatures thousands of times, turned and mirrored.
+ *        Building each from cell sets and rotating it per copy costs far more than placing it.
+ *
+ *      - Each pattern is turned and mirrored once when it is added, and kept as eight packed grids.
+ *          - The Zoo creatures are added up front, under the names glider, r_pentomino and light_weight_spaceship.
+ *          - A directory of pattern files can be added in one go, each named after its file.
+ *
+ *      - Placing a pattern stamps its packed rows into a grid with Grid::merge, a word at a time.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "pattern_library.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include "zoo.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+/**
+ * mirror(pattern)
+ *
+ * Private helper function to reflect a pattern left to right.
+ * A half turn reflects both ways, so its rows are copied back in reverse order to undo the top to bottom part.
+ */
+static Grid mirror(const Grid &pattern) {
+    const Grid turned = pattern.rotate(2);
+    Grid mirrored(pattern.get_width(), pattern.get_height());
+    for (int y = 0; y < pattern.get_height(); y++) {
+        mirrored.copy_rect(turned, 0, y, turned.get_width(), y + 1, 0, pattern.get_height() - 1 - y);
+    }
+
+    return mirrored;
+}
+
+/**
+ * PatternLibrary::PatternLibrary()
+ *
+ * Construct a library holding the creatures of the Zoo.
+ *
+ * @example
+ *
+ *      // Place a glider flying down and to the left, a quarter turn from its usual heading
+ *      PatternLibrary library;
+ *      const int glider = library.find("glider");
+ *      library.stamp(grid, glider, 1, 10, 10);
+ */
+PatternLibrary::PatternLibrary() {
+    add("glider", Zoo::glider());
+    add("r_pentomino", Zoo::r_pentomino());
+    add("light_weight_spaceship", Zoo::light_weight_spaceship());
+}
+
+/**
+ * PatternLibrary::add(name, pattern)
+ *
+ * Add a pattern to the library, turning and mirroring it into each of its eight orientations.
+ * A pattern already in the library under the same name is replaced, keeping its index.
+ *
+ * @param name
+ *      The name to look the pattern up by.
+ *
+ * @param pattern
+ *      The pattern in its first orientation.
+ *
+ * @return
+ *      The index to place the pattern by.
+ */
+int PatternLibrary::add(const std::string &name, const Grid &pattern) {
+    std::array<Grid, ORIENTATIONS> orientations;
+    const Grid mirrored = mirror(pattern);
+    for (int turns = 0; turns < 4; turns++) {
+        orientations[turns] = pattern.rotate(turns);
+        orientations[4 + turns] = mirrored.rotate(turns);
+    }
+
+    const auto found = _indices.find(name);
+    if (found != _indices.end()) {
+        _patterns[found->second] = std::move(orientations);
+        return found->second;
+    }
+
+    _patterns.push_back(std::move(orientations));
+    _names.push_back(name);
+    _indices.emplace(name, int(_patterns.size()) - 1);
+    return int(_patterns.size()) - 1;
+}
+
+/**
+ * PatternLibrary::load_directory(path)
+ *
+ * Add every pattern file in a directory to the library, named after the file without its extension.
+ *      - .gol, .bgol, .rle and .cgol files are loaded with Zoo::load, anything else is skipped.
+ *      - Files are added in order of name, so the indices they get do not depend on the file system.
+ *
+ * @example
+ *
+ *      // Add patterns/glider_gun.rle to the library as glider_gun
+ *      PatternLibrary library;
+ *      library.load_directory("patterns");
+ *      const Grid &gun = library.get("glider_gun");
+ *
+ * @param path
+ *      The std::string path to the directory to read the patterns from.
+ *
+ * @return
+ *      The number of patterns added.
+ *
+ * @throws
+ *      std::runtime_error if the directory cannot be read, or a pattern file in it cannot be loaded.
+ */
+int PatternLibrary::load_directory(const std::string &path) {
+    std::vector<std::filesystem::path> files;
+    try {
+        for (const auto &entry : std::filesystem::directory_iterator(path)) {
+            const std::string extension = entry.path().extension().string();
+            if (entry.is_regular_file() &&
+                (extension == ".gol" || extension == ".bgol" || extension == ".rle" || extension == ".cgol")) {
+                files.push_back(entry.path());
+            }
+        }
+    } catch (const std::filesystem::filesystem_error &) {
+        throw std::runtime_error("The pattern directory " + path + " could not be read");
+    }
+    std::sort(files.begin(), files.end());
+
+    for (const auto &file : files) {
+        try {
+            add(file.stem().string(), Zoo::load(file.string()));
+        } catch (const std::exception &error) {
+            throw std::runtime_error("The pattern " + file.string() + " could not be loaded: " + error.what());
+        }
+    }
+
+    return int(files.size());
+}
+
+/**
+ * PatternLibrary::size()
+ *
+ * Gets the number of patterns in the library.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of patterns, one more than the largest index.
+ */
+int PatternLibrary::size() const {
+    return int(_patterns.size());
+}
+
+/**
+ * PatternLibrary::contains(name)
+ *
+ * Gets whether the library holds a pattern of the given name.
+ * The function should be callable from a constant context.
+ *
+ * @param name
+ *      The name of the pattern.
+ *
+ * @return
+ *      True if the pattern can be found.
+ */
+bool PatternLibrary::contains(const std::string &name) const {
+    return _indices.count(name) != 0;
+}
+
+/**
+ * PatternLibrary::find(name)
+ *
+ * Gets the index of a pattern, to place it by without looking up its name each time.
+ * The function should be callable from a constant context.
+ *
+ * @param name
+ *      The name of the pattern.
+ *
+ * @return
+ *      The index of the pattern.
+ *
+ * @throws
+ *      std::runtime_error if the library holds no pattern of the name.
+ */
+int PatternLibrary::find(const std::string &name) const {
+    const auto found = _indices.find(name);
+    if (found == _indices.end()) {
+        throw std::runtime_error("There is no pattern named " + name);
+    }
+
+    return found->second;
+}
+
+/**
+ * PatternLibrary::get_name(pattern)
+ *
+ * Gets the name of a pattern.
+ * The function should be callable from a constant context.
+ *
+ * @param pattern
+ *      The index of the pattern.
+ *
+ * @return
+ *      The name the pattern was added under.
+ *
+ * @throws
+ *      std::runtime_error if the index is not of a pattern in the library.
+ */
+const std::string &PatternLibrary::get_name(int pattern) const {
+    if (pattern < 0 || pattern >= size()) {
+        throw std::runtime_error("There is no pattern " + std::to_string(pattern));
+    }
+
+    return _names[pattern];
+}
+
+/**
+ * PatternLibrary::get(pattern, orientation)
+ *
+ * Gets a pattern in one of its orientations.
+ * The function should be callable from a constant context.
+ *
+ * @param pattern
+ *      The index of the pattern.
+ *
+ * @param orientation
+ *      Optional parameter. The orientation, from 0 to 7. Defaults to 0, the pattern as it was added.
+ *
+ * @return
+ *      A reference to the packed pattern, valid until the library is changed.
+ *
+ * @throws
+ *      std::runtime_error if the index is not of a pattern in the library, or the orientation is not 0 to 7.
+ */
+const Grid &PatternLibrary::get(int pattern, int orientation) const {
+    if (pattern < 0 || pattern >= size()) {
+        throw std::runtime_error("There is no pattern " + std::to_string(pattern));
+    }
+    if (orientation < 0 || orientation >= ORIENTATIONS) {
+        throw std::runtime_error("The orientation must be between 0 and 7");
+    }
+
+    return _patterns[pattern][orientation];
+}
+
+/**
+ * PatternLibrary::get(name, orientation)
+ *
+ * Gets a pattern in one of its orientations by name.
+ * The function should be callable from a constant context.
+ *
+ * @param name
+ *      The name of the pattern.
+ *
+ * @param orientation
+ *      Optional parameter. The orientation, from 0 to 7. Defaults to 0, the pattern as it was added.
+ *
+ * @return
+ *      A reference to the packed pattern, valid until the library is changed.
+ *
+ * @throws
+ *      std::runtime_error if the library holds no pattern of the name, or the orientation is not 0 to 7.
+ */
+const Grid &PatternLibrary::get(const std::string &name, int orientation) const {
+    return get(find(name), orientation);
+}
+
+/**
+ * PatternLibrary::stamp(grid, pattern, orientation, x, y, alive_only)
+ *
+ * Place a pattern in one of its orientations into a grid, with its upper left corner at (x, y).
+ *
+ * @example
+ *
+ *      // Fill a board with gliders in every orientation
+ *      PatternLibrary library;
+ *      const int glider = library.find("glider");
+ *      for (int i = 0; i < 1000; i++) {
+ *          library.stamp(board, glider, i % PatternLibrary::ORIENTATIONS, (i % 40) * 8, (i / 40) * 8);
+ *      }
+ *
+ * @param grid
+ *      The grid to place the pattern into.
+ *
+ * @param pattern
+ *      The index of the pattern.
+ *
+ * @param orientation
+ *      The orientation, from 0 to 7.
+ *
+ * @param x
+ *      The x coordinate of where to place the upper left corner of the pattern.
+ *
+ * @param y
+ *      The y coordinate of where to place the upper left corner of the pattern.
+ *
+ * @param alive_only
+ *      Optional parameter. If true then only the alive cells of the pattern are placed, keeping the cells
+ *      around them. If false the dead cells of its bounding box are placed too. Defaults to true.
+ *
+ * @throws
+ *      std::runtime_error if the pattern or orientation is unknown.
+ *      std::exception or sub-class if the pattern does not fit within the grid at (x, y).
+ */
+void PatternLibrary::stamp(Grid &grid, int pattern, int orientation, int x, int y, bool alive_only) const {
+    grid.merge(get(pattern, orientation), x, y, alive_only);
+}
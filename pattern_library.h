@@ -0,0 +1,55 @@
+/**
+ * Declares a class holding a library of patterns, each packed in all eight of its orientations.
+ * Rich documentation for the api and behaviour the PatternLibrary class can be found in pattern_library.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Declare the structure of the PatternLibrary class for placing many copies of patterns into grids.
+ *
+ * Patterns are looked up by name once, then placed by index, so placing them never hashes a string.
+ *      - Orientations 0 to 3 are the pattern turned by that many quarter turns clockwise.
+ *      - Orientations 4 to 7 are the same for its mirror image, reflected left to right.
+ */
+class PatternLibrary {
+public:
+    static const int ORIENTATIONS = 8;
+
+private:
+    std::vector<std::array<Grid, ORIENTATIONS>> _patterns;
+    std::vector<std::string> _names;
+    std::unordered_map<std::string, int> _indices;
+
+public:
+    PatternLibrary();
+
+    int add(const std::string &name, const Grid &pattern);
+
+    int load_directory(const std::string &path);
+
+    int size() const;
+
+    bool contains(const std::string &name) const;
+
+    int find(const std::string &name) const;
+
+    const std::string &get_name(int pattern) const;
+
+    const Grid &get(int pattern, int orientation = 0) const;
+
+    const Grid &get(const std::string &name, int orientation = 0) const;
+
+    void stamp(Grid &grid, int pattern, int orientation, int x, int y, bool alive_only = true) const;
+};
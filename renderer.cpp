@@ -0,0 +1,359 @@
+/**
+ * Implements a class for drawing a running simulation to the console on a background thread.
+ *      - The simulation hands over a copy of its grid and carries on stepping straight away.
+ *          - Frames the console cannot keep up with are dropped, the latest frame always wins.
+ *          - Frames can be limited to a number per second, the ones in between are dropped too.
+ *
+ *      - Each frame is built in memory and written to the stream in a single write, then flushed once.
+ *
+ *      - Only a viewport of the grid is drawn, the whole grid by default.
+ *          - A viewport bigger than the console is shrunk by the same factor in each direction,
+ *            each character standing for a square block of cells that is drawn # (hash) if any of them is alive.
+ *
+ *      - Errors on the drawing thread are kept and thrown from the next call to submit or wait.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "renderer.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/ioctl.h>
+#include <unistd.h>
+#define GOL_HAVE_TERMINAL 1
+#endif
+
+/**
+ * any_alive(words, first, last)
+ *
+ * Private helper function to check if any of the bits [first, last) of a packed row are set.
+ */
+static bool any_alive(const Grid::Word *words, int first, int last) {
+    const Grid::Word all = ~Grid::Word(0);
+    const int first_word = first / Grid::WORD_BITS, last_word = (last - 1) / Grid::WORD_BITS;
+    const Grid::Word first_mask = all << (first % Grid::WORD_BITS);
+    const Grid::Word last_mask = all >> (Grid::WORD_BITS - 1 - (last - 1) % Grid::WORD_BITS);
+
+    if (first_word == last_word) return (words[first_word] & first_mask & last_mask) != 0;
+    if (words[first_word] & first_mask) return true;
+    for (int word = first_word + 1; word < last_word; word++) {
+        if (words[word]) return true;
+    }
+    return (words[last_word] & last_mask) != 0;
+}
+
+/**
+ * Renderer::Renderer(out, columns, rows, fps)
+ *
+ * Construct a renderer and start its drawing thread.
+ *
+ * @example
+ *
+ *      // Draw a world to the console at most 30 times a second as it runs
+ *      Renderer renderer(std::cout, 0, 0, 30);
+ *      for (int step = 1; step <= steps; step++) {
+ *          world.step();
+ *          renderer.submit(world.get_state(), "Step " + std::to_string(step));
+ *      }
+ *      renderer.wait();
+ *
+ * @param out
+ *      The stream to draw to, which must outlive the renderer.
+ *
+ * @param columns
+ *      Optional parameter. The most characters a row of the grid may take up, 0 for no limit.
+ *
+ * @param rows
+ *      Optional parameter. The most rows the grid may take up, 0 for no limit.
+ *
+ * @param fps
+ *      Optional parameter. The most frames to draw a second, 0 for no limit.
+ */
+Renderer::Renderer(std::ostream &out, int columns, int rows, int fps)
+        : _out(out), _columns(std::max(columns, 0)), _rows(std::max(rows, 0)), _view_x(0), _view_y(0), _view_width(0),
+          _view_height(0), _interval(fps > 0 ? std::chrono::steady_clock::duration(std::chrono::seconds(1)) / fps
+                                             : std::chrono::steady_clock::duration::zero()),
+          _has_pending(false), _busy(false), _stopping(false), _waiting(0), _dropped(0) {
+    _drawer = std::thread(&Renderer::work, this);
+}
+
+/**
+ * Renderer::~Renderer()
+ *
+ * Draw the latest frame, then stop the drawing thread. Errors are dropped, call wait first to see them.
+ */
+Renderer::~Renderer() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wake.notify_one();
+    _drawer.join();
+}
+
+/**
+ * Renderer::set_viewport(x, y, width, height)
+ *
+ * Choose the part of the grid to draw, clipped to the grid of each frame.
+ *
+ * @param x
+ *      The x coordinate of the top left cell of the viewport.
+ *
+ * @param y
+ *      The y coordinate of the top left cell of the viewport.
+ *
+ * @param width
+ *      The width of the viewport, 0 or less to reach the right edge of the grid.
+ *
+ * @param height
+ *      The height of the viewport, 0 or less to reach the bottom edge of the grid.
+ */
+void Renderer::set_viewport(int x, int y, int width, int height) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _view_x = std::max(x, 0);
+    _view_y = std::max(y, 0);
+    _view_width = std::max(width, 0);
+    _view_height = std::max(height, 0);
+}
+
+/**
+ * Renderer::submit(grid, title)
+ *
+ * Hand a frame to the drawing thread, and return straight away.
+ * The grid is copied into the pending buffer, replacing any frame the drawing thread has not started on yet.
+ *
+ * @param grid
+ *      The grid to draw.
+ *
+ * @param title
+ *      A line to print above the grid.
+ *
+ * @throws
+ *      Rethrows the exception from the last failed write, if there was one since it was last thrown.
+ */
+void Renderer::submit(const Grid &grid, const std::string &title) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_error) std::rethrow_exception(std::exchange(_error, nullptr));
+
+        if (_has_pending) _dropped++;
+        _pending = grid;
+        _pending_title = title;
+        _has_pending = true;
+    }
+    _wake.notify_one();
+}
+
+/**
+ * Renderer::wait()
+ *
+ * Block until the latest frame has been drawn, without waiting out the frame rate limit.
+ *
+ * @throws
+ *      Rethrows the exception from the last failed write, if there was one since it was last thrown.
+ */
+void Renderer::wait() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _waiting++;
+    _wake.notify_one();
+    _idle.wait(lock, [this] { return !_has_pending && !_busy; });
+    _waiting--;
+
+    if (_error) std::rethrow_exception(std::exchange(_error, nullptr));
+}
+
+/**
+ * Renderer::get_dropped_frames()
+ *
+ * Gets the number of frames replaced by a newer one before they could be drawn.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of dropped frames.
+ */
+std::uint64_t Renderer::get_dropped_frames() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _dropped;
+}
+
+/**
+ * Renderer::work()
+ *
+ * Private helper function run by the drawing thread, drawing the latest frame once the frame rate allows it.
+ */
+void Renderer::work() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _wake.wait(lock, [this] { return _has_pending || _stopping; });
+        if (!_has_pending) return;
+
+        // Hold off until the next frame is due, letting newer frames replace this one in the meantime
+        if (_interval > std::chrono::steady_clock::duration::zero()) {
+            _wake.wait_until(lock, _next_frame, [this] { return _stopping || _waiting > 0; });
+        }
+
+        // Take the frame, leaving the old buffer for the next one to be copied into
+        std::swap(_pending, _drawing);
+        std::swap(_pending_title, _drawing_title);
+        _has_pending = false;
+        _busy = true;
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+            draw();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        _next_frame = std::chrono::steady_clock::now() + _interval;
+        if (error) _error = error;
+        _busy = false;
+        _idle.notify_all();
+    }
+}
+
+/**
+ * Renderer::draw()
+ *
+ * Private helper function to build the frame being drawn and write it to the stream.
+ *
+ * @throws
+ *      std::runtime_error if the stream cannot be written.
+ */
+void Renderer::draw() {
+    int x, y, width, height;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        x = _view_x;
+        y = _view_y;
+        width = _view_width;
+        height = _view_height;
+    }
+
+    _frame = _drawing_title;
+    _frame += '\n';
+    _frame += render(_drawing, x, y, width, height, _columns, _rows);
+    _frame += '\n';
+
+    _out.write(_frame.data(), std::streamsize(_frame.size()));
+    _out.flush();
+    if (!_out) {
+        throw std::runtime_error("Frame cannot be written");
+    }
+}
+
+/**
+ * Renderer::render(grid, x, y, width, height, columns, rows)
+ *
+ * Draw a viewport of a grid wrapped in the same border as operator<<(output_stream, grid), shrunk to fit.
+ * Drawing the whole of a grid that fits gives exactly the same picture as operator<<.
+ *
+ * @example
+ *
+ *      // Draw a 1000x1000 grid in at most 100x50 characters, each one standing for a 20x20 block of cells
+ *      std::cout << Renderer::render(grid, 0, 0, 0, 0, 100, 50);
+ *
+ * @param grid
+ *      The grid to draw.
+ *
+ * @param x
+ *      The x coordinate of the top left cell of the viewport.
+ *
+ * @param y
+ *      The y coordinate of the top left cell of the viewport.
+ *
+ * @param width
+ *      The width of the viewport, clipped to the grid. 0 or less to reach the right edge of the grid.
+ *
+ * @param height
+ *      The height of the viewport, clipped to the grid. 0 or less to reach the bottom edge of the grid.
+ *
+ * @param columns
+ *      The most characters a row of the viewport may take up, 0 or less for no limit.
+ *
+ * @param rows
+ *      The most rows the viewport may take up, 0 or less for no limit.
+ *
+ * @return
+ *      The picture, ending in a new line.
+ */
+std::string Renderer::render(const Grid &grid, int x, int y, int width, int height, int columns, int rows) {
+    x = std::min(std::max(x, 0), grid.get_width());
+    y = std::min(std::max(y, 0), grid.get_height());
+    width = width > 0 ? std::min(width, grid.get_width() - x) : grid.get_width() - x;
+    height = height > 0 ? std::min(height, grid.get_height() - y) : grid.get_height() - y;
+
+    // Shrink by the smallest whole factor that fits the viewport in both directions
+    int scale = 1;
+    if (columns > 0) scale = std::max(scale, (width + columns - 1) / columns);
+    if (rows > 0) scale = std::max(scale, (height + rows - 1) / rows);
+    const int out_width = (width + scale - 1) / scale, out_height = (height + scale - 1) / scale;
+
+    const std::string border = "+" + std::string(std::size_t(out_width), '-') + "+\n";
+    std::string picture;
+    picture.reserve(std::size_t(out_width + 3) * std::size_t(out_height + 2));
+    picture += border;
+
+    std::vector<Grid::Word> block(std::size_t(grid.get_words_per_row()), 0);
+    for (int out_y = 0; out_y < out_height; out_y++) {
+        // Fold the rows of this band of blocks into one, so each block is a single span of bits
+        const int top = y + out_y * scale, bottom = std::min(y + height, top + scale);
+        const Grid::Word *words = grid.row_words(top);
+        if (bottom - top > 1) {
+            std::copy(words, words + block.size(), block.begin());
+            for (int row = top + 1; row < bottom; row++) {
+                const Grid::Word *other = grid.row_words(row);
+                for (std::size_t word = 0; word < block.size(); word++) {
+                    block[word] |= other[word];
+                }
+            }
+            words = block.data();
+        }
+
+        picture += '|';
+        for (int out_x = 0; out_x < out_width; out_x++) {
+            const int left = x + out_x * scale, right = std::min(x + width, left + scale);
+            picture += any_alive(words, left, right) ? '#' : ' ';
+        }
+        picture += "|\n";
+    }
+    picture += border;
+
+    return picture;
+}
+
+/**
+ * Renderer::terminal_size(columns, rows)
+ *
+ * Find the size of the terminal the standard output is attached to.
+ *
+ * @param columns
+ *      Set to the width of the terminal in characters.
+ *
+ * @param rows
+ *      Set to the height of the terminal in rows.
+ *
+ * @return
+ *      False if the standard output is not a terminal, or its size cannot be found.
+ */
+bool Renderer::terminal_size(int &columns, int &rows) {
+#ifdef GOL_HAVE_TERMINAL
+    winsize size{};
+    if (isatty(STDOUT_FILENO) && ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_col > 0 && size.ws_row > 0) {
+        columns = size.ws_col;
+        rows = size.ws_row;
+        return true;
+    }
+#endif
+    return false;
+}
@@ -0,0 +1,73 @@
+/**
+ * Declares a class for drawing a running simulation to the console on a background thread.
+ * Rich documentation for the api and behaviour the Renderer class can be found in renderer.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+/**
+ * Declare the structure of the Renderer class for printing frames of a grid without stalling the simulation.
+ *
+ * Frames are copied into a pending buffer, and a drawing thread swaps it with the buffer it draws from.
+ *      - Only the latest frame is kept waiting, a newer one replaces it if the console has not caught up.
+ *      - A viewport picks the part of the grid to show, shrunk to fit the console if it is too big.
+ */
+class Renderer {
+private:
+    std::ostream &_out;
+    int _columns, _rows;
+    int _view_x, _view_y, _view_width, _view_height;
+    std::chrono::steady_clock::duration _interval;
+    std::chrono::steady_clock::time_point _next_frame;
+
+    Grid _pending, _drawing;
+    std::string _pending_title, _drawing_title, _frame;
+    bool _has_pending, _busy, _stopping;
+    int _waiting;
+    std::uint64_t _dropped;
+    std::exception_ptr _error;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _wake, _idle;
+    std::thread _drawer;
+
+    void work();
+
+    void draw();
+
+public:
+    explicit Renderer(std::ostream &out, int columns = 0, int rows = 0, int fps = 0);
+
+    Renderer(const Renderer &other) = delete;
+
+    Renderer &operator=(const Renderer &other) = delete;
+
+    ~Renderer();
+
+    void set_viewport(int x, int y, int width, int height);
+
+    void submit(const Grid &grid, const std::string &title);
+
+    void wait();
+
+    std::uint64_t get_dropped_frames() const;
+
+    static std::string render(const Grid &grid, int x, int y, int width, int height, int columns, int rows);
+
+    static bool terminal_size(int &columns, int &rows);
+};
@@ -0,0 +1,219 @@
+/**
+ * Implements a class representing the birth and survival rule of a Life-like cellular automaton.
+ *      - https://conwaylife.com/wiki/Rulestring
+ *
+ *      - Rules are written in B/S notation, the neighbour counts that cause a birth then those that
+ *        let a cell survive. Conway's Game of Life is B3/S23.
+ *          - The halves can be given in either order, and without the slash, case does not matter.
+ *          - The older S/B notation of two bare lists of digits, survival first, is accepted too, so Conway is 23/3.
+ *
+ *      - The next state of a cell only depends on its own state and how many of its 8 neighbours are alive,
+ *        so every rule can be stepped by the same word-parallel neighbour count, see kernel.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "rule.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <cctype>
+#include <stdexcept>
+
+/**
+ * The mask covering every neighbour count from 0 to 8.
+ */
+static const std::uint16_t ALL_COUNTS = 0x1FF;
+
+/**
+ * parse_counts(notation, index, mask)
+ *
+ * Private helper function to read a run of neighbour count digits into a mask, moving index past them.
+ *
+ * @throws
+ *      std::runtime_error if a count of 9 is given.
+ */
+static void parse_counts(const std::string &notation, std::size_t &index, std::uint16_t &mask) {
+    for (; index < notation.size() && std::isdigit((unsigned char) notation[index]); index++) {
+        const int count = notation[index] - '0';
+        if (count > 8) {
+            throw std::runtime_error("Rule " + notation + " has a neighbour count past 8");
+        }
+        mask |= std::uint16_t(1u << count);
+    }
+}
+
+/**
+ * Rule::Rule()
+ *
+ * Construct Conway's rule, B3/S23.
+ *
+ * @example
+ *
+ *      // Step a world by Conway's rule
+ *      Rule rule;
+ *
+ */
+Rule::Rule() : Rule(conway()) {}
+
+/**
+ * Rule::Rule(birth, survival)
+ *
+ * Construct a rule from its masks of neighbour counts.
+ *
+ * @example
+ *
+ *      // Make HighLife, B36/S23
+ *      Rule rule(1 << 3 | 1 << 6, 1 << 2 | 1 << 3);
+ *
+ * @param birth
+ *      Bit n set if a dead cell with n alive neighbours is born. Bits past 8 are ignored.
+ *
+ * @param survival
+ *      Bit n set if an alive cell with n alive neighbours survives. Bits past 8 are ignored.
+ */
+Rule::Rule(std::uint16_t birth, std::uint16_t survival)
+        : _birth(std::uint16_t(birth & ALL_COUNTS)), _survival(std::uint16_t(survival & ALL_COUNTS)) {}
+
+/**
+ * Rule::Rule(notation)
+ *
+ * Construct a rule from B/S notation, or the older S/B notation.
+ *
+ * @example
+ *
+ *      // Each of these is Day & Night
+ *      Rule a("B3678/S34678"), b("s34678/b3678"), c("34678/3678");
+ *
+ * @param notation
+ *      The rule as a string.
+ *
+ * @throws
+ *      std::runtime_error if the notation cannot be parsed.
+ */
+Rule::Rule(const std::string &notation) : _birth(0), _survival(0) {
+    std::size_t index = 0;
+
+    // The older notation is two bare lists of digits, survival then birth
+    if (index < notation.size() && (std::isdigit((unsigned char) notation[index]) || notation[index] == '/')) {
+        parse_counts(notation, index, _survival);
+        if (index < notation.size() && notation[index] == '/') {
+            parse_counts(notation, ++index, _birth);
+        }
+        if (index != notation.size() || notation.find('/') == std::string::npos) {
+            throw std::runtime_error("Rule " + notation + " cannot be parsed");
+        }
+        return;
+    }
+
+    bool seen_birth = false, seen_survival = false;
+    while (index < notation.size()) {
+        const char half = char(std::toupper((unsigned char) notation[index++]));
+        if (half == 'B' && !seen_birth) {
+            parse_counts(notation, index, _birth);
+            seen_birth = true;
+        } else if (half == 'S' && !seen_survival) {
+            parse_counts(notation, index, _survival);
+            seen_survival = true;
+        } else {
+            throw std::runtime_error("Rule " + notation + " cannot be parsed");
+        }
+
+        if (index < notation.size() && notation[index] == '/' && !(seen_birth && seen_survival)) index++;
+    }
+
+    if (!seen_birth || !seen_survival) {
+        throw std::runtime_error("Rule " + notation + " cannot be parsed");
+    }
+}
+
+/**
+ * Rule::get_birth()
+ *
+ * Gets the neighbour counts that give birth to a dead cell.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A mask with bit n set if n alive neighbours gives birth.
+ */
+std::uint16_t Rule::get_birth() const {
+    return _birth;
+}
+
+/**
+ * Rule::get_survival()
+ *
+ * Gets the neighbour counts that keep an alive cell alive.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A mask with bit n set if n alive neighbours lets a cell survive.
+ */
+std::uint16_t Rule::get_survival() const {
+    return _survival;
+}
+
+/**
+ * Rule::to_string()
+ *
+ * Writes the rule in B/S notation, with the counts in increasing order.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Prints B3/S23
+ *      std::cout << Rule().to_string() << std::endl;
+ *
+ * @return
+ *      The rule as a string, such as "B36/S23".
+ */
+std::string Rule::to_string() const {
+    std::string notation = "B";
+    for (int count = 0; count <= 8; count++) {
+        if (_birth >> count & 1) notation += char('0' + count);
+    }
+    notation += "/S";
+    for (int count = 0; count <= 8; count++) {
+        if (_survival >> count & 1) notation += char('0' + count);
+    }
+
+    return notation;
+}
+
+/**
+ * Rule::operator==(other), Rule::operator!=(other)
+ *
+ * Compare two rules by the neighbour counts they give birth and survival on.
+ */
+bool Rule::operator==(const Rule &other) const {
+    return _birth == other._birth && _survival == other._survival;
+}
+
+bool Rule::operator!=(const Rule &other) const {
+    return !(*this == other);
+}
+
+/**
+ * Rule::conway(), Rule::highlife(), Rule::seeds(), Rule::day_and_night()
+ *
+ * The well known rules, each stepped by a kernel compiled just for it.
+ *      - Conway's Game of Life, B3/S23.
+ *      - HighLife, B36/S23, which has a replicator.
+ *      - Seeds, B2/S, where every cell dies each step.
+ *      - Day & Night, B3678/S34678, under which alive and dead cells behave the same.
+ */
+Rule Rule::conway() {
+    return Rule(1 << 3, 1 << 2 | 1 << 3);
+}
+
+Rule Rule::highlife() {
+    return Rule(1 << 3 | 1 << 6, 1 << 2 | 1 << 3);
+}
+
+Rule Rule::seeds() {
+    return Rule(1 << 2, 0);
+}
+
+Rule Rule::day_and_night() {
+    return Rule(1 << 3 | 1 << 6 | 1 << 7 | 1 << 8, 1 << 3 | 1 << 4 | 1 << 6 | 1 << 7 | 1 << 8);
+}
@@ -0,0 +1,49 @@
+/**
+ * Declares a class representing the birth and survival rule of a Life-like cellular automaton.
+ * Rich documentation for the api and behaviour the Rule class can be found in rule.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include <cstdint>
+#include <string>
+
+/**
+ * Declare the structure of the Rule class for choosing which neighbour counts give birth and survival.
+ *
+ * Each rule is a pair of 9 bit masks, bit n set if n alive neighbours gives birth to a dead cell,
+ * or keeps an alive cell alive.
+ */
+class Rule {
+private:
+    std::uint16_t _birth, _survival;
+
+public:
+    Rule();
+
+    Rule(std::uint16_t birth, std::uint16_t survival);
+
+    explicit Rule(const std::string &notation);
+
+    std::uint16_t get_birth() const;
+
+    std::uint16_t get_survival() const;
+
+    std::string to_string() const;
+
+    bool operator==(const Rule &other) const;
+
+    bool operator!=(const Rule &other) const;
+
+    static Rule conway();
+
+    static Rule highlife();
+
+    static Rule seeds();
+
+    static Rule day_and_night();
+};
@@ -0,0 +1,539 @@
+/**
+ * Implements a class running a census of random soups across every core of the machine.
+ *      - Each soup is a square of random cells in the middle of a dead world, stepped until it settles into
+ *        a cycle or runs out of generations. Its census is the population it settled with, the period
+ *        and generation of its cycle, and the bounding box of its cells.
+ *
+ *      - Soups are numbered, and the cells of soup n come from a generator seeded from the search seed and n.
+ *        The numbering lets a search be split across machines, and any soup be looked at again on its own.
+ *
+ *      - Work is shared out by stealing rather than from a single queue.
+ *          - Each worker starts with an equal range of soup numbers, and takes chunks off its front.
+ *          - A worker whose range is empty steals the back half of the largest range left.
+ *          - A range is a single atomic word, so taking and stealing are both one compare and swap,
+ *            and the owner only ever contends with a thief.
+ *
+ *      - Each worker steps its soups in one World and one start grid allocated up front, see World::reset.
+ *
+ *      - Results are written to a compact binary file, a 40 byte header then 26 bytes a soup.
+ *          - The header is the magic GOLS, the version, the soup size, world size, generation limit,
+ *            period limit, the birth and survival masks of the rule, and the seed.
+ *          - Each worker fills a buffer of its own with thousands of records before locking the file,
+ *            so the lock is taken once for every few thousand soups however many workers there are.
+ *          - Records are written in the order workers finish their buffers, each names its soup.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "soup_search.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * The number of soups a worker takes off its range at a time, and the number of records it buffers.
+ */
+static const std::uint32_t CHUNK_SOUPS = 64;
+static const std::size_t BUFFER_RECORDS = 4096;
+
+static const char MAGIC[4] = {'G', 'O', 'L', 'S'};
+static const std::uint32_t VERSION = 1;
+static const std::size_t HEADER_BYTES = 40;
+
+/**
+ * pack(first, last)
+ *
+ * Private helper function to pack a range of soup numbers into the word of a Range.
+ */
+static std::uint64_t pack(std::uint32_t first, std::uint32_t last) {
+    return (std::uint64_t(first) << 32) | last;
+}
+
+/**
+ * split_mix(state)
+ *
+ * Private helper function to draw the next 64 random bits of a SplitMix64 generator.
+ */
+static std::uint64_t split_mix(std::uint64_t &state) {
+    std::uint64_t value = (state += 0x9E3779B97F4A7C15ULL);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+/**
+ * put(bytes, value, size)
+ *
+ * Private helper function to append the lowest size bytes of a value, least significant first.
+ */
+static void put(std::vector<unsigned char> &bytes, std::uint64_t value, int size) {
+    for (int i = 0; i < size; i++) bytes.push_back((unsigned char) (value >> (8 * i)));
+}
+
+/**
+ * get(bytes, size)
+ *
+ * Private helper function to read a value of size bytes, least significant first, moving past it.
+ */
+static std::uint64_t get(const unsigned char *&bytes, int size) {
+    std::uint64_t value = 0;
+    for (int i = 0; i < size; i++) value |= std::uint64_t(*bytes++) << (8 * i);
+    return value;
+}
+
+/**
+ * SoupSearch::SoupSearch(soup_size, world_size, max_generations, max_period)
+ *
+ * Construct a search of square soups, each run in the middle of a larger square world.
+ * The search starts with seed 0, Conway's Game of Life, a dead border, and one thread per hardware thread.
+ *
+ * @example
+ *
+ *      // Run a million 16x16 soups for up to 5000 generations each, recording them in census.bin
+ *      SoupSearch search(16, 128, 5000, 60);
+ *      SoupSearch::Summary summary = search.run(0, 1000000, "census.bin");
+ *
+ * @param soup_size
+ *      The edge of the square of random cells, from 1 to 64.
+ *
+ * @param world_size
+ *      The edge of the world the soup is run in, at least the size of the soup and less than 65536.
+ *
+ * @param max_generations
+ *      The number of generations a soup is given to settle.
+ *
+ * @param max_period
+ *      The longest cycle a soup is watched for, see World::set_cycle_detection.
+ *
+ * @throws
+ *      std::runtime_error if any of the sizes or limits are out of range.
+ */
+SoupSearch::SoupSearch(int soup_size, int world_size, int max_generations, int max_period)
+        : _soup_size(soup_size), _world_size(world_size), _max_generations(max_generations),
+          _max_period(max_period), _threads(0), _seed(0), _toroidal(false) {
+    if (soup_size < 1 || soup_size > Grid::WORD_BITS || world_size < soup_size || world_size > 65535) {
+        throw std::runtime_error("Soups must be 1 to 64 cells wide, and fit a world less than 65536 cells wide");
+    }
+    if (max_generations < 0 || max_period < 1 || max_period > 65535) {
+        throw std::runtime_error("The generation limit cannot be negative, and the period limit must be 1 to 65535");
+    }
+}
+
+/**
+ * SoupSearch::get_seed()
+ *
+ * Gets the seed the soups are generated from.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The seed.
+ */
+std::uint64_t SoupSearch::get_seed() const {
+    return _seed;
+}
+
+/**
+ * SoupSearch::set_seed(seed)
+ *
+ * Set the seed the soups are generated from, so that different searches see different soups.
+ *
+ * @param seed
+ *      The new seed.
+ */
+void SoupSearch::set_seed(std::uint64_t seed) {
+    _seed = seed;
+}
+
+/**
+ * SoupSearch::get_rule()
+ *
+ * Gets the rule the soups are run by.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The rule.
+ */
+const Rule &SoupSearch::get_rule() const {
+    return _rule;
+}
+
+/**
+ * SoupSearch::set_rule(rule)
+ *
+ * Set the rule the soups are run by.
+ *
+ * @param rule
+ *      The new rule.
+ */
+void SoupSearch::set_rule(const Rule &rule) {
+    _rule = rule;
+}
+
+/**
+ * SoupSearch::get_toroidal()
+ *
+ * Gets whether the soups are run on a torus rather than inside a dead border.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      True if the worlds wrap around.
+ */
+bool SoupSearch::get_toroidal() const {
+    return _toroidal;
+}
+
+/**
+ * SoupSearch::set_toroidal(toroidal)
+ *
+ * Set whether the soups are run on a torus rather than inside a dead border.
+ *
+ * @param toroidal
+ *      True to wrap the worlds around.
+ */
+void SoupSearch::set_toroidal(bool toroidal) {
+    _toroidal = toroidal;
+}
+
+/**
+ * SoupSearch::get_threads()
+ *
+ * Gets the number of workers the search runs on.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of workers, always at least 1.
+ */
+int SoupSearch::get_threads() const {
+    return _threads > 0 ? _threads : (int) std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * SoupSearch::set_threads(threads)
+ *
+ * Set the number of workers the search runs on, each stepping one soup at a time.
+ *
+ * @param threads
+ *      The number of workers, values less than 1 use one per hardware thread.
+ */
+void SoupSearch::set_threads(int threads) {
+    _threads = std::max(threads, 0);
+}
+
+/**
+ * SoupSearch::make_soup(soup, start)
+ *
+ * Write the cells of a numbered soup into the middle of a start grid, as wide and tall as the world,
+ * leaving every other cell of the grid dead. Each row of the soup is one draw from the generator.
+ * The function should be callable from a constant context.
+ *
+ * @param soup
+ *      The number of the soup.
+ *
+ * @param start
+ *      The grid to write the soup into.
+ *
+ * @throws
+ *      std::runtime_error if the grid is not the size of the world.
+ */
+void SoupSearch::make_soup(std::uint64_t soup, Grid &start) const {
+    if (start.get_width() != _world_size || start.get_height() != _world_size) {
+        throw std::runtime_error("The start grid must be the size of the world");
+    }
+
+    const int offset = (_world_size - _soup_size) / 2;
+    const int index = offset / Grid::WORD_BITS, shift = offset % Grid::WORD_BITS;
+    const Grid::Word mask = _soup_size == Grid::WORD_BITS ? ~Grid::Word(0) : (Grid::Word(1) << _soup_size) - 1;
+
+    std::uint64_t state = _seed ^ (soup * 0xD1B54A32D192ED03ULL);
+    start.fill(offset, offset, offset + _soup_size, offset + _soup_size, Cell::DEAD);
+    for (int y = offset; y < offset + _soup_size; y++) {
+        const Grid::Word bits = split_mix(state) & mask;
+        Grid::Word *row = start.row_words(y);
+        row[index] |= bits << shift;
+        if (shift + _soup_size > Grid::WORD_BITS) row[index + 1] |= bits >> (Grid::WORD_BITS - shift);
+    }
+}
+
+/**
+ * SoupSearch::evaluate(world, start, soup)
+ *
+ * Run one soup until it settles or runs out of generations, and take its census.
+ * The world is given the rule and cycle detection of the search if it does not have them, and is reset to the start.
+ * The function should be callable from a constant context.
+ *
+ * @param world
+ *      The world to run the soup in, the size of the world of the search.
+ *
+ * @param start
+ *      The first generation of the soup.
+ *
+ * @param soup
+ *      The number of the soup, recorded in its census.
+ *
+ * @return
+ *      The census of the soup. Soups that never settle have period 0 and the generation limit as their generation.
+ *
+ * @throws
+ *      std::runtime_error if the world or start grid are not the size of the world of the search.
+ */
+SoupSearch::Census SoupSearch::evaluate(World &world, const Grid &start, std::uint64_t soup) const {
+    if (world.get_width() != _world_size || world.get_height() != _world_size) {
+        throw std::runtime_error("The world must be the size of the world of the search");
+    }
+    if (world.get_rule() != _rule) world.set_rule(_rule);
+    if (world.get_cycle_detection() != _max_period) world.set_cycle_detection(_max_period);
+
+    world.reset(start);
+    world.advance(_max_generations, _toroidal);
+
+    Census census{};
+    census.soup = soup;
+    census.population = std::uint32_t(world.get_alive_cells());
+    census.period = std::uint16_t(world.get_cycle_period());
+    census.generation = std::uint32_t(census.period > 0 ? world.get_cycle_generation() : world.get_generation());
+
+    // Find the bounding box a row of words at a time, skipping dead words
+    const Grid &state = world.get_state();
+    int x0 = _world_size, y0 = _world_size, x1 = 0, y1 = 0;
+    for (int y = 0; y < _world_size && census.population > 0; y++) {
+        const Grid::Word *row = state.row_words(y);
+        for (int word = 0; word < state.get_words_per_row(); word++) {
+            if (row[word] == 0) continue;
+            x0 = std::min(x0, word * Grid::WORD_BITS + __builtin_ctzll(row[word]));
+            x1 = std::max(x1, word * Grid::WORD_BITS + Grid::WORD_BITS - __builtin_clzll(row[word]));
+            y0 = std::min(y0, y);
+            y1 = y + 1;
+        }
+    }
+    if (census.population > 0) {
+        census.x0 = std::uint16_t(x0);
+        census.y0 = std::uint16_t(y0);
+        census.x1 = std::uint16_t(x1);
+        census.y1 = std::uint16_t(y1);
+    }
+
+    return census;
+}
+
+/**
+ * SoupSearch::take(ranges, worker, first, last)
+ *
+ * Private helper function to take the next chunk of soups for a worker, from its own range if it has any left,
+ * otherwise by stealing the back half of the largest range of another worker and keeping the rest of it.
+ *
+ * @return
+ *      True with the soups [first, last) to run, false if no worker has any soups left.
+ */
+bool SoupSearch::take(std::vector<Range> &ranges, int worker, std::uint32_t &first, std::uint32_t &last) const {
+    std::atomic<std::uint64_t> &own = ranges[std::size_t(worker)].bounds;
+
+    std::uint64_t bounds = own.load();
+    while (std::uint32_t(bounds >> 32) < std::uint32_t(bounds)) {
+        const std::uint32_t begin = std::uint32_t(bounds >> 32), end = std::uint32_t(bounds);
+        const std::uint32_t next = begin + std::min(CHUNK_SOUPS, end - begin);
+        if (own.compare_exchange_weak(bounds, pack(next, end))) {
+            first = begin;
+            last = next;
+            return true;
+        }
+    }
+
+    // Every soup is handed out once, so a range can never come back to a value a thief saw before
+    while (true) {
+        std::size_t victim = ranges.size();
+        std::uint32_t most = 0;
+        std::uint64_t seen = 0;
+        for (std::size_t other = 0; other < ranges.size(); other++) {
+            const std::uint64_t value = ranges[other].bounds.load();
+            const std::uint32_t begin = std::uint32_t(value >> 32), end = std::uint32_t(value);
+            if (begin < end && end - begin > most) {
+                victim = other;
+                most = end - begin;
+                seen = value;
+            }
+        }
+        if (victim == ranges.size()) return false;
+
+        const std::uint32_t begin = std::uint32_t(seen >> 32), end = std::uint32_t(seen), half = (end - begin + 1) / 2;
+        if (ranges[victim].bounds.compare_exchange_strong(seen, pack(begin, end - half))) {
+            first = end - half;
+            last = first + std::min(CHUNK_SOUPS, half);
+            own.store(pack(last, end));
+            return true;
+        }
+    }
+}
+
+/**
+ * SoupSearch::run(first, count, path)
+ *
+ * Run a census of the soups numbered [first, first + count) across the workers of the search.
+ *
+ * @example
+ *
+ *      // Carry on a search from where another left off, writing no file
+ *      SoupSearch search(16, 128, 5000, 60);
+ *      search.set_seed(42);
+ *      SoupSearch::Summary summary = search.run(1000000, 1000000, "");
+ *      std::cout << summary.settled << " of " << summary.soups << " settled" << std::endl;
+ *
+ * @param first
+ *      The number of the first soup.
+ *
+ * @param count
+ *      The number of soups to run.
+ *
+ * @param path
+ *      The std::string path to the census file to write, or empty to only gather the summary.
+ *
+ * @return
+ *      The totals of the search.
+ *
+ * @throws
+ *      std::runtime_error if the census file cannot be written.
+ */
+SoupSearch::Summary SoupSearch::run(std::uint64_t first, std::uint32_t count, const std::string &filePath) const {
+    std::ofstream file;
+    if (!filePath.empty()) {
+        file.open(filePath, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("File cannot be written");
+        }
+
+        std::vector<unsigned char> header(MAGIC, MAGIC + 4);
+        for (std::uint32_t value : {VERSION, std::uint32_t(_soup_size), std::uint32_t(_world_size),
+                                    std::uint32_t(_max_generations), std::uint32_t(_max_period),
+                                    std::uint32_t(_rule.get_birth()), std::uint32_t(_rule.get_survival())}) {
+            put(header, value, 4);
+        }
+        put(header, _seed, 8);
+        file.write(reinterpret_cast<const char *>(header.data()), std::streamsize(header.size()));
+    }
+
+    // Share the soups out evenly to begin with, stealing evens out the rest
+    const int threads = get_threads();
+    std::vector<Range> ranges(static_cast<std::size_t>(threads));
+    for (int worker = 0; worker < threads; worker++) {
+        ranges[std::size_t(worker)].bounds.store(pack(std::uint32_t(std::uint64_t(count) * worker / threads),
+                                                      std::uint32_t(std::uint64_t(count) * (worker + 1) / threads)));
+    }
+
+    std::mutex sink;
+    Summary summary;
+    std::exception_ptr error;
+
+    ThreadPool pool(threads);
+    pool.run(threads, [&](int worker) {
+        try {
+            World world(_world_size, _world_size);
+            world.set_rule(_rule);
+            world.set_cycle_detection(_max_period);
+            Grid start(_world_size, _world_size);
+
+            Summary totals;
+            std::vector<unsigned char> buffer;
+            buffer.reserve(BUFFER_RECORDS * RECORD_BYTES);
+            auto flush = [&]() {
+                std::lock_guard<std::mutex> lock(sink);
+                if (file.is_open()) file.write(reinterpret_cast<const char *>(buffer.data()), std::streamsize(buffer.size()));
+                buffer.clear();
+            };
+
+            std::uint32_t begin = 0, end = 0;
+            while (take(ranges, worker, begin, end)) {
+                for (std::uint32_t soup = begin; soup < end; soup++) {
+                    make_soup(first + soup, start);
+                    const Census census = evaluate(world, start, first + soup);
+
+                    totals.soups++;
+                    totals.generations += census.generation;
+                    if (census.population == 0) totals.extinct++;
+                    if (census.period > 0) {
+                        totals.settled++;
+                        totals.periods[census.period]++;
+                    }
+
+                    put(buffer, census.soup, 8);
+                    put(buffer, census.population, 4);
+                    put(buffer, census.generation, 4);
+                    for (std::uint16_t value : {census.period, census.x0, census.y0, census.x1, census.y1}) {
+                        put(buffer, value, 2);
+                    }
+                    if (buffer.size() >= BUFFER_RECORDS * RECORD_BYTES) flush();
+                }
+            }
+            flush();
+
+            std::lock_guard<std::mutex> lock(sink);
+            summary.soups += totals.soups;
+            summary.settled += totals.settled;
+            summary.extinct += totals.extinct;
+            summary.generations += totals.generations;
+            for (const auto &period : totals.periods) summary.periods[period.first] += period.second;
+        } catch (...) {
+            // Stop the other workers too, by emptying every range
+            for (Range &range : ranges) range.bounds.store(0);
+            std::lock_guard<std::mutex> lock(sink);
+            if (!error) error = std::current_exception();
+        }
+    });
+
+    if (error) std::rethrow_exception(error);
+    if (file.is_open() && !file.flush()) {
+        throw std::runtime_error("File cannot be written");
+    }
+
+    return summary;
+}
+
+/**
+ * SoupSearch::load_census(path)
+ *
+ * Read back every record of a census file written by SoupSearch::run, in the order they were written.
+ *
+ * @param path
+ *      The std::string path to the census file to read.
+ *
+ * @return
+ *      The census of every soup in the file.
+ *
+ * @throws
+ *      std::runtime_error if the file cannot be read, is not a census file, or ends part way through a record.
+ */
+std::vector<SoupSearch::Census> SoupSearch::load_census(const std::string &filePath) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("File cannot be read");
+    }
+    const std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (bytes.size() < HEADER_BYTES || !std::equal(MAGIC, MAGIC + 4, bytes.begin())) {
+        throw std::runtime_error("The file is not a census file");
+    }
+    if ((bytes.size() - HEADER_BYTES) % RECORD_BYTES != 0) {
+        throw std::runtime_error("The census file ends part way through a record");
+    }
+
+    std::vector<Census> records((bytes.size() - HEADER_BYTES) / RECORD_BYTES);
+    const unsigned char *read = bytes.data() + HEADER_BYTES;
+    for (Census &census : records) {
+        census.soup = get(read, 8);
+        census.population = std::uint32_t(get(read, 4));
+        census.generation = std::uint32_t(get(read, 4));
+        census.period = std::uint16_t(get(read, 2));
+        census.x0 = std::uint16_t(get(read, 2));
+        census.y0 = std::uint16_t(get(read, 2));
+        census.x1 = std::uint16_t(get(read, 2));
+        census.y1 = std::uint16_t(get(read, 2));
+    }
+
+    return records;
+}
@@ -0,0 +1,96 @@
+/**
+ * Declares a class running a census of random soups across every core of the machine.
+ * Rich documentation for the api and behaviour the SoupSearch class can be found in soup_search.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+#include "world.h"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Declare the structure of the SoupSearch class for running huge numbers of random soups until they settle.
+ *
+ * Soups are numbered, and soup n of a seed is always the same soup, so any result can be run again on its own.
+ *      - Each worker owns a range of soup numbers and takes chunks off its front, stealing half of the
+ *        largest range left when its own runs out, so uneven soups never leave a core idle.
+ *      - Each worker steps its soups in one World allocated up front, and buffers its results,
+ *        so the output file is only locked once for thousands of soups.
+ */
+class SoupSearch {
+public:
+    /**
+     * The census record of one soup, written to the output file in 26 little endian bytes.
+     */
+    struct Census {
+        std::uint64_t soup;
+        std::uint32_t population;
+        std::uint32_t generation;
+        std::uint16_t period;
+        std::uint16_t x0, y0, x1, y1;
+    };
+
+    /**
+     * The totals of a search, gathered from every worker once it ends.
+     */
+    struct Summary {
+        std::uint64_t soups = 0, settled = 0, extinct = 0, generations = 0;
+        std::map<int, std::uint64_t> periods;
+    };
+
+    static const int RECORD_BYTES = 26;
+
+private:
+    /**
+     * The soups left to a worker, its next soup in the high half and one past its last in the low half.
+     * Kept one to a cache line, so the owner taking soups never contends with the other workers.
+     */
+    struct alignas(64) Range {
+        std::atomic<std::uint64_t> bounds{0};
+    };
+
+    int _soup_size, _world_size, _max_generations, _max_period, _threads;
+    std::uint64_t _seed;
+    Rule _rule;
+    bool _toroidal;
+
+    bool take(std::vector<Range> &ranges, int worker, std::uint32_t &first, std::uint32_t &last) const;
+
+public:
+    SoupSearch(int soup_size, int world_size, int max_generations, int max_period);
+
+    std::uint64_t get_seed() const;
+
+    void set_seed(std::uint64_t seed);
+
+    const Rule &get_rule() const;
+
+    void set_rule(const Rule &rule);
+
+    bool get_toroidal() const;
+
+    void set_toroidal(bool toroidal);
+
+    int get_threads() const;
+
+    void set_threads(int threads);
+
+    void make_soup(std::uint64_t soup, Grid &start) const;
+
+    Census evaluate(World &world, const Grid &start, std::uint64_t soup) const;
+
+    Summary run(std::uint64_t first, std::uint32_t count, const std::string &filePath) const;
+
+    static std::vector<Census> load_census(const std::string &filePath);
+};
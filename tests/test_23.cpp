@@ -0,0 +1,153 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include "../grid.h"
+
+SCENARIO("grids wider than a single storage word behave like narrow grids", "[grid][packed]") {
+
+    GIVEN("a 150x70 grid with a scattered pattern of alive cells") {
+
+        const int width = 150, height = 70;
+        auto pattern = [](int x, int y) { return ((x * 7 + y * 13) % 5 == 0) || (x == y); };
+
+        Grid g(width, height);
+        int alive = 0;
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                if (pattern(x, y)) {
+                    g(x, y) = Cell::ALIVE;
+                    alive++;
+                }
+            }
+        }
+
+        REQUIRE(g.get_words_per_row() == 3);
+
+        THEN("the alive and dead counts should match the pattern") {
+
+            REQUIRE(g.get_alive_cells() == alive);
+            REQUIRE(g.get_dead_cells() == (width * height) - alive);
+        }
+
+        THEN("cells written through a reference can be copied between grids") {
+
+            Grid h(width, height);
+            h(149, 69) = g(149, 69);
+            h(0, 0) = g(0, 0);
+
+            REQUIRE(h.get_alive_cells() == 2);
+            REQUIRE(h.get(149, 69) == Cell::ALIVE);
+            REQUIRE(h.get(0, 0) == Cell::ALIVE);
+        }
+
+        WHEN("a window straddling word boundaries is cropped") {
+
+            Grid h = g.crop(37, 5, 141, 61);
+
+            THEN("every cell of the window should be copied and nothing past it") {
+
+                REQUIRE(h.get_width() == 104);
+                REQUIRE(h.get_height() == 56);
+
+                int expected = 0;
+                for (int y = 0; y < h.get_height(); y++) {
+                    for (int x = 0; x < h.get_width(); x++) {
+                        REQUIRE(h.get(x, y) == (pattern(x + 37, y + 5) ? Cell::ALIVE : Cell::DEAD));
+                        expected += pattern(x + 37, y + 5) ? 1 : 0;
+                    }
+                }
+                REQUIRE(h.get_alive_cells() == expected);
+            }
+        }
+
+        WHEN("the grid is merged into a larger grid at an unaligned offset") {
+
+            Grid h(300, 80);
+            for (int x = 0; x < 300; x++) {
+                h.set(x, 40, Cell::ALIVE);
+            }
+
+            Grid overwrite = h, alive_only = h;
+            overwrite.merge(g, 101, 3);
+            alive_only.merge(g, 101, 3, true);
+
+            THEN("cells outside the merge region should be untouched") {
+
+                for (int x = 0; x < 101; x++) {
+                    REQUIRE(overwrite.get(x, 40) == Cell::ALIVE);
+                    REQUIRE(alive_only.get(x, 40) == Cell::ALIVE);
+                }
+                for (int x = 251; x < 300; x++) {
+                    REQUIRE(overwrite.get(x, 40) == Cell::ALIVE);
+                    REQUIRE(alive_only.get(x, 40) == Cell::ALIVE);
+                }
+            }
+
+            THEN("cells inside the merge region should follow the merge mode") {
+
+                for (int y = 0; y < height; y++) {
+                    for (int x = 0; x < width; x++) {
+                        Cell expected = pattern(x, y) ? Cell::ALIVE : Cell::DEAD;
+                        REQUIRE(overwrite.get(x + 101, y + 3) == expected);
+                        REQUIRE(alive_only.get(x + 101, y + 3) == (y + 3 == 40 ? Cell::ALIVE : expected));
+                    }
+                }
+            }
+        }
+
+        WHEN("the grid is rotated by each multiple of 90 degrees") {
+
+            Grid r0 = g.rotate(0), r1 = g.rotate(1), r2 = g.rotate(2), r3 = g.rotate(3);
+
+            THEN("each rotation should move every cell to its rotated coordinate") {
+
+                REQUIRE(r1.get_width() == height);
+                REQUIRE(r1.get_height() == width);
+                REQUIRE(r2.get_width() == width);
+                REQUIRE(r3.get_height() == width);
+
+                for (int y = 0; y < height; y++) {
+                    for (int x = 0; x < width; x++) {
+                        Cell expected = pattern(x, y) ? Cell::ALIVE : Cell::DEAD;
+                        REQUIRE(r0.get(x, y) == expected);
+                        REQUIRE(r1.get(height - y - 1, x) == expected);
+                        REQUIRE(r2.get(width - x - 1, height - y - 1) == expected);
+                        REQUIRE(r3.get(y, width - x - 1) == expected);
+                    }
+                }
+
+                REQUIRE(r1.get_alive_cells() == alive);
+                REQUIRE(r2.get_alive_cells() == alive);
+                REQUIRE(r3.get_alive_cells() == alive);
+            }
+        }
+
+        WHEN("the grid is resized narrower than its last word") {
+
+            g.resize(100, 10);
+
+            THEN("only cells within the kept region should remain") {
+
+                int expected = 0;
+                for (int y = 0; y < 10; y++) {
+                    for (int x = 0; x < 100; x++) {
+                        expected += pattern(x, y) ? 1 : 0;
+                    }
+                }
+
+                REQUIRE(g.get_words_per_row() == 2);
+                REQUIRE(g.get_alive_cells() == expected);
+
+                g.resize(150, 10);
+                REQUIRE(g.get_alive_cells() == expected);
+                REQUIRE(g.get(120, 0) == Cell::DEAD);
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
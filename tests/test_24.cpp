@@ -0,0 +1,40 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include "../grid.h"
+#include "../world.h"
+#include "test_util.h"
+
+SCENARIO("the word-parallel step matches a cell by cell step", "[world][step][kernel]") {
+
+    const int sizes[][2] = {{1, 1}, {1, 5}, {2, 2}, {3, 7}, {63, 9}, {64, 8}, {65, 12}, {127, 3}, {128, 6}, {200, 17}};
+
+    for (bool toroidal : {false, true}) {
+        for (const auto &size : sizes) {
+
+            GIVEN("a random " + std::to_string(size[0]) + "x" + std::to_string(size[1]) +
+                  (toroidal ? " toroidal" : " bounded") + " world") {
+
+                Grid expected = random_soup(size[0], size[1], unsigned(size[0] * 31 + size[1]));
+                World w(expected);
+
+                THEN("every generation should match the reference step") {
+
+                    for (int generation = 0; generation < 8; generation++) {
+                        w.step(toroidal);
+                        expected = reference_step(expected, Rule::conway(), toroidal);
+
+                        REQUIRE(w.get_state().to_string() == expected.to_string());
+                        REQUIRE(w.get_alive_cells() == expected.get_alive_cells());
+                    }
+                }
+            }
+        }
+    }
+
+} // SCENARIO
@@ -0,0 +1,61 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+
+#include "../grid.h"
+#include "../kernel.h"
+#include "../world.h"
+
+SCENARIO("every usable kernel implementation steps a world identically", "[world][step][kernel]") {
+
+    const std::string original = Kernel::get_implementation();
+    const std::vector<std::string> implementations = Kernel::get_implementations();
+
+    REQUIRE(implementations.back() == "scalar");
+    REQUIRE_THROWS(Kernel::set_implementation("does_not_exist"));
+
+    GIVEN("random worlds with rows spanning many vector widths") {
+
+        std::mt19937 random(5);
+        std::vector<Grid> soups;
+        for (int width : {70, 64 * 9, 64 * 17 + 13, 1000}) {
+            Grid soup(width, 13);
+            for (int y = 0; y < soup.get_height(); y++) {
+                for (int x = 0; x < width; x++) {
+                    if (random() % 2 == 0) soup.set(x, y, Cell::ALIVE);
+                }
+            }
+            soups.push_back(soup);
+        }
+
+        for (bool toroidal : {false, true}) {
+
+            THEN(std::string("each implementation should match scalar when ") + (toroidal ? "toroidal" : "bounded")) {
+
+                for (const Grid &soup : soups) {
+                    Kernel::set_implementation("scalar");
+                    World expected(soup);
+                    expected.advance(6, toroidal);
+
+                    for (const std::string &implementation : implementations) {
+                        Kernel::set_implementation(implementation);
+                        REQUIRE(Kernel::get_implementation() == implementation);
+
+                        World w(soup);
+                        w.advance(6, toroidal);
+                        REQUIRE(w.get_state().to_string() == expected.get_state().to_string());
+                    }
+                }
+            }
+        }
+    }
+
+    Kernel::set_implementation(original);
+
+} // SCENARIO
@@ -0,0 +1,82 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+
+#include "../grid.h"
+#include "../world.h"
+#include "../thread_pool.h"
+
+SCENARIO("a thread pool runs every task exactly once", "[thread_pool]") {
+
+    GIVEN("a pool of 4 threads") {
+
+        ThreadPool pool(4);
+
+        REQUIRE(pool.get_threads() == 4);
+
+        THEN("repeated batches of tasks should each run every task once") {
+
+            std::vector<int> counts(1000, 0);
+            for (int batch = 0; batch < 50; batch++) {
+                pool.run((int) counts.size(), [&](int task) { counts[task]++; });
+            }
+
+            for (int count : counts) {
+                REQUIRE(count == 50);
+            }
+        }
+    }
+
+} // SCENARIO
+
+SCENARIO("a world can be stepped on several threads", "[world][step][threads]") {
+
+    GIVEN("a large random world") {
+
+        std::mt19937 random(11);
+        Grid soup(2048, 257);
+        for (int y = 0; y < soup.get_height(); y++) {
+            for (int x = 0; x < soup.get_width(); x++) {
+                if (random() % 3 == 0) soup.set(x, y, Cell::ALIVE);
+            }
+        }
+
+        World single(soup);
+        REQUIRE(single.get_threads() == 1);
+
+        for (bool toroidal : {false, true}) {
+
+            WHEN(std::string("it is advanced on 1 and on 5 threads when ") + (toroidal ? "toroidal" : "bounded")) {
+
+                World parallel(soup);
+                parallel.set_threads(5);
+                REQUIRE(parallel.get_threads() == 5);
+
+                single.advance(10, toroidal);
+                parallel.advance(10, toroidal);
+
+                THEN("both worlds should be identical, including across band edges") {
+
+                    REQUIRE(parallel.get_state().to_string() == single.get_state().to_string());
+                }
+
+                THEN("copies of the world should share its threads") {
+
+                    World copy = parallel;
+                    copy.step(toroidal);
+                    parallel.step(toroidal);
+
+                    REQUIRE(copy.get_threads() == 5);
+                    REQUIRE(copy.get_state().to_string() == parallel.get_state().to_string());
+                }
+            }
+        }
+    }
+
+} // SCENARIO
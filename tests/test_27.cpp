@@ -0,0 +1,82 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+#include "../grid.h"
+#include "../world.h"
+
+// Count every heap allocation made by the test binary, so a test can check a block of code makes none.
+static std::atomic<long> allocations(0);
+
+void *operator new(std::size_t size) {
+    allocations++;
+    if (void *memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+SCENARIO("stepping a world does not allocate memory", "[world][step][advance][allocation]") {
+
+    for (int threads : {1, 4}) {
+
+        GIVEN("a large random world stepped on " + std::to_string(threads) + " threads") {
+
+            std::mt19937 random(3);
+            Grid soup(2000, 300);
+            for (int y = 0; y < soup.get_height(); y++) {
+                for (int x = 0; x < soup.get_width(); x++) {
+                    if (random() % 4 == 0) soup.set(x, y, Cell::ALIVE);
+                }
+            }
+
+            World w(soup);
+            w.set_threads(threads);
+
+            for (bool toroidal : {false, true}) {
+
+                WHEN(std::string("it is stepped and advanced when ") + (toroidal ? "toroidal" : "bounded")) {
+
+                    long before = allocations.load();
+                    w.step(toroidal);
+                    w.advance(50, toroidal);
+                    long after = allocations.load();
+
+                    THEN("no heap allocations should have been made") {
+
+                        REQUIRE(after - before == 0);
+                    }
+                }
+            }
+
+            WHEN("the world is resized") {
+
+                w.resize(3000, 100);
+
+                THEN("stepping at the new size should not allocate either") {
+
+                    long before = allocations.load();
+                    w.advance(20, true);
+                    REQUIRE(allocations.load() - before == 0);
+                    REQUIRE(w.get_width() == 3000);
+                }
+            }
+        }
+    }
+
+} // SCENARIO
@@ -0,0 +1,182 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <stdexcept>
+#include <thread>
+
+#include "../grid.h"
+#include "../hashlife.h"
+#include "../world.h"
+#include "../zoo.h"
+#include "test_util.h"
+
+SCENARIO("the HashLife engine matches the dense engine", "[hashlife]") {
+
+    GIVEN("a soup in the middle of a world much larger than it can spread in the time") {
+
+        Grid grid(256, 256);
+        grid.merge(random_soup(24, 24, 28), 116, 116);
+
+        World dense(grid), hashed(grid);
+        hashed.set_engine(World::Engine::HashLife, true);
+
+        REQUIRE(hashed.get_engine() == World::Engine::HashLife);
+        REQUIRE(hashed.get_state().to_string() == grid.to_string());
+
+        THEN("every generation should match the dense engine") {
+
+            for (int generation = 0; generation < 20; generation++) {
+                dense.step();
+                hashed.step();
+
+                REQUIRE(hashed.get_state().to_string() == dense.get_state().to_string());
+            }
+        }
+
+        THEN("advancing many generations at once should match the dense engine") {
+
+            dense.advance(60);
+            hashed.advance(60);
+
+            REQUIRE(hashed.get_state().to_string() == dense.get_state().to_string());
+
+            dense.advance(37);
+            hashed.advance(37);
+
+            REQUIRE(hashed.get_state().to_string() == dense.get_state().to_string());
+        }
+
+        THEN("a copy of the world should evolve independently") {
+
+            World copy = hashed;
+            copy.advance(10);
+            dense.advance(10);
+
+            REQUIRE(copy.get_state().to_string() == dense.get_state().to_string());
+            REQUIRE(hashed.get_state().to_string() == grid.to_string());
+        }
+
+        THEN("copies of the world advanced on two threads at once should each match the dense engine") {
+
+            World first = hashed, second = hashed;
+            std::thread other([&first] { first.advance(40); });
+            second.advance(25);
+            other.join();
+
+            World dense_first = dense;
+            dense_first.advance(40);
+            dense.advance(25);
+
+            REQUIRE(first.get_state().to_string() == dense_first.get_state().to_string());
+            REQUIRE(second.get_state().to_string() == dense.get_state().to_string());
+        }
+
+        THEN("switching back to the dense engine should carry on from the same state") {
+
+            hashed.advance(15);
+            hashed.set_engine(World::Engine::Dense);
+            hashed.advance(15);
+            dense.advance(30);
+
+            REQUIRE(hashed.get_state().to_string() == dense.get_state().to_string());
+        }
+
+        THEN("the engine should be refused unless the world is asked for as unbounded") {
+
+            World bounded(grid);
+            REQUIRE_THROWS_AS(bounded.set_engine(World::Engine::HashLife), std::runtime_error);
+            REQUIRE(bounded.get_engine() == World::Engine::Dense);
+        }
+
+        THEN("a toroidal world cannot be advanced") {
+
+            REQUIRE_THROWS_AS(hashed.step(true), std::runtime_error);
+            REQUIRE_THROWS_AS(hashed.advance(5, true), std::runtime_error);
+        }
+    } // GIVEN
+
+    GIVEN("a glider on an unbounded plane") {
+
+        HashLife life(Zoo::glider());
+
+        REQUIRE(life.get_population() == 5);
+        REQUIRE(life.to_grid(0, 0, 3, 3).to_string() == Zoo::glider().to_string());
+
+        WHEN("it is jumped 2^40 generations forward") {
+
+            life.jump(40);
+
+            THEN("it should have travelled a quarter of that diagonally, unchanged") {
+
+                const std::int64_t distance = std::int64_t(1) << 38;
+
+                REQUIRE(life.get_generation() == (std::uint64_t(1) << 40));
+                REQUIRE(life.get_population() == 5);
+                REQUIRE(life.to_grid(distance, distance, 3, 3).to_string() == Zoo::glider().to_string());
+            }
+        }
+
+        WHEN("it is advanced an amount that is not a power of two") {
+
+            Grid start(6, 6);
+            start.merge(Zoo::glider(), 1, 1);
+
+            World dense(start);
+            dense.step();
+
+            HashLife padded(start);
+            padded.advance(1001);
+
+            THEN("it should be one phase on from where 250 periods put it") {
+
+                REQUIRE(padded.get_generation() == 1001);
+                REQUIRE(padded.get_population() == 5);
+                REQUIRE(padded.to_grid(250, 250, 6, 6).to_string() == dense.get_state().to_string());
+            }
+        }
+
+        WHEN("it is copied and both planes are advanced on two threads at once") {
+
+            HashLife copy = life;
+            std::thread other([&copy] { copy.advance(4000); });
+            life.advance(400);
+            other.join();
+
+            THEN("each should be where its own generations put it, with a table of its own") {
+
+                REQUIRE(copy.get_generation() == 4000);
+                REQUIRE(life.get_generation() == 400);
+                REQUIRE(copy.to_grid(1000, 1000, 3, 3).to_string() == Zoo::glider().to_string());
+                REQUIRE(life.to_grid(100, 100, 3, 3).to_string() == Zoo::glider().to_string());
+                REQUIRE(HashLife(copy).get_node_count() < copy.get_node_count());
+            }
+        }
+    } // GIVEN
+
+    GIVEN("a blinker") {
+
+        Grid blinker(3, 3);
+        for (int x = 0; x < 3; x++) {
+            blinker.set(x, 1, Cell::ALIVE);
+        }
+
+        HashLife life(blinker);
+
+        THEN("it should return to its first phase after any even number of generations") {
+
+            life.advance(2000000000);
+
+            REQUIRE(life.get_population() == 3);
+            REQUIRE(life.to_grid(0, 0, 3, 3).to_string() == blinker.to_string());
+
+            life.advance(1);
+            REQUIRE(life.to_grid(0, 0, 3, 3).to_string() == blinker.rotate(1).to_string());
+        }
+    } // GIVEN
+
+} // SCENARIO
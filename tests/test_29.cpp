@@ -0,0 +1,113 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include "../grid.h"
+#include "../world.h"
+#include "../zoo.h"
+#include "test_util.h"
+
+SCENARIO("only the tiles near changing cells are stepped", "[world][step][tiles]") {
+
+    for (bool toroidal : {false, true}) {
+
+        GIVEN(std::string("a mostly empty ") + (toroidal ? "toroidal" : "bounded") +
+              " world with gliders crossing its edges and tile boundaries") {
+
+            Grid expected(300, 200);
+            expected.merge(Zoo::glider(), 290, 190);
+            expected.merge(Zoo::glider(), 61, 61);
+            expected.merge(Zoo::glider().rotate(1), 126, 2);
+            expected.merge(Zoo::light_weight_spaceship(), 150, 130);
+
+            World w(expected);
+
+            THEN("every generation should match the reference step") {
+
+                for (int generation = 0; generation < 60; generation++) {
+                    w.step(toroidal);
+                    expected = reference_step(expected, Rule::conway(), toroidal);
+
+                    REQUIRE(w.get_state().to_string() == expected.to_string());
+                }
+            }
+
+            THEN("switching topology should still match the reference step") {
+
+                for (int generation = 0; generation < 12; generation++) {
+                    w.step(toroidal);
+                    expected = reference_step(expected, Rule::conway(), toroidal);
+                }
+                for (int generation = 0; generation < 12; generation++) {
+                    w.step(!toroidal);
+                    expected = reference_step(expected, Rule::conway(), !toroidal);
+
+                    REQUIRE(w.get_state().to_string() == expected.to_string());
+                }
+            }
+        } // GIVEN
+    }
+
+    GIVEN("a world which has settled down into still lifes") {
+
+        Grid block(2, 2);
+        block.set(0, 0, Cell::ALIVE);
+        block.set(1, 0, Cell::ALIVE);
+        block.set(0, 1, Cell::ALIVE);
+        block.set(1, 1, Cell::ALIVE);
+
+        Grid grid(1000, 1000);
+        grid.merge(block, 10, 10);
+        grid.merge(block, 500, 700);
+
+        World w(grid);
+        w.advance(2);
+
+        THEN("no tiles should be stepped") {
+
+            REQUIRE(w.get_active_tiles() == 0);
+            REQUIRE(w.get_state().to_string() == grid.to_string());
+        }
+
+        WHEN("a glider is added to the world") {
+
+            grid.merge(Zoo::glider(), 400, 400);
+            World g(grid);
+            g.step();
+
+            THEN("every tile should be stepped at first") {
+
+                REQUIRE(g.get_total_tiles() == 16 * 16);
+                REQUIRE(g.get_active_tiles() == g.get_total_tiles());
+            }
+
+            THEN("only the tiles around the glider should be stepped after that") {
+
+                for (int generation = 0; generation < 40; generation++) {
+                    g.step();
+
+                    REQUIRE(g.get_active_tiles() > 0);
+                    REQUIRE(g.get_active_tiles() <= 16);
+                    REQUIRE(g.get_alive_cells() == 13);
+                }
+            }
+        }
+
+        WHEN("the world is resized") {
+
+            w.resize(1001, 1000);
+            w.step();
+
+            THEN("every tile should be stepped again") {
+
+                REQUIRE(w.get_active_tiles() == w.get_total_tiles());
+                REQUIRE(w.get_alive_cells() == 8);
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
@@ -0,0 +1,119 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+
+#include "../grid.h"
+#include "../unbounded_world.h"
+#include "../world.h"
+#include "../zoo.h"
+
+SCENARIO("an unbounded world has no edges for patterns to fall off", "[unbounded]") {
+
+    GIVEN("an empty unbounded world") {
+
+        UnboundedWorld world;
+
+        REQUIRE(world.get_alive_cells() == 0);
+        REQUIRE(world.get_chunk_count() == 0);
+        REQUIRE(world.get_state().get_total_cells() == 0);
+
+        WHEN("cells are set either side of the origin and far away from it") {
+
+            world.set(-1, -1, Cell::ALIVE);
+            world.set(0, 0, Cell::ALIVE);
+            world.set(-1000000000000LL, 5000000000000LL, Cell::ALIVE);
+
+            THEN("they should be read back from their own chunks") {
+
+                REQUIRE(world.get(-1, -1) == Cell::ALIVE);
+                REQUIRE(world.get(0, 0) == Cell::ALIVE);
+                REQUIRE(world.get(-1, 0) == Cell::DEAD);
+                REQUIRE(world.get(-1000000000000LL, 5000000000000LL) == Cell::ALIVE);
+                REQUIRE(world.get_alive_cells() == 3);
+                REQUIRE(world.get_chunk_count() == 3);
+
+                std::int64_t x0, y0, x1, y1;
+                REQUIRE(world.get_bounds(x0, y0, x1, y1));
+                REQUIRE(x0 == -1000000000000LL);
+                REQUIRE(y0 == -1);
+                REQUIRE(x1 == 1);
+                REQUIRE(y1 == 5000000000001LL);
+            }
+
+            THEN("clearing the cells should free their chunks") {
+
+                world.set(-1000000000000LL, 5000000000000LL, Cell::DEAD);
+                world.set(0, 0, Cell::DEAD);
+
+                REQUIRE(world.get_chunk_count() == 1);
+                REQUIRE(world.get_alive_cells() == 1);
+            }
+
+            THEN("the lone cells should all die in a step") {
+
+                world.step();
+
+                REQUIRE(world.get_alive_cells() == 0);
+                REQUIRE(world.get_chunk_count() == 0);
+                REQUIRE(world.get_generation() == 1);
+            }
+        }
+    } // GIVEN
+
+    GIVEN("a soup in the middle of a bounded world much larger than it can spread in the time") {
+
+        std::mt19937 random(30);
+        Grid soup(40, 40);
+        for (int y = 0; y < 40; y++) {
+            for (int x = 0; x < 40; x++) {
+                if (random() % 3 == 0) soup.set(x, y, Cell::ALIVE);
+            }
+        }
+
+        Grid grid(400, 400);
+        grid.merge(soup, 180, 180);
+        World bounded(grid);
+
+        // Put the soup across the corner of four chunks around the origin
+        UnboundedWorld unbounded(soup, -20, -20);
+
+        THEN("every generation should match the bounded world") {
+
+            for (int generation = 0; generation < 80; generation++) {
+                bounded.step();
+                unbounded.step();
+
+                REQUIRE(unbounded.get_state(-200, -200, 400, 400).to_string() == bounded.get_state().to_string());
+                REQUIRE(unbounded.get_alive_cells() == std::uint64_t(bounded.get_alive_cells()));
+            }
+        }
+    } // GIVEN
+
+    GIVEN("a glider heading up and to the left from the origin") {
+
+        UnboundedWorld world(Zoo::glider().rotate(2));
+
+        WHEN("it is advanced 4000 generations") {
+
+            world.advance(4000);
+
+            THEN("it should have travelled 1000 cells diagonally without leaving a trail of chunks") {
+
+                std::int64_t x0, y0, x1, y1;
+                REQUIRE(world.get_bounds(x0, y0, x1, y1));
+                REQUIRE(x0 == -1000);
+                REQUIRE(y0 == -1000);
+                REQUIRE(world.get_state().to_string() == Zoo::glider().rotate(2).to_string());
+                REQUIRE(world.get_alive_cells() == 5);
+                REQUIRE(world.get_chunk_count() <= 4);
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
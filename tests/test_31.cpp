@@ -0,0 +1,84 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "../grid.h"
+#include "../zoo.h"
+
+// Write a binary file by hand, with the header and payload given.
+static void write_binary(const std::string &path, int width, int height, const std::vector<unsigned char> &payload) {
+    std::ofstream file(path, std::ios::out | std::ios::binary);
+    file.write(reinterpret_cast<const char *>(&width), sizeof(width));
+    file.write(reinterpret_cast<const char *>(&height), sizeof(height));
+    file.write(reinterpret_cast<const char *>(payload.data()), std::streamsize(payload.size()));
+}
+
+SCENARIO("binary files are copied into grids a word at a time", "[zoo][load_binary][packed]") {
+
+    GIVEN("random grids with rows that start part way through a byte and span several words") {
+
+        const int sizes[][2] = {{1, 1}, {7, 3}, {63, 5}, {64, 4}, {65, 9}, {130, 7}, {200, 33}};
+
+        for (const auto &size : sizes) {
+            std::mt19937 random(unsigned(size[0] * 7 + size[1]));
+            Grid g(size[0], size[1]);
+            for (int y = 0; y < size[1]; y++) {
+                for (int x = 0; x < size[0]; x++) {
+                    if (random() % 2 == 0) g.set(x, y, Cell::ALIVE);
+                }
+            }
+
+            WHEN("a " + std::to_string(size[0]) + "x" + std::to_string(size[1]) + " grid is saved and loaded") {
+
+                Zoo::save_binary("../test_outputs/SAVE_BINARY_PACKED.bgol", g);
+                Grid h = Zoo::load_binary("../test_outputs/SAVE_BINARY_PACKED.bgol");
+
+                THEN("every cell should survive the round trip") {
+
+                    REQUIRE(h.get_width() == g.get_width());
+                    REQUIRE(h.get_height() == g.get_height());
+                    REQUIRE(h.to_string() == g.to_string());
+                    REQUIRE(h.get_alive_cells() == g.get_alive_cells());
+                }
+            }
+        }
+    } // GIVEN
+
+    GIVEN("a file with exactly enough bytes for its cells") {
+
+        // A 3x3 grid with every cell alive needs 9 bits, so 2 bytes, the rest of the last byte is padding
+        write_binary("../test_outputs/BINARY_EXACT.bgol", 3, 3, {0xFF, 0xFF});
+
+        THEN("it should load without reading the padding bits as cells") {
+
+            Grid h = Zoo::load_binary("../test_outputs/BINARY_EXACT.bgol");
+
+            REQUIRE(h.get_alive_cells() == 9);
+            REQUIRE(h.get_words_per_row() == 1);
+            REQUIRE(h.row_words(2)[0] == 0x7);
+        }
+    } // GIVEN
+
+    GIVEN("files whose payload or header is cut short") {
+
+        write_binary("../test_outputs/BINARY_SHORT.bgol", 100, 100, std::vector<unsigned char>(1249, 0));
+        write_binary("../test_outputs/BINARY_NEGATIVE.bgol", -5, 4, std::vector<unsigned char>(8, 0));
+        std::ofstream("../test_outputs/BINARY_HEADER.bgol", std::ios::out | std::ios::binary) << "abc";
+
+        THEN("loading them should throw") {
+
+            REQUIRE_THROWS_AS(Zoo::load_binary("../test_outputs/BINARY_SHORT.bgol"), std::runtime_error);
+            REQUIRE_THROWS_AS(Zoo::load_binary("../test_outputs/BINARY_NEGATIVE.bgol"), std::runtime_error);
+            REQUIRE_THROWS_AS(Zoo::load_binary("../test_outputs/BINARY_HEADER.bgol"), std::runtime_error);
+        }
+    } // GIVEN
+
+} // SCENARIO
@@ -0,0 +1,80 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "../grid.h"
+#include "../zoo.h"
+
+static std::string read_file(const std::string &path) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Encode a grid as a .bgol file one cell at a time, the slow and obvious way.
+static std::string reference_binary(const Grid &grid) {
+    int width = grid.get_width(), height = grid.get_height();
+    std::string bytes(reinterpret_cast<const char *>(&width), 4);
+    bytes.append(reinterpret_cast<const char *>(&height), 4);
+
+    bytes.append((std::size_t(width) * height + 7) / 8, '\0');
+    for (int i = 0; i < width * height; i++) {
+        if (grid.get(i % width, i / width) == Cell::ALIVE) bytes[8 + i / 8] |= char(1 << (i % 8));
+    }
+    return bytes;
+}
+
+SCENARIO("grids are streamed to file a buffer at a time", "[zoo][save_ascii][save_binary]") {
+
+    const int sizes[][2] = {{0, 0}, {1, 1}, {5, 3}, {63, 2}, {64, 3}, {65, 5}, {150, 11}, {3000, 400}};
+
+    for (const auto &size : sizes) {
+
+        GIVEN("a random " + std::to_string(size[0]) + "x" + std::to_string(size[1]) + " grid") {
+
+            std::mt19937 random(unsigned(size[0] + size[1]));
+            Grid g(size[0], size[1]);
+            for (int y = 0; y < size[1]; y++) {
+                for (int x = 0; x < size[0]; x++) {
+                    if (random() % 3 == 0) g.set(x, y, Cell::ALIVE);
+                }
+            }
+
+            WHEN("it is saved as an ascii file") {
+
+                Zoo::save_ascii("../test_outputs/SAVE_ASCII_STREAMED.gol", g);
+
+                THEN("the file should be the header followed by the grid as a string") {
+
+                    std::stringstream expected;
+                    expected << size[0] << " " << size[1] << std::endl << g.to_string();
+
+                    REQUIRE(read_file("../test_outputs/SAVE_ASCII_STREAMED.gol") == expected.str());
+                    if (g.get_total_cells() > 0) {
+                        REQUIRE(Zoo::load_ascii("../test_outputs/SAVE_ASCII_STREAMED.gol").to_string() == g.to_string());
+                    }
+                }
+            }
+
+            WHEN("it is saved as a binary file") {
+
+                Zoo::save_binary("../test_outputs/SAVE_BINARY_STREAMED.bgol", g);
+
+                THEN("the file should match a cell by cell encoding") {
+
+                    REQUIRE(read_file("../test_outputs/SAVE_BINARY_STREAMED.bgol") == reference_binary(g));
+                }
+            }
+        } // GIVEN
+    }
+
+} // SCENARIO
@@ -0,0 +1,86 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <fstream>
+#include <random>
+#include <string>
+
+#include "../grid.h"
+#include "../zoo.h"
+
+static void write_file(const std::string &path, const std::string &text) {
+    std::ofstream file(path, std::ios::out | std::ios::binary);
+    file << text;
+}
+
+SCENARIO("ascii files are parsed straight into packed rows", "[zoo][load_ascii][packed]") {
+
+    GIVEN("an ascii file with rows wider than several words") {
+
+        std::mt19937 random(33);
+        std::string text = "203 4\n";
+        std::string rows[4];
+        for (auto &row : rows) {
+            for (int x = 0; x < 203; x++) {
+                row += random() % 2 == 0 ? '#' : ' ';
+            }
+            text += row + "\n";
+        }
+        write_file("../test_outputs/ASCII_WIDE.gol", text);
+
+        THEN("every cell should be parsed") {
+
+            Grid g = Zoo::load_ascii("../test_outputs/ASCII_WIDE.gol");
+
+            REQUIRE(g.get_width() == 203);
+            REQUIRE(g.get_height() == 4);
+            for (int y = 0; y < 4; y++) {
+                for (int x = 0; x < 203; x++) {
+                    REQUIRE(g.get(x, y) == (rows[y][x] == '#' ? Cell::ALIVE : Cell::DEAD));
+                }
+            }
+        }
+
+        WHEN("a bad symbol is hidden in the middle of a row") {
+
+            text[6 + 204 + 100] = '.';
+            write_file("../test_outputs/ASCII_WIDE_BAD.gol", text);
+
+            THEN("loading it should throw") {
+
+                REQUIRE_THROWS_AS(Zoo::load_ascii("../test_outputs/ASCII_WIDE_BAD.gol"), std::runtime_error);
+            }
+        }
+    } // GIVEN
+
+    GIVEN("an ascii file with short and blank lines and no final newline") {
+
+        write_file("../test_outputs/ASCII_SHORT.gol", "4 3\n#\n\n  ##");
+
+        THEN("the missing cells should be dead") {
+
+            Grid g = Zoo::load_ascii("../test_outputs/ASCII_SHORT.gol");
+
+            REQUIRE(g.get_alive_cells() == 3);
+            REQUIRE(g.get(0, 0) == Cell::ALIVE);
+            REQUIRE(g.get(2, 2) == Cell::ALIVE);
+            REQUIRE(g.get(3, 2) == Cell::ALIVE);
+        }
+    } // GIVEN
+
+    GIVEN("an ascii file with more rows than its header says") {
+
+        write_file("../test_outputs/ASCII_TALL.gol", "2 2\n##\n##\n##\n");
+
+        THEN("loading it should throw") {
+
+            REQUIRE_THROWS_AS(Zoo::load_ascii("../test_outputs/ASCII_TALL.gol"), std::runtime_error);
+        }
+    } // GIVEN
+
+} // SCENARIO
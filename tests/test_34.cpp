@@ -0,0 +1,186 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "../grid.h"
+#include "../rule.h"
+#include "../zoo.h"
+
+static void write_file(const std::string &path, const std::string &text) {
+    std::ofstream file(path, std::ios::out | std::ios::binary);
+    file << text;
+}
+
+static std::string read_file(const std::string &path) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static Grid random_grid(int width, int height, unsigned seed, int sparsity) {
+    std::mt19937 random(seed);
+    Grid grid(width, height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (random() % sparsity == 0) grid.set(x, y, Cell::ALIVE);
+        }
+    }
+    return grid;
+}
+
+SCENARIO("grids can be saved to and loaded from Life RLE files", "[zoo][rle]") {
+
+    GIVEN("a glider") {
+
+        WHEN("it is saved as an RLE file") {
+
+            Zoo::save_rle("../test_outputs/SAVE_RLE_GLIDER.rle", Zoo::glider());
+
+            THEN("the file should hold the standard encoding of a glider") {
+
+                REQUIRE(read_file("../test_outputs/SAVE_RLE_GLIDER.rle") == "x = 3, y = 3, rule = B3/S23\nbo$2bo$3o!\n");
+            }
+        }
+
+        WHEN("it is saved as an RLE file of another rule") {
+
+            Zoo::save("../test_outputs/SAVE_RLE_GLIDER.rle", Zoo::glider(), Rule("B36/S23"));
+
+            THEN("the header should name that rule, and the cells should load the same") {
+
+                REQUIRE(read_file("../test_outputs/SAVE_RLE_GLIDER.rle") == "x = 3, y = 3, rule = B36/S23\nbo$2bo$3o!\n");
+                REQUIRE(Zoo::load_rle("../test_outputs/SAVE_RLE_GLIDER.rle").to_string() == Zoo::glider().to_string());
+            }
+        }
+
+        WHEN("a commented RLE file of it spread over lines is loaded") {
+
+            write_file("../test_outputs/LOAD_RLE_GLIDER.rle", "#N Glider\n#C A comment\nx=3,y=3\nb\no$2b\no$3o\n!");
+
+            THEN("it should match the glider") {
+
+                REQUIRE(Zoo::load_rle("../test_outputs/LOAD_RLE_GLIDER.rle").to_string() == Zoo::glider().to_string());
+            }
+        }
+    } // GIVEN
+
+    GIVEN("random grids with long runs and empty rows") {
+
+        const int sizes[][2] = {{1, 1}, {70, 3}, {65, 40}, {300, 20}};
+
+        for (const auto &size : sizes) {
+            Grid g = random_grid(size[0], size[1], unsigned(size[0] * size[1]), 2);
+            for (int x = 0; x < size[0]; x++) {
+                g.set(x, 0, Cell::ALIVE);
+                g.set(x, size[1] - 1, Cell::DEAD);
+            }
+
+            WHEN("a " + std::to_string(size[0]) + "x" + std::to_string(size[1]) + " grid is saved and loaded") {
+
+                Zoo::save_rle("../test_outputs/SAVE_RLE_RANDOM.rle", g);
+                Grid h = Zoo::load_rle("../test_outputs/SAVE_RLE_RANDOM.rle");
+
+                THEN("every cell should survive the round trip, on lines of at most 70 characters") {
+
+                    REQUIRE(h.get_width() == g.get_width());
+                    REQUIRE(h.get_height() == g.get_height());
+                    REQUIRE(h.to_string() == g.to_string());
+
+                    std::stringstream lines(read_file("../test_outputs/SAVE_RLE_RANDOM.rle"));
+                    std::string line;
+                    std::getline(lines, line);
+                    while (std::getline(lines, line)) {
+                        REQUIRE(line.length() <= 70);
+                    }
+                }
+            }
+        }
+    } // GIVEN
+
+    GIVEN("malformed RLE files") {
+
+        write_file("../test_outputs/RLE_NO_HEADER.rle", "bo$2bo$3o!\n");
+        write_file("../test_outputs/RLE_WIDE.rle", "x = 3, y = 3\n4o!\n");
+        write_file("../test_outputs/RLE_TALL.rle", "x = 3, y = 1\no$o!\n");
+        write_file("../test_outputs/RLE_SYMBOL.rle", "x = 3, y = 3\nbo$2bz!\n");
+        write_file("../test_outputs/RLE_UNFINISHED.rle", "x = 3, y = 3\nbo$2bo$3o\n");
+
+        THEN("loading them should throw") {
+
+            REQUIRE_THROWS_AS(Zoo::load_rle("../test_outputs/RLE_NO_HEADER.rle"), std::runtime_error);
+            REQUIRE_THROWS_AS(Zoo::load_rle("../test_outputs/RLE_WIDE.rle"), std::runtime_error);
+            REQUIRE_THROWS_AS(Zoo::load_rle("../test_outputs/RLE_TALL.rle"), std::runtime_error);
+            REQUIRE_THROWS_AS(Zoo::load_rle("../test_outputs/RLE_SYMBOL.rle"), std::runtime_error);
+            REQUIRE_THROWS_AS(Zoo::load_rle("../test_outputs/RLE_UNFINISHED.rle"), std::runtime_error);
+            REQUIRE_THROWS_AS(Zoo::load_rle("../test_outputs/DOES_NOT_EXIST.rle"), std::runtime_error);
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("grids can be checkpointed to compressed files that skip empty space", "[zoo][compressed]") {
+
+    GIVEN("grids of varied sizes and densities") {
+
+        const int sizes[][3] = {{0, 0, 1}, {1, 1, 1}, {63, 7, 2}, {130, 50, 40}, {1000, 300, 5000}};
+
+        for (const auto &size : sizes) {
+            Grid g = random_grid(size[0], size[1], unsigned(size[0] + size[2]), size[2]);
+
+            WHEN("a " + std::to_string(size[0]) + "x" + std::to_string(size[1]) + " grid is saved and loaded") {
+
+                Zoo::save_compressed("../test_outputs/SAVE_COMPRESSED.cgol", g);
+                Grid h = Zoo::load_compressed("../test_outputs/SAVE_COMPRESSED.cgol");
+
+                THEN("every cell should survive the round trip") {
+
+                    REQUIRE(h.get_width() == g.get_width());
+                    REQUIRE(h.get_height() == g.get_height());
+                    REQUIRE(h.to_string() == g.to_string());
+                }
+            }
+        }
+    } // GIVEN
+
+    GIVEN("a huge grid holding only a glider") {
+
+        Grid g(4096, 4096);
+        g.merge(Zoo::glider(), 2000, 3000);
+
+        WHEN("it is saved as a compressed file") {
+
+            Zoo::save_compressed("../test_outputs/SAVE_COMPRESSED_GLIDER.cgol", g);
+
+            THEN("the file should only be a few bytes") {
+
+                REQUIRE(read_file("../test_outputs/SAVE_COMPRESSED_GLIDER.cgol").size() < 64);
+                REQUIRE(Zoo::load_compressed("../test_outputs/SAVE_COMPRESSED_GLIDER.cgol").to_string() == g.to_string());
+                REQUIRE(Zoo::load("../test_outputs/SAVE_COMPRESSED_GLIDER.cgol").to_string() == g.to_string());
+            }
+        }
+
+        WHEN("the compressed file is cut short") {
+
+            Zoo::save_compressed("../test_outputs/SAVE_COMPRESSED_GLIDER.cgol", g);
+            std::string bytes = read_file("../test_outputs/SAVE_COMPRESSED_GLIDER.cgol");
+            write_file("../test_outputs/COMPRESSED_SHORT.cgol", bytes.substr(0, bytes.size() - 3));
+            write_file("../test_outputs/COMPRESSED_MAGIC.cgol", "NOPE" + bytes.substr(4));
+
+            THEN("loading it should throw") {
+
+                REQUIRE_THROWS_AS(Zoo::load_compressed("../test_outputs/COMPRESSED_SHORT.cgol"), std::runtime_error);
+                REQUIRE_THROWS_AS(Zoo::load_compressed("../test_outputs/COMPRESSED_MAGIC.cgol"), std::runtime_error);
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
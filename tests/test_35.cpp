@@ -0,0 +1,132 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+#include "../checkpointer.h"
+#include "../grid.h"
+#include "../world.h"
+#include "../zoo.h"
+
+static bool file_exists(const std::string &path) {
+    return bool(std::ifstream(path));
+}
+
+SCENARIO("worlds can be checkpointed in the background and resumed", "[checkpoint]") {
+
+    const std::string prefix = "../test_outputs/CHECKPOINT";
+    std::remove((prefix + ".manifest").c_str());
+
+    GIVEN("no checkpoint has been written") {
+
+        Grid grid = Zoo::glider();
+        std::uint64_t generation = 7;
+
+        THEN("there should be nothing to resume from") {
+
+            REQUIRE_FALSE(Checkpointer::load_latest(prefix, grid, generation));
+            REQUIRE(generation == 7);
+            REQUIRE(grid.to_string() == Zoo::glider().to_string());
+        }
+    } // GIVEN
+
+    GIVEN("a world checkpointed while it steps") {
+
+        Grid start(64, 64);
+        start.merge(Zoo::glider(), 5, 5);
+        World world(start);
+
+        {
+            Checkpointer checkpointer(prefix);
+            for (int step = 1; step <= 40; step++) {
+                world.step();
+                if (step % 10 == 0) checkpointer.submit(world.get_state(), std::uint64_t(step));
+            }
+            checkpointer.wait();
+        }
+
+        THEN("the latest checkpoint should be the last snapshot") {
+
+            Grid grid;
+            std::uint64_t generation = 0;
+
+            REQUIRE(Checkpointer::load_latest(prefix, grid, generation));
+            REQUIRE(generation == 40);
+            REQUIRE(grid.to_string() == world.get_state().to_string());
+        }
+
+        THEN("only the latest grid file should be left") {
+
+            REQUIRE(file_exists(prefix + "-40.cgol"));
+            REQUIRE_FALSE(file_exists(prefix + "-10.cgol"));
+            REQUIRE_FALSE(file_exists(prefix + "-30.cgol"));
+        }
+
+        WHEN("a new run resumes from it and checkpoints again") {
+
+            Grid grid;
+            std::uint64_t generation = 0;
+            REQUIRE(Checkpointer::load_latest(prefix, grid, generation));
+
+            World resumed(grid);
+            resumed.reset(grid, generation);
+            resumed.advance(10);
+            {
+                Checkpointer checkpointer(prefix);
+                checkpointer.submit(resumed.get_state(), resumed.get_generation());
+            }
+
+            THEN("the resumed world should count its generations on from the checkpoint") {
+
+                REQUIRE(resumed.get_generation() == 50);
+            }
+
+            THEN("the run should carry on as if it was never stopped, replacing the old checkpoint") {
+
+                world.advance(10);
+
+                REQUIRE(Checkpointer::load_latest(prefix, grid, generation));
+                REQUIRE(generation == 50);
+                REQUIRE(grid.to_string() == world.get_state().to_string());
+                REQUIRE_FALSE(file_exists(prefix + "-40.cgol"));
+            }
+        }
+    } // GIVEN
+
+    GIVEN("a blinker resumed from generation 1000 with cycle detection on") {
+
+        Grid grid(5, 5);
+        grid.fill(1, 2, 4, 3, Cell::ALIVE);
+        World world(grid);
+        world.set_cycle_detection(4);
+        world.reset(grid, 1000);
+        world.advance(6);
+
+        THEN("the cycle should be found at a generation after the one resumed from") {
+
+            REQUIRE(world.get_generation() == 1006);
+            REQUIRE(world.get_cycle_period() == 2);
+            REQUIRE(world.get_cycle_generation() >= 1000);
+            REQUIRE(world.get_cycle_generation() <= 1006);
+        }
+    } // GIVEN
+
+    GIVEN("a checkpointer writing somewhere that does not exist") {
+
+        Checkpointer checkpointer("../test_outputs/DOES_NOT_EXIST/CHECKPOINT");
+        checkpointer.submit(Zoo::glider(), 1);
+
+        THEN("the failed write should be thrown when waiting for it") {
+
+            REQUIRE_THROWS_AS(checkpointer.wait(), std::runtime_error);
+            REQUIRE_NOTHROW(checkpointer.wait());
+        }
+    } // GIVEN
+
+} // SCENARIO
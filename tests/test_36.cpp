@@ -0,0 +1,125 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+
+#include "../grid.h"
+#include "../world.h"
+#include "../zoo.h"
+
+SCENARIO("worlds spot when their state repeats and skip ahead", "[world][cycles]") {
+
+    GIVEN("a world holding a blinker and a block") {
+
+        Grid grid(20, 20);
+        for (int x = 3; x < 6; x++) {
+            grid.set(x, 4, Cell::ALIVE);
+        }
+        for (int y = 12; y < 14; y++) {
+            grid.set(12, y, Cell::ALIVE);
+            grid.set(13, y, Cell::ALIVE);
+        }
+
+        World w(grid);
+        w.set_cycle_detection(10);
+
+        WHEN("it is advanced a billion steps") {
+
+            w.advance(1000000000);
+
+            THEN("it should find the period 2 cycle and skip to the end") {
+
+                REQUIRE(w.get_cycle_period() == 2);
+                REQUIRE(w.get_cycle_generation() == 2);
+                REQUIRE(w.get_generation() == 1000000000);
+                REQUIRE(w.get_state().to_string() == grid.to_string());
+            }
+
+            THEN("an odd number of steps more should flip the blinker") {
+
+                w.advance(1000001);
+
+                World plain(grid);
+                plain.step();
+                REQUIRE(w.get_state().to_string() == plain.get_state().to_string());
+                REQUIRE(w.get_generation() == 1001000001);
+            }
+        }
+
+        WHEN("the world is resized") {
+
+            w.advance(10);
+            w.resize(21, 20);
+
+            THEN("the cycle should be forgotten until it is found again") {
+
+                REQUIRE(w.get_cycle_period() == 0);
+                w.advance(10);
+                REQUIRE(w.get_cycle_period() == 2);
+            }
+        }
+    } // GIVEN
+
+    GIVEN("a glider on a torus, which comes back to where it started after 4 steps per cell") {
+
+        Grid grid(16, 16);
+        grid.merge(Zoo::glider(), 3, 5);
+
+        World detecting(grid), plain(grid);
+
+        WHEN("the longest period watched for is too short") {
+
+            detecting.set_cycle_detection(40);
+            detecting.advance(200, true);
+
+            THEN("no cycle should be found") {
+
+                REQUIRE(detecting.get_cycle_period() == 0);
+            }
+        }
+
+        WHEN("the longest period watched for is long enough") {
+
+            detecting.set_cycle_detection(100);
+            detecting.advance(12345, true);
+            plain.advance(12345, true);
+
+            THEN("the period should be found, and skipping ahead should land on the same state") {
+
+                REQUIRE(detecting.get_cycle_period() == 64);
+                REQUIRE(detecting.get_cycle_generation() == 64);
+                REQUIRE(detecting.get_state().to_string() == plain.get_state().to_string());
+            }
+        }
+    } // GIVEN
+
+    GIVEN("a random soup in a bounded world") {
+
+        std::mt19937 random(36);
+        Grid grid(200, 150);
+        for (int y = 0; y < 150; y++) {
+            for (int x = 0; x < 200; x++) {
+                if (random() % 3 == 0) grid.set(x, y, Cell::ALIVE);
+            }
+        }
+
+        World detecting(grid), plain(grid);
+        detecting.set_cycle_detection(30);
+
+        THEN("watching for cycles should not change how it evolves") {
+
+            for (int generation = 0; generation < 300; generation++) {
+                detecting.step();
+                plain.step();
+                REQUIRE(detecting.get_state().to_string() == plain.get_state().to_string());
+            }
+            REQUIRE(detecting.get_generation() == 300);
+        }
+    } // GIVEN
+
+} // SCENARIO
@@ -0,0 +1,60 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+
+#include "../grid.h"
+#include "../world.h"
+
+SCENARIO("a world keeps count of its population as it steps", "[world][population]") {
+
+    GIVEN("a random soup stepped on several threads") {
+
+        std::mt19937 random(37);
+        Grid grid(700, 300);
+        for (int y = 0; y < 300; y++) {
+            for (int x = 0; x < 700; x++) {
+                if (random() % 4 == 0) grid.set(x, y, Cell::ALIVE);
+            }
+        }
+
+        World w(grid);
+        w.set_threads(4);
+
+        REQUIRE(w.get_alive_cells() == grid.get_alive_cells());
+
+        THEN("the count should match a full recount every step, on either topology") {
+
+            for (int generation = 0; generation < 60; generation++) {
+                w.step(generation % 20 >= 10);
+
+                REQUIRE(w.get_alive_cells() == w.get_state().get_alive_cells());
+                REQUIRE(w.get_dead_cells() == w.get_total_cells() - w.get_state().get_alive_cells());
+            }
+        }
+
+        WHEN("the world is resized or handed to the HashLife engine") {
+
+            w.advance(5);
+            w.resize(350, 150);
+            REQUIRE(w.get_alive_cells() == w.get_state().get_alive_cells());
+
+            w.set_engine(World::Engine::HashLife, true);
+            w.advance(5);
+            REQUIRE(w.get_alive_cells() == w.get_state().get_alive_cells());
+
+            THEN("the count should carry on matching once back on the dense engine") {
+
+                w.set_engine(World::Engine::Dense);
+                w.advance(5);
+                REQUIRE(w.get_alive_cells() == w.get_state().get_alive_cells());
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
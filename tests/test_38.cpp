@@ -0,0 +1,116 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <sstream>
+#include <string>
+
+#include "../grid.h"
+#include "../metrics.h"
+#include "../world.h"
+#include "../zoo.h"
+
+SCENARIO("a world reports each step to a metrics recorder", "[world][metrics]") {
+
+    GIVEN("a glider in the corner of a large world") {
+
+        Grid grid(1000, 1000);
+        grid.merge(Zoo::glider(), 10, 10);
+        World w(grid);
+
+        std::ostringstream out;
+        Metrics metrics(out, Metrics::Format::JsonLines);
+
+        THEN("nothing should be measured without a recorder") {
+
+            w.advance(4);
+            REQUIRE(w.get_metrics() == nullptr);
+            REQUIRE(metrics.get_steps() == 0);
+        }
+
+        WHEN("the world is stepped with a recorder") {
+
+            w.set_metrics(&metrics);
+            w.step();
+            const StepStats first = metrics.get_last();
+            w.step();
+            const StepStats second = metrics.get_last();
+
+            THEN("the first step should compute every cell, the next only the tiles around the glider") {
+
+                REQUIRE(metrics.get_steps() == 2);
+                REQUIRE(first.generation == 1);
+                REQUIRE(first.cells_processed == 1000 * 1000);
+                REQUIRE(first.active_tiles == w.get_total_tiles());
+
+                REQUIRE(second.generation == 2);
+                REQUIRE(second.active_tiles < w.get_total_tiles());
+                REQUIRE(second.cells_processed == std::uint64_t(second.active_tiles) * 64 * 64);
+                REQUIRE(second.population == 5);
+            }
+
+            THEN("the cells changed should match a cell by cell comparison") {
+
+                Grid before = w.get_state();
+                w.step();
+                Grid after = w.get_state();
+
+                std::uint64_t changed = 0;
+                for (int y = 0; y < 1000; y++) {
+                    for (int x = 0; x < 1000; x++) {
+                        changed += before.get(x, y) != after.get(x, y) ? 1 : 0;
+                    }
+                }
+                REQUIRE(metrics.get_last().cells_changed == changed);
+                REQUIRE(changed > 0);
+            }
+
+            THEN("one json line should be written per step") {
+
+                std::istringstream lines(out.str());
+                std::string line;
+                int count = 0;
+                while (std::getline(lines, line)) {
+                    REQUIRE(line.front() == '{');
+                    REQUIRE(line.back() == '}');
+                    REQUIRE(line.find("\"generation\":" + std::to_string(++count)) != std::string::npos);
+                    REQUIRE(line.find("\"population\":5") != std::string::npos);
+                }
+                REQUIRE(count == 2);
+            }
+        }
+    } // GIVEN
+
+    GIVEN("a still life stepped with a prometheus recorder") {
+
+        Grid block(8, 8);
+        for (int y = 3; y < 5; y++) {
+            for (int x = 3; x < 5; x++) {
+                block.set(x, y, Cell::ALIVE);
+            }
+        }
+        World w(block);
+
+        std::ostringstream out;
+        Metrics metrics(out, Metrics::Format::Prometheus);
+        w.set_metrics(&metrics);
+        w.advance(3);
+
+        THEN("nothing should be written until the totals are flushed") {
+
+            REQUIRE(out.str().empty());
+            metrics.flush();
+
+            const std::string text = out.str();
+            REQUIRE(text.find("# TYPE gol_steps_total counter\ngol_steps_total 3\n") != std::string::npos);
+            REQUIRE(text.find("\ngol_cells_changed_total 0\n") != std::string::npos);
+            REQUIRE(text.find("\ngol_population 4\n") != std::string::npos);
+            REQUIRE(text.find("\ngol_generation 3\n") != std::string::npos);
+        }
+    } // GIVEN
+
+} // SCENARIO
@@ -0,0 +1,99 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <sstream>
+#include <string>
+
+#include "../grid.h"
+#include "../renderer.h"
+#include "../zoo.h"
+
+SCENARIO("frames of a grid are drawn within a viewport and shrunk to fit", "[renderer]") {
+
+    GIVEN("a 130x6 grid with a glider and a line of cells") {
+
+        Grid grid(130, 6);
+        grid.merge(Zoo::glider(), 1, 1);
+        for (int x = 60; x < 130; x++) {
+            grid.set(x, 5, Cell::ALIVE);
+        }
+
+        THEN("drawing the whole grid should match printing it to a stream") {
+
+            std::ostringstream printed;
+            printed << grid;
+
+            REQUIRE(Renderer::render(grid, 0, 0, 0, 0, 0, 0) == printed.str());
+            REQUIRE(Renderer::render(grid, 0, 0, 0, 0, 200, 10) == printed.str());
+        }
+
+        THEN("a viewport should draw only the cells inside it") {
+
+            REQUIRE(Renderer::render(grid, 1, 1, 3, 3, 0, 0) == "+---+\n"
+                                                                  "| # |\n"
+                                                                  "|  #|\n"
+                                                                  "|###|\n"
+                                                                  "+---+\n");
+
+            REQUIRE(Renderer::render(grid, 125, 4, 100, 100, 0, 0) == "+-----+\n"
+                                                                        "|     |\n"
+                                                                        "|#####|\n"
+                                                                        "+-----+\n");
+        }
+
+        THEN("a grid too wide for the console should be shrunk by the same factor both ways") {
+
+            // 130 columns into 20 is a factor of 7, so each character is a 7x7 block
+            REQUIRE(Renderer::render(grid, 0, 0, 0, 0, 20, 0) == "+" + std::string(19, '-') + "+\n"
+                                                                 "|#       ###########|\n"
+                                                                 "+" + std::string(19, '-') + "+\n");
+        }
+    } // GIVEN
+
+    GIVEN("a renderer drawing to a stream") {
+
+        std::ostringstream out;
+        Grid grid(4, 4);
+
+        WHEN("frames arrive faster than the frame rate allows") {
+
+            Renderer renderer(out, 0, 0, 2);
+            for (int frame = 1; frame <= 20; frame++) {
+                grid.set(frame % 4, frame / 4 % 4, Cell::ALIVE);
+                renderer.submit(grid, "Frame " + std::to_string(frame));
+            }
+            renderer.wait();
+
+            THEN("the frames in between should be dropped and the latest one drawn") {
+
+                REQUIRE(renderer.get_dropped_frames() > 0);
+                REQUIRE(out.str().find("Frame 20\n" + Renderer::render(grid, 0, 0, 0, 0, 0, 0)) != std::string::npos);
+                REQUIRE(out.str().find("Frame 19\n") == std::string::npos);
+            }
+        }
+
+        WHEN("the renderer is shrinking frames to fit the console") {
+
+            Renderer renderer(out, 2, 2);
+            grid.set(3, 3, Cell::ALIVE);
+            renderer.submit(grid, "Step 1");
+            renderer.wait();
+
+            THEN("each frame should be its title, the shrunk grid and a blank line") {
+
+                REQUIRE(out.str() == "Step 1\n"
+                                     "+--+\n"
+                                     "|  |\n"
+                                     "| #|\n"
+                                     "+--+\n"
+                                     "\n");
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
@@ -0,0 +1,126 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include "../grid.h"
+#include "../kernel.h"
+#include "../rule.h"
+#include "../world.h"
+#include "../zoo.h"
+#include "test_util.h"
+
+SCENARIO("rules are read and written in B/S notation", "[rule]") {
+
+    GIVEN("the ways of writing the well known rules") {
+
+        THEN("each should parse to the same rule") {
+
+            REQUIRE(Rule() == Rule::conway());
+            REQUIRE(Rule("B3/S23") == Rule::conway());
+            REQUIRE(Rule("b3s23") == Rule::conway());
+            REQUIRE(Rule("S23/B3") == Rule::conway());
+            REQUIRE(Rule("23/3") == Rule::conway());
+            REQUIRE(Rule("B36/S23") == Rule::highlife());
+            REQUIRE(Rule("B2/S") == Rule::seeds());
+            REQUIRE(Rule("/2") == Rule::seeds());
+            REQUIRE(Rule("B3678/S34678") == Rule::day_and_night());
+        }
+
+        THEN("each should be written back in B/S notation") {
+
+            REQUIRE(Rule::conway().to_string() == "B3/S23");
+            REQUIRE(Rule("s32/b63").to_string() == "B36/S23");
+            REQUIRE(Rule::seeds().to_string() == "B2/S");
+            REQUIRE(Rule(1 << 0 | 1 << 8, 0x1FF).to_string() == "B08/S012345678");
+        }
+    } // GIVEN
+
+    GIVEN("malformed rules") {
+
+        THEN("each should be rejected") {
+
+            for (const char *notation : {"", "B3", "S23", "B9/S23", "B3/S23/", "X3/S23", "23", "B3/B3", "B3//S23"}) {
+                REQUIRE_THROWS_AS(Rule(notation), std::runtime_error);
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("worlds step by any Life-like rule with every kernel implementation", "[world][rule][kernel]") {
+
+    const int sizes[][2] = {{1, 1}, {3, 7}, {64, 8}, {65, 12}, {200, 17}, {700, 9}};
+    const char *rules[] = {"B3/S23", "B36/S23", "B2/S", "B3678/S34678", "B1357/S1357", "B0/S8", "B08/S", "B/S012345678"};
+
+    for (const std::string &implementation : Kernel::get_implementations()) {
+        for (const char *notation : rules) {
+
+            GIVEN("the " + implementation + " kernel and the rule " + notation) {
+
+                Kernel::set_implementation(implementation);
+                const Rule rule(notation);
+
+                THEN("every generation of random worlds should match the reference step") {
+
+                    for (bool toroidal : {false, true}) {
+                        for (const auto &size : sizes) {
+                            Grid expected = random_soup(size[0], size[1], unsigned(size[0] * 31 + size[1]));
+                            World w(expected);
+                            w.set_rule(rule);
+
+                            for (int generation = 0; generation < 4; generation++) {
+                                w.step(toroidal);
+                                expected = reference_step(expected, rule, toroidal);
+
+                                REQUIRE(w.get_state().to_string() == expected.to_string());
+                                REQUIRE(w.get_alive_cells() == expected.get_alive_cells());
+                            }
+                        }
+                    }
+                }
+
+                Kernel::set_implementation(Kernel::get_implementations().front());
+            }
+        }
+    }
+
+} // SCENARIO
+
+SCENARIO("the HashLife engine steps by the rule of the world", "[world][rule][hashlife]") {
+
+    GIVEN("a HighLife soup in the middle of a large world") {
+
+        Grid grid(256, 256);
+        grid.merge(random_soup(24, 24, 40), 116, 116);
+
+        World dense(grid), hashed(grid);
+        dense.set_rule(Rule::highlife());
+        hashed.set_rule(Rule::highlife());
+        hashed.set_engine(World::Engine::HashLife, true);
+
+        THEN("both engines should agree while the soup stays inside the world") {
+
+            dense.advance(40);
+            hashed.advance(40);
+            REQUIRE(hashed.get_state().to_string() == dense.get_state().to_string());
+        }
+
+        THEN("a rule giving birth on 0 neighbours should be refused") {
+
+            REQUIRE_THROWS_AS(hashed.set_rule(Rule("B0/S8")), std::runtime_error);
+            REQUIRE(hashed.get_rule() == Rule::highlife());
+
+            dense.set_rule(Rule("B0/S8"));
+            REQUIRE_THROWS_AS(dense.set_engine(World::Engine::HashLife, true), std::runtime_error);
+            REQUIRE(dense.get_engine() == World::Engine::Dense);
+        }
+    } // GIVEN
+
+} // SCENARIO
@@ -0,0 +1,153 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../grid.h"
+#include "../kernel.h"
+#include "../world.h"
+#include "../world_batch.h"
+#include "../zoo.h"
+#include "test_util.h"
+
+SCENARIO("a batch of worlds steps each of them like a world of its own", "[batch][kernel]") {
+
+    const int sizes[][2] = {{1, 1}, {5, 3}, {32, 32}, {64, 9}, {70, 6}, {130, 4}};
+
+    for (const std::string &implementation : Kernel::get_implementations()) {
+        for (const auto &size : sizes) {
+
+            GIVEN("the " + implementation + " kernel and a batch of 21 random " + std::to_string(size[0]) + "x" +
+                  std::to_string(size[1]) + " soups") {
+
+                Kernel::set_implementation(implementation);
+
+                const int count = 21;
+                WorldBatch batch(size[0], size[1], count);
+                std::vector<Grid> soups;
+                for (int i = 0; i < count; i++) {
+                    soups.push_back(random_soup(size[0], size[1], unsigned(i * 97 + size[0])));
+                    batch.set(i, soups.back());
+                }
+
+                THEN("every world should match a world stepped on its own, on either topology") {
+
+                    for (bool toroidal : {false, true}) {
+                        std::vector<World> worlds;
+                        for (int i = 0; i < count; i++) {
+                            worlds.emplace_back(batch.get(i));
+                        }
+
+                        for (int generation = 0; generation < 6; generation++) {
+                            batch.step(toroidal);
+                            for (int i = 0; i < count; i++) {
+                                worlds[i].step(toroidal);
+                                REQUIRE(batch.get(i).to_string() == worlds[i].get_state().to_string());
+                                REQUIRE(batch.get_population(i) == worlds[i].get_alive_cells());
+                            }
+                        }
+                    }
+                }
+
+                Kernel::set_implementation(Kernel::get_implementations().front());
+            }
+        }
+    }
+
+    GIVEN("a large batch of soups stepped by HighLife on several threads") {
+
+        const int count = 3000;
+        WorldBatch batch(32, 32, count), single(32, 32, count);
+        for (int i = 0; i < count; i++) {
+            Grid soup = random_soup(32, 32, unsigned(i));
+            batch.set(i, soup);
+            single.set(i, soup);
+        }
+        batch.set_threads(4);
+        batch.set_rule(Rule::highlife());
+        single.set_rule(Rule::highlife());
+
+        THEN("the result should not depend on the number of threads") {
+
+            batch.advance(20, true);
+            single.advance(20, true);
+            REQUIRE(batch.get_populations() == single.get_populations());
+            for (int i = 0; i < count; i += 97) {
+                REQUIRE(batch.get(i).to_string() == single.get(i).to_string());
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("a batch of worlds reports how each of its worlds ends", "[batch]") {
+
+    GIVEN("a batch holding a block, a blinker, a lone cell and a glider") {
+
+        WorldBatch batch(8, 8, 4);
+
+        Grid block(8, 8), blinker(8, 8), lone(8, 8), glider(8, 8);
+        for (int i = 0; i < 4; i++) block.set(2 + i % 2, 2 + i / 2, Cell::ALIVE);
+        for (int i = 0; i < 3; i++) blinker.set(2 + i, 3, Cell::ALIVE);
+        lone.set(4, 4, Cell::ALIVE);
+        glider.merge(Zoo::glider(), 1, 1);
+
+        batch.set(0, block);
+        batch.set(1, blinker);
+        batch.set(2, lone);
+        batch.set(3, glider);
+
+        REQUIRE(batch.get_running() == 4);
+        REQUIRE(batch.get_status(0) == WorldBatch::Status::Running);
+
+        WHEN("the batch is advanced on a torus") {
+
+            batch.advance(40, true);
+
+            THEN("each world should have ended the way it does, except the glider") {
+
+                REQUIRE(batch.get_status(0) == WorldBatch::Status::Still);
+                REQUIRE(batch.get_status(1) == WorldBatch::Status::Oscillating);
+                REQUIRE(batch.get_status(2) == WorldBatch::Status::Extinct);
+                REQUIRE(batch.get_status(3) == WorldBatch::Status::Running);
+                REQUIRE(batch.get_settled_generation(0) == 1);
+                REQUIRE(batch.get_settled_generation(1) == 2);
+                REQUIRE(batch.get_settled_generation(2) == 1);
+                REQUIRE(batch.get_running() == 1);
+                REQUIRE(batch.get_populations() == std::vector<int>{4, 3, 0, 5});
+            }
+        }
+
+        WHEN("every world has ended and the batch is advanced a huge number of steps") {
+
+            batch.set(3, Grid(8, 8));
+            batch.advance(3);
+            REQUIRE(batch.get_running() == 0);
+
+            batch.advance(1000000001);
+
+            THEN("the remaining steps should be skipped, leaving each world as stepping would") {
+
+                REQUIRE(batch.get_generation() == 1000000004);
+                REQUIRE(batch.get(0).to_string() == block.to_string());
+                REQUIRE(batch.get(1).to_string() == blinker.to_string());
+                REQUIRE(batch.get_status(3) == WorldBatch::Status::Extinct);
+            }
+        }
+
+        THEN("worlds and grids that do not exist or do not fit should be refused") {
+
+            REQUIRE_THROWS_AS(batch.set(4, block), std::runtime_error);
+            REQUIRE_THROWS_AS(batch.set(0, Grid(8, 9)), std::runtime_error);
+            REQUIRE_THROWS_AS(batch.get(-1), std::runtime_error);
+        }
+    } // GIVEN
+
+} // SCENARIO
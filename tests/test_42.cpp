@@ -0,0 +1,73 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <cstdint>
+
+#include "../grid.h"
+#include "../huge_pages.h"
+#include "../world.h"
+#include "test_util.h"
+
+SCENARIO("worlds wider than a block of words step the same as narrow ones", "[world][step][blocked]") {
+
+    for (bool toroidal : {false, true}) {
+
+        GIVEN(std::string("a random 40000x70 ") + (toroidal ? "toroidal" : "bounded") + " world") {
+
+            Grid expected = random_soup(40000, 70, 42);
+            World w(expected);
+
+            THEN("every generation should match the reference step, across every block boundary") {
+
+                for (int generation = 0; generation < 3; generation++) {
+                    w.step(toroidal);
+                    expected = reference_step(expected, Rule::conway(), toroidal);
+
+                    REQUIRE(w.get_state().to_string() == expected.to_string());
+                    REQUIRE(w.get_alive_cells() == expected.get_alive_cells());
+                }
+            }
+        }
+    }
+
+} // SCENARIO
+
+SCENARIO("large grids live on huge pages and transform like small ones", "[grid][huge_pages]") {
+
+    GIVEN("a grid of more than a huge page of cells") {
+
+        Grid g(5000, 4000);
+        g.set(0, 0, Cell::ALIVE);
+        g.set(4999, 3999, Cell::ALIVE);
+        g.set(1234, 567, Cell::ALIVE);
+
+        THEN("its cells should start on a huge page boundary") {
+
+            REQUIRE(reinterpret_cast<std::uintptr_t>(g.row_words(0)) % HugePages::PAGE_BYTES == 0);
+        }
+
+        THEN("copying, cropping, merging and rotating should keep every cell") {
+
+            Grid copy = g;
+            REQUIRE(copy.get_alive_cells() == 3);
+
+            Grid cropped = g.crop(1000, 500, 4000, 3000);
+            REQUIRE(cropped.get_alive_cells() == 1);
+            REQUIRE(cropped.get(234, 67) == Cell::ALIVE);
+
+            Grid rotated = g.rotate(1);
+            REQUIRE(rotated.get_width() == 4000);
+            REQUIRE(rotated.get(4000 - 567 - 1, 1234) == Cell::ALIVE);
+
+            copy.merge(cropped, 10, 10, true);
+            REQUIRE(copy.get(244, 77) == Cell::ALIVE);
+            REQUIRE(copy.get_alive_cells() == 4);
+        }
+    } // GIVEN
+
+} // SCENARIO
@@ -0,0 +1,108 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <stdexcept>
+
+#include "../grid.h"
+#include "../world.h"
+#include "test_util.h"
+
+SCENARIO("advancing several generations per band matches stepping one at a time", "[world][temporal_blocking]") {
+
+    const int sizes[][2] = {{1, 1}, {7, 3}, {65, 63}, {130, 64}, {100, 129}, {200, 300}};
+
+    for (bool toroidal : {false, true}) {
+        for (const auto &size : sizes) {
+            for (int depth : {2, 3, 8, 64}) {
+
+                GIVEN("a random " + std::to_string(size[0]) + "x" + std::to_string(size[1]) +
+                      (toroidal ? " toroidal" : " bounded") + " world blocked " + std::to_string(depth) + " deep") {
+
+                    const Grid soup = random_soup(size[0], size[1], unsigned(size[0] * 17 + size[1] + depth));
+                    World blocked(soup), stepped(soup);
+                    blocked.set_temporal_blocking(depth);
+
+                    WHEN("both worlds are advanced by more than one block of generations") {
+
+                        const int steps = depth * 2 + 1;
+                        blocked.advance(steps, toroidal);
+                        for (int step = 0; step < steps; step++) stepped.step(toroidal);
+
+                        THEN("the states, populations and generations should be identical") {
+
+                            REQUIRE(blocked.get_state().to_string() == stepped.get_state().to_string());
+                            REQUIRE(blocked.get_alive_cells() == stepped.get_alive_cells());
+                            REQUIRE(blocked.get_generation() == stepped.get_generation());
+                        }
+
+                        THEN("stepping on afterwards should stay identical") {
+
+                            blocked.step(toroidal);
+                            stepped.step(toroidal);
+                            blocked.step(!toroidal);
+                            stepped.step(!toroidal);
+
+                            REQUIRE(blocked.get_state().to_string() == stepped.get_state().to_string());
+                            REQUIRE(blocked.get_alive_cells() == stepped.get_alive_cells());
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+} // SCENARIO
+
+SCENARIO("temporal blocking works alongside the other world settings", "[world][temporal_blocking]") {
+
+    GIVEN("a random 300x400 world on four threads blocked 4 deep") {
+
+        const Grid soup = random_soup(300, 400, 22);
+        World blocked(soup), stepped(soup);
+        blocked.set_threads(4);
+        blocked.set_temporal_blocking(4);
+
+        THEN("it should match stepping one generation at a time") {
+
+            blocked.advance(20, true);
+            stepped.advance(20, true);
+            REQUIRE(blocked.get_state().to_string() == stepped.get_state().to_string());
+        }
+
+        THEN("other rules should match stepping one generation at a time") {
+
+            blocked.set_rule(Rule::highlife());
+            stepped.set_rule(Rule::highlife());
+            blocked.advance(12);
+            stepped.advance(12);
+            REQUIRE(blocked.get_state().to_string() == stepped.get_state().to_string());
+        }
+
+        THEN("cycle detection should still find the cycle") {
+
+            Grid line(5, 5);
+            for (int x = 1; x < 4; x++) line.set(x, 2, Cell::ALIVE);
+            World blinker(line);
+            blinker.set_temporal_blocking(4);
+            blinker.set_cycle_detection(2);
+            blinker.advance(101);
+
+            REQUIRE(blinker.get_cycle_period() == 2);
+            REQUIRE(blinker.get_generation() == 101);
+            REQUIRE(blinker.get_state().get(2, 1) == Cell::ALIVE);
+        }
+
+        THEN("depths outside 1 to 64 generations should be rejected") {
+
+            REQUIRE_THROWS_AS(blocked.set_temporal_blocking(0), std::runtime_error);
+            REQUIRE_THROWS_AS(blocked.set_temporal_blocking(65), std::runtime_error);
+            REQUIRE(blocked.get_temporal_blocking() == 4);
+        }
+    } // GIVEN
+
+} // SCENARIO
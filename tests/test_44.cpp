@@ -0,0 +1,171 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <stdexcept>
+
+#include "../distributed_world.h"
+#include "../grid.h"
+#include "../world.h"
+#include "../zoo.h"
+#include "test_util.h"
+
+// Run under mpirun with any number of ranks. Checks are made on the first rank once the world
+// is gathered there, while every rank reaches every collective call together.
+
+SCENARIO("a world split across ranks steps the same as a world on one", "[distributed]") {
+
+    const int sizes[][2] = {{200, 70}, {333, 128}, {1000, 37}};
+
+    for (bool toroidal : {false, true}) {
+        for (const auto &size : sizes) {
+            for (int depth : {1, 3, 8}) {
+
+                GIVEN("a random " + std::to_string(size[0]) + "x" + std::to_string(size[1]) +
+                      (toroidal ? " toroidal" : " bounded") + " world with halos " + std::to_string(depth) + " deep") {
+
+                    const Grid soup = random_soup(size[0], size[1], unsigned(size[0] + size[1] + depth));
+                    DistributedWorld distributed(MPI_COMM_WORLD, soup);
+                    distributed.set_halo_depth(depth);
+                    World world(soup);
+
+                    WHEN("both are advanced by steps that are not a multiple of the depth") {
+
+                        distributed.advance(2 * depth + 1, toroidal);
+                        distributed.step(toroidal);
+                        world.advance(2 * depth + 2, toroidal);
+
+                        const Grid gathered = distributed.gather();
+                        const std::uint64_t alive = distributed.get_alive_cells();
+
+                        THEN("the gathered world, its population and generation should match") {
+
+                            REQUIRE(alive == std::uint64_t(world.get_alive_cells()));
+                            REQUIRE(distributed.get_generation() == world.get_generation());
+                            if (distributed.get_rank() == 0) {
+                                REQUIRE(gathered.to_string() == world.get_state().to_string());
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+} // SCENARIO
+
+SCENARIO("distributed worlds load and save binary files a block per rank", "[distributed][binary]") {
+
+    GIVEN("a random 517x93 world stepped by HighLife across the ranks") {
+
+        const Grid soup = random_soup(517, 93, 44);
+        DistributedWorld distributed(MPI_COMM_WORLD, soup);
+        distributed.set_rule(Rule::highlife());
+        distributed.advance(5, true);
+
+        World world(soup);
+        world.set_rule(Rule::highlife());
+        world.advance(5, true);
+
+        WHEN("it is saved by every rank and loaded back") {
+
+            distributed.save_binary("../test_outputs/DISTRIBUTED.bgol");
+            std::unique_ptr<DistributedWorld> loaded = DistributedWorld::load_binary(MPI_COMM_WORLD,
+                                                                                     "../test_outputs/DISTRIBUTED.bgol");
+            const Grid gathered = loaded->gather();
+
+            THEN("the file should hold the same cells as a file saved from one grid") {
+
+                if (distributed.get_rank() == 0) {
+                    REQUIRE(Zoo::load_binary("../test_outputs/DISTRIBUTED.bgol").to_string() ==
+                            world.get_state().to_string());
+                    REQUIRE(gathered.to_string() == world.get_state().to_string());
+                }
+                REQUIRE(loaded->get_width() == 517);
+                REQUIRE(loaded->get_height() == 93);
+            }
+        }
+
+        WHEN("a file saved from one grid is loaded across the ranks") {
+
+            if (distributed.get_rank() == 0) Zoo::save_binary("../test_outputs/DISTRIBUTED_SINGLE.bgol", soup);
+            MPI_Barrier(MPI_COMM_WORLD);
+
+            std::unique_ptr<DistributedWorld> loaded = DistributedWorld::load_binary(MPI_COMM_WORLD,
+                                                                                     "../test_outputs/DISTRIBUTED_SINGLE.bgol");
+            const Grid gathered = loaded->gather();
+
+            THEN("every rank should hold its own block of the grid") {
+
+                int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+                loaded->get_block(x0, y0, x1, y1);
+                REQUIRE(loaded->get_block_state().to_string() == soup.crop(x0, y0, x1, y1).to_string());
+                if (distributed.get_rank() == 0) {
+                    REQUIRE(gathered.to_string() == soup.to_string());
+                }
+            }
+        }
+
+        THEN("files that cannot be read should throw on every rank") {
+
+            REQUIRE_THROWS_AS(DistributedWorld::load_binary(MPI_COMM_WORLD, "../test_outputs/DOES_NOT_EXIST.bgol"),
+                              std::runtime_error);
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("worlds too narrow to split both ways are split into a single column of ranks", "[distributed]") {
+
+    int ranks = 0;
+    MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+
+    GIVEN("a random 64x12 world, a single word wide") {
+
+        const Grid soup = random_soup(64, 12, 64);
+        World world(soup);
+
+        THEN("it should split across up to 12 ranks and step the same as a world on one") {
+
+            if (ranks > 12) {
+                REQUIRE_THROWS_AS(DistributedWorld(MPI_COMM_WORLD, soup), std::runtime_error);
+                return;
+            }
+
+            DistributedWorld distributed(MPI_COMM_WORLD, soup);
+            distributed.advance(5);
+            world.advance(5);
+
+            const Grid gathered = distributed.gather();
+            if (distributed.get_rank() == 0) {
+                REQUIRE(gathered.to_string() == world.get_state().to_string());
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("distributed worlds reject halos their blocks cannot supply", "[distributed]") {
+
+    GIVEN("a 256x64 world split across the ranks") {
+
+        DistributedWorld distributed(MPI_COMM_WORLD, 256, 64);
+
+        THEN("halos less than one cell or more than one word deep should throw") {
+
+            REQUIRE_THROWS_AS(distributed.set_halo_depth(0), std::runtime_error);
+            REQUIRE_THROWS_AS(distributed.set_halo_depth(65), std::runtime_error);
+            REQUIRE(distributed.get_halo_depth() == 1);
+        }
+
+        THEN("a block too small for every rank should throw") {
+
+            REQUIRE_THROWS_AS(DistributedWorld(MPI_COMM_WORLD, 0, 0), std::runtime_error);
+        }
+    } // GIVEN
+
+} // SCENARIO
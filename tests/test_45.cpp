@@ -0,0 +1,88 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <stdexcept>
+
+#include "../gpu_engine.h"
+#include "../grid.h"
+#include "../world.h"
+#include "test_util.h"
+
+SCENARIO("the GPU engine is refused by builds without a usable GPU", "[world][gpu]") {
+
+    if (GpuEngine::is_available()) return;
+
+    GIVEN("a random world on the dense engine") {
+
+        World world(random_soup(100, 50, 45));
+        const std::string before = world.get_state().to_string();
+
+        THEN("switching to the GPU engine should throw and leave the world as it was") {
+
+            REQUIRE_THROWS_AS(world.set_engine(World::Engine::Gpu), std::runtime_error);
+            REQUIRE(world.get_engine() == World::Engine::Dense);
+            REQUIRE(world.get_state().to_string() == before);
+
+            world.step();
+            REQUIRE(world.get_generation() == 1);
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("the GPU engine steps the same as the dense engine", "[world][gpu]") {
+
+    // Nothing to check without a GPU, see the scenario above
+    if (!GpuEngine::is_available()) return;
+
+    const int sizes[][2] = {{1, 1}, {63, 9}, {65, 70}, {200, 130}};
+
+    for (bool toroidal : {false, true}) {
+        for (const auto &size : sizes) {
+
+            GIVEN("a random " + std::to_string(size[0]) + "x" + std::to_string(size[1]) +
+                  (toroidal ? " toroidal" : " bounded") + " world on the GPU") {
+
+                const Grid soup = random_soup(size[0], size[1], unsigned(size[0] * 7 + size[1]));
+                World gpu(soup), dense(soup);
+                gpu.set_engine(World::Engine::Gpu);
+
+                THEN("every generation should match the dense engine") {
+
+                    for (int generation = 0; generation < 6; generation++) {
+                        gpu.step(toroidal);
+                        dense.step(toroidal);
+                        REQUIRE(gpu.get_state().to_string() == dense.get_state().to_string());
+                        REQUIRE(gpu.get_alive_cells() == dense.get_alive_cells());
+                    }
+                }
+
+                THEN("advancing without reading the state in between should match too") {
+
+                    World copy = gpu;
+                    gpu.advance(50, toroidal);
+                    dense.advance(50, toroidal);
+                    REQUIRE(gpu.get_generation() == 50);
+                    REQUIRE(gpu.get_state().to_string() == dense.get_state().to_string());
+                    REQUIRE(copy.get_state().to_string() == soup.to_string());
+                }
+
+                THEN("other rules and switching back to the dense engine should keep the cells") {
+
+                    gpu.set_rule(Rule::highlife());
+                    dense.set_rule(Rule::highlife());
+                    gpu.advance(10, toroidal);
+                    dense.advance(10, toroidal);
+                    gpu.set_engine(World::Engine::Dense);
+                    REQUIRE(gpu.get_state().to_string() == dense.get_state().to_string());
+                }
+            }
+        }
+    }
+
+} // SCENARIO
@@ -0,0 +1,145 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <stdexcept>
+
+#include "../gpu_engine.h"
+#include "../grid.h"
+#include "../world.h"
+
+/**
+ * A 300x200 world with a random soup in the middle, far enough from the edges that the engines agree.
+ */
+static Grid padded_soup(unsigned seed) {
+    std::mt19937 random(seed);
+    Grid grid(300, 200);
+    for (int y = 70; y < 130; y++) {
+        for (int x = 120; x < 180; x++) {
+            if (random() % 3 == 0) grid.set(x, y, Cell::ALIVE);
+        }
+    }
+
+    return grid;
+}
+
+SCENARIO("windows of the state match the same part of the whole state", "[world][state]") {
+
+    for (World::Engine engine : {World::Engine::Dense, World::Engine::HashLife}) {
+
+        GIVEN(std::string("a random soup in a 300x200 world on the ") + (engine == World::Engine::Dense ? "dense" : "HashLife") +
+              " engine") {
+
+            World world(padded_soup(46));
+            world.set_engine(engine, true);
+
+            WHEN("it is advanced and a window is taken before the whole state is read") {
+
+                world.advance(37);
+                const Grid window = world.get_state(101, 57, 150, 90);
+                const Grid edge = world.get_state(150, 100, 150, 100);
+
+                THEN("each window should match the whole state cropped to it") {
+
+                    REQUIRE(window.get_width() == 150);
+                    REQUIRE(window.get_height() == 90);
+                    REQUIRE(window.to_string() == world.get_state().crop(101, 57, 251, 147).to_string());
+                    REQUIRE(edge.to_string() == world.get_state().crop(150, 100, 300, 200).to_string());
+                }
+
+                THEN("the whole state should be kept until the next step") {
+
+                    const Grid &first = world.get_state();
+                    const Grid &second = world.get_state();
+                    REQUIRE(&first == &second);
+                    REQUIRE(first.get_alive_cells() == world.get_alive_cells());
+
+                    World dense(padded_soup(46));
+                    dense.advance(37);
+                    REQUIRE(first.to_string() == dense.get_state().to_string());
+                }
+
+                THEN("empty windows and windows at the edges should be allowed") {
+
+                    REQUIRE(world.get_state(0, 0, 0, 0).get_width() == 0);
+                    REQUIRE(world.get_state(300, 200, 0, 0).get_height() == 0);
+                    REQUIRE(world.get_state(0, 0, 300, 200).to_string() == world.get_state().to_string());
+                }
+
+                THEN("windows reaching outside the world should throw") {
+
+                    REQUIRE_THROWS_AS(world.get_state(-1, 0, 10, 10), std::runtime_error);
+                    REQUIRE_THROWS_AS(world.get_state(295, 0, 10, 10), std::runtime_error);
+                    REQUIRE_THROWS_AS(world.get_state(0, 195, 10, 10), std::runtime_error);
+                    REQUIRE_THROWS_AS(world.get_state(0, 0, -1, 10), std::runtime_error);
+                }
+            }
+        }
+    }
+
+} // SCENARIO
+
+SCENARIO("copies of a HashLife world build their own state", "[world][state][hashlife]") {
+
+    GIVEN("a glider on the HashLife engine, copied before it is read") {
+
+        Grid glider(16, 16);
+        glider.set(1, 0, Cell::ALIVE);
+        glider.set(2, 1, Cell::ALIVE);
+        glider.set(0, 2, Cell::ALIVE);
+        glider.set(1, 2, Cell::ALIVE);
+        glider.set(2, 2, Cell::ALIVE);
+
+        World world(glider);
+        world.set_engine(World::Engine::HashLife, true);
+        world.advance(4);
+        World copy = world;
+        world.advance(4);
+
+        THEN("each should see its own generation of the glider") {
+
+            REQUIRE(copy.get_state().get(2, 1) == Cell::ALIVE);
+            REQUIRE(copy.get_state().get(1, 3) == Cell::ALIVE);
+            REQUIRE(world.get_state().get(3, 2) == Cell::ALIVE);
+            REQUIRE(world.get_state().get(2, 4) == Cell::ALIVE);
+            REQUIRE(copy.get_alive_cells() == 5);
+            REQUIRE(world.get_alive_cells() == 5);
+        }
+
+        THEN("switching back to the dense engine should carry on from the latest generation") {
+
+            world.set_engine(World::Engine::Dense);
+            world.advance(4);
+            REQUIRE(world.get_state().get(4, 3) == Cell::ALIVE);
+            REQUIRE(world.get_state().get(3, 5) == Cell::ALIVE);
+            REQUIRE(world.get_alive_cells() == 5);
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("windows of a world on the GPU copy back only their rows", "[world][state][gpu]") {
+
+    if (!GpuEngine::is_available()) return;
+
+    GIVEN("a random soup advanced on the GPU engine and on the dense engine") {
+
+        World gpu(padded_soup(46)), dense(padded_soup(46));
+        gpu.set_engine(World::Engine::Gpu);
+        gpu.advance(29, true);
+        dense.advance(29, true);
+
+        THEN("a window read before the whole state should match the dense engine") {
+
+            const Grid window = gpu.get_state(17, 33, 200, 120);
+            REQUIRE(window.to_string() == dense.get_state().crop(17, 33, 217, 153).to_string());
+            REQUIRE(gpu.get_state().to_string() == dense.get_state().to_string());
+        }
+    } // GIVEN
+
+} // SCENARIO
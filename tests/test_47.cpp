@@ -0,0 +1,173 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <stdexcept>
+
+#include "../grid.h"
+#include "test_util.h"
+
+// Count the set bits past the width of every row, which must always be zero.
+static int padding_bits(const Grid &grid) {
+    int count = 0;
+    for (int y = 0; y < grid.get_height(); y++) {
+        for (int x = grid.get_width(); x < grid.get_words_per_row() * Grid::WORD_BITS; x++) {
+            count += int((grid.row_words(y)[x / Grid::WORD_BITS] >> (x % Grid::WORD_BITS)) & 1);
+        }
+    }
+
+    return count;
+}
+
+SCENARIO("rectangles of cells can be copied between grids at any offset", "[grid][copy_rect]") {
+
+    GIVEN("a random soup and a random target, both a few words wide") {
+
+        const Grid source = random_soup(300, 40, 47);
+        const Grid target = random_soup(250, 50, 7);
+
+        THEN("copying any rectangle should match copying it a cell at a time") {
+
+            std::mt19937 random(3);
+            for (int attempt = 0; attempt < 200; attempt++) {
+                const int x0 = int(random() % 300), x1 = x0 + int(random() % (301 - x0));
+                const int y0 = int(random() % 40), y1 = y0 + int(random() % (41 - y0));
+                const int width = std::min(x1 - x0, 250), height = std::min(y1 - y0, 50);
+                const int x = int(random() % (251 - width)), y = int(random() % (51 - height));
+
+                Grid copied = target, expected = target;
+                copied.copy_rect(source, x0, y0, x0 + width, y0 + height, x, y);
+                for (int dy = 0; dy < height; dy++) {
+                    for (int dx = 0; dx < width; dx++) {
+                        expected.set(x + dx, y + dy, source.get(x0 + dx, y0 + dy));
+                    }
+                }
+
+                REQUIRE(copied.to_string() == expected.to_string());
+                REQUIRE(padding_bits(copied) == 0);
+            }
+        }
+
+        THEN("copying a grid onto itself should behave as if copied through a separate grid") {
+
+            Grid copied = source;
+            copied.copy_rect(copied, 10, 5, 210, 35, 37, 9);
+
+            Grid expected = source;
+            expected.merge(source.crop(10, 5, 210, 35), 37, 9);
+            REQUIRE(copied.to_string() == expected.to_string());
+        }
+
+        THEN("rectangles outside either grid should throw") {
+
+            Grid copied = target;
+            REQUIRE_THROWS_AS(copied.copy_rect(source, -1, 0, 10, 10, 0, 0), std::runtime_error);
+            REQUIRE_THROWS_AS(copied.copy_rect(source, 0, 0, 301, 10, 0, 0), std::runtime_error);
+            REQUIRE_THROWS_AS(copied.copy_rect(source, 10, 0, 5, 10, 0, 0), std::runtime_error);
+            REQUIRE_THROWS_AS(copied.copy_rect(source, 0, 0, 10, 10, 241, 0), std::runtime_error);
+            REQUIRE_THROWS_AS(copied.copy_rect(source, 0, 0, 10, 10, 0, -1), std::runtime_error);
+            REQUIRE_NOTHROW(copied.copy_rect(source, 0, 0, 0, 0, 250, 50));
+            REQUIRE(copied.to_string() == target.to_string());
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("rectangles of cells can be filled a word at a time", "[grid][fill]") {
+
+    GIVEN("a random soup a few words wide") {
+
+        Grid grid = random_soup(200, 30, 47);
+        const Grid original = grid;
+
+        WHEN("a rectangle crossing several words is filled alive and another dead") {
+
+            grid.fill(5, 3, 190, 12, Cell::ALIVE);
+            grid.fill(60, 20, 130, 30, Cell::DEAD);
+
+            THEN("only the cells of the rectangles should change") {
+
+                for (int y = 0; y < 30; y++) {
+                    for (int x = 0; x < 200; x++) {
+                        Cell expected = original.get(x, y);
+                        if (x >= 5 && x < 190 && y >= 3 && y < 12) expected = Cell::ALIVE;
+                        if (x >= 60 && x < 130 && y >= 20) expected = Cell::DEAD;
+                        REQUIRE(grid.get(x, y) == expected);
+                    }
+                }
+            }
+        }
+
+        WHEN("the whole grid is filled") {
+
+            grid.fill(Cell::ALIVE);
+
+            THEN("every cell should be alive and the padding should stay clear") {
+
+                REQUIRE(grid.get_alive_cells() == grid.get_total_cells());
+                REQUIRE(padding_bits(grid) == 0);
+
+                grid.fill(Cell::DEAD);
+                REQUIRE(grid.get_alive_cells() == 0);
+            }
+        }
+
+        THEN("rectangles outside the grid should throw and leave it alone") {
+
+            REQUIRE_THROWS_AS(grid.fill(-1, 0, 10, 10, Cell::ALIVE), std::runtime_error);
+            REQUIRE_THROWS_AS(grid.fill(0, 0, 201, 10, Cell::ALIVE), std::runtime_error);
+            REQUIRE_THROWS_AS(grid.fill(0, 10, 10, 9, Cell::ALIVE), std::runtime_error);
+            REQUIRE_NOTHROW(grid.fill(200, 30, 200, 30, Cell::ALIVE));
+            REQUIRE(grid.to_string() == original.to_string());
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("rows can be read as spans and cells without bounds checks", "[grid][row_span]") {
+
+    GIVEN("a random soup a few words wide") {
+
+        Grid grid = random_soup(130, 5, 47);
+
+        THEN("each row span should cover the packed words of its row") {
+
+            for (int y = 0; y < 5; y++) {
+                Grid::RowSpan span = grid.row_span(y);
+                REQUIRE(span.size() == grid.get_words_per_row());
+                REQUIRE(span.begin() == grid.row_words(y));
+
+                int alive = 0;
+                for (Grid::Word word : span) alive += __builtin_popcountll(word);
+                int expected = 0;
+                for (int x = 0; x < 130; x++) expected += grid.get(x, y) == Cell::ALIVE;
+                REQUIRE(alive == expected);
+            }
+
+            const Grid &read_only = grid;
+            REQUIRE(read_only.row_span(4)[2] == grid.row_words(4)[2]);
+            REQUIRE_THROWS_AS(grid.row_span(5), std::runtime_error);
+            REQUIRE_THROWS_AS(read_only.row_span(-1), std::runtime_error);
+        }
+
+        THEN("unchecked reads and writes should match the checked ones") {
+
+            for (int y = 0; y < 5; y++) {
+                for (int x = 0; x < 130; x++) {
+                    REQUIRE(grid.get_unchecked(x, y) == grid.get(x, y));
+                }
+            }
+
+            grid.set_unchecked(129, 4, Cell::ALIVE);
+            grid.set_unchecked(64, 0, Cell::DEAD);
+            REQUIRE(grid.get(129, 4) == Cell::ALIVE);
+            REQUIRE(grid.get(64, 0) == Cell::DEAD);
+        }
+    } // GIVEN
+
+} // SCENARIO
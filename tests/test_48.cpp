@@ -0,0 +1,74 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include "../grid.h"
+#include "test_util.h"
+
+// Turn a grid a quarter turn clockwise one cell at a time, the slow and obvious way.
+static Grid reference_quarter_turn(const Grid &grid) {
+    Grid rotated(grid.get_height(), grid.get_width());
+    for (int y = 0; y < grid.get_height(); y++) {
+        for (int x = 0; x < grid.get_width(); x++) {
+            rotated.set(grid.get_height() - 1 - y, x, grid.get(x, y));
+        }
+    }
+
+    return rotated;
+}
+
+SCENARIO("quarter turns of grids larger than a block match turning them a cell at a time", "[grid][rotate]") {
+
+    GIVEN("random soups with edges either side of the 64 cell blocks") {
+
+        const int sizes[][2] = {{17, 3}, {64, 64}, {65, 63}, {130, 7}, {7, 130}, {200, 129}, {1, 300}};
+
+        THEN("every quarter turn should match the reference") {
+
+            for (const auto &size : sizes) {
+                const Grid grid = random_soup(size[0], size[1], unsigned(size[0] * 1000 + size[1]));
+                const Grid once = reference_quarter_turn(grid);
+                const Grid thrice = reference_quarter_turn(reference_quarter_turn(once));
+
+                REQUIRE(grid.rotate(1).to_string() == once.to_string());
+                REQUIRE(grid.rotate(-3).to_string() == once.to_string());
+                REQUIRE(grid.rotate(3).to_string() == thrice.to_string());
+                REQUIRE(grid.rotate(-1).to_string() == thrice.to_string());
+                REQUIRE(grid.rotate(1).rotate(3).to_string() == grid.to_string());
+                REQUIRE(grid.rotate(1).get_alive_cells() == grid.get_alive_cells());
+            }
+        }
+    } // GIVEN
+
+    GIVEN("a large sparse board with a few cells far apart") {
+
+        Grid board(1000, 700);
+        board.set(0, 0, Cell::ALIVE);
+        board.set(999, 0, Cell::ALIVE);
+        board.set(500, 350, Cell::ALIVE);
+        board.set(3, 699, Cell::ALIVE);
+
+        THEN("the cells should land where a quarter turn puts them") {
+
+            const Grid once = board.rotate(1), thrice = board.rotate(3);
+            REQUIRE(once.get_width() == 700);
+            REQUIRE(once.get_height() == 1000);
+            REQUIRE(once.get_alive_cells() == 4);
+            REQUIRE(once.get(699, 0) == Cell::ALIVE);
+            REQUIRE(once.get(699, 999) == Cell::ALIVE);
+            REQUIRE(once.get(349, 500) == Cell::ALIVE);
+            REQUIRE(once.get(0, 3) == Cell::ALIVE);
+
+            REQUIRE(thrice.get_alive_cells() == 4);
+            REQUIRE(thrice.get(0, 999) == Cell::ALIVE);
+            REQUIRE(thrice.get(0, 0) == Cell::ALIVE);
+            REQUIRE(thrice.get(350, 499) == Cell::ALIVE);
+            REQUIRE(thrice.get(699, 996) == Cell::ALIVE);
+        }
+    } // GIVEN
+
+} // SCENARIO
@@ -0,0 +1,105 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+
+#include "../grid.h"
+#include "../world.h"
+#include "../zoo.h"
+#include "test_util.h"
+
+// Resize a grid one cell at a time, the slow and obvious way.
+static Grid reference_resize(const Grid &grid, int width, int height, int x0, int y0) {
+    Grid resized(width, height);
+    for (int y = 0; y < grid.get_height(); y++) {
+        for (int x = 0; x < grid.get_width(); x++) {
+            if (resized.valid_coordinate(x + x0, y + y0)) resized.set(x + x0, y + y0, grid.get(x, y));
+        }
+    }
+
+    return resized;
+}
+
+SCENARIO("grids can be resized with their content moved to any offset", "[grid][resize]") {
+
+    GIVEN("a random soup a few words wide") {
+
+        const Grid grid = random_soup(150, 40, 49);
+
+        THEN("any new size and offset should match resizing a cell at a time") {
+
+            std::mt19937 random(5);
+            for (int attempt = 0; attempt < 300; attempt++) {
+                const int width = int(random() % 300), height = int(random() % 80);
+                const int x = int(random() % 300) - 150, y = int(random() % 80) - 40;
+
+                Grid resized = grid;
+                resized.resize(width, height, x, y);
+
+                REQUIRE(resized.get_width() == width);
+                REQUIRE(resized.get_height() == height);
+                REQUIRE(resized.get_words_per_row() == (width + 63) / 64);
+                REQUIRE(resized.to_string() == reference_resize(grid, width, height, x, y).to_string());
+                REQUIRE(resized.get_alive_cells() == reference_resize(grid, width, height, x, y).get_alive_cells());
+            }
+        }
+
+        THEN("growing at the left and top and shrinking back should restore the soup") {
+
+            Grid resized = grid;
+            resized.resize(150 + 64 + 3, 40 + 10, 64 + 3, 10);
+            REQUIRE(resized.crop(67, 10, 217, 50).to_string() == grid.to_string());
+            REQUIRE(resized.get_alive_cells() == grid.get_alive_cells());
+
+            resized.resize(150, 40, -67, -10);
+            REQUIRE(resized.to_string() == grid.to_string());
+        }
+
+        THEN("shrinking should keep the same storage") {
+
+            Grid resized = grid;
+            const Grid::Word *storage = resized.row_words(0);
+            resized.resize(100, 20);
+            REQUIRE(resized.row_words(0) == storage);
+            resized.resize(60, 20, -5, -3);
+            REQUIRE(resized.row_words(0) == storage);
+            REQUIRE(resized.to_string() == reference_resize(grid.crop(0, 0, 100, 20), 60, 20, -5, -3).to_string());
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("worlds can grow at any edge as their patterns spread", "[world][resize]") {
+
+    GIVEN("a glider heading up and to the left, close to the top left corner") {
+
+        Grid start(8, 8);
+        start.merge(Zoo::glider().rotate(2), 5, 5);
+        World world(start);
+        world.advance(8);
+        REQUIRE(world.get_alive_cells() == 5);
+
+        WHEN("the world is grown by 20 cells at the left and top") {
+
+            World grown = world;
+            grown.resize(28, 28, 20, 20);
+
+            THEN("the glider should keep flying into the new space") {
+
+                REQUIRE(grown.get_alive_cells() == 5);
+                REQUIRE(grown.get_state().crop(20, 20, 28, 28).to_string() == world.get_state().to_string());
+
+                world.advance(40);
+                grown.advance(40);
+                REQUIRE(world.get_alive_cells() < 5);
+                REQUIRE(grown.get_alive_cells() == 5);
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
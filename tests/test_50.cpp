@@ -0,0 +1,138 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+
+#include "../grid.h"
+#include "../pattern_library.h"
+#include "../zoo.h"
+
+// Reflect a grid left to right one cell at a time, the slow and obvious way.
+static Grid reference_mirror(const Grid &grid) {
+    Grid mirrored(grid.get_width(), grid.get_height());
+    for (int y = 0; y < grid.get_height(); y++) {
+        for (int x = 0; x < grid.get_width(); x++) {
+            mirrored.set(grid.get_width() - 1 - x, y, grid.get(x, y));
+        }
+    }
+
+    return mirrored;
+}
+
+SCENARIO("the pattern library holds every creature of the zoo in all eight orientations", "[pattern_library]") {
+
+    GIVEN("a new pattern library") {
+
+        const PatternLibrary library;
+
+        THEN("it should hold the zoo creatures by name") {
+
+            REQUIRE(library.size() == 3);
+            REQUIRE(library.contains("glider"));
+            REQUIRE(library.contains("r_pentomino"));
+            REQUIRE(library.contains("light_weight_spaceship"));
+            REQUIRE_FALSE(library.contains("gosper_glider_gun"));
+            REQUIRE(library.get_name(library.find("glider")) == "glider");
+            REQUIRE_THROWS_AS(library.find("gosper_glider_gun"), std::runtime_error);
+        }
+
+        THEN("each orientation should be a turn of the creature or of its mirror image") {
+
+            const Grid spaceship = Zoo::light_weight_spaceship();
+            const Grid mirrored = reference_mirror(spaceship);
+            for (int turns = 0; turns < 4; turns++) {
+                REQUIRE(library.get("light_weight_spaceship", turns).to_string() == spaceship.rotate(turns).to_string());
+                REQUIRE(library.get("light_weight_spaceship", 4 + turns).to_string() ==
+                        mirrored.rotate(turns).to_string());
+            }
+
+            std::set<std::string> gliders;
+            for (int orientation = 0; orientation < PatternLibrary::ORIENTATIONS; orientation++) {
+                gliders.insert(library.get("glider", orientation).to_string());
+            }
+            REQUIRE(gliders.size() == 8);
+        }
+
+        THEN("unknown patterns and orientations should throw") {
+
+            REQUIRE_THROWS_AS(library.get(3), std::runtime_error);
+            REQUIRE_THROWS_AS(library.get(-1), std::runtime_error);
+            REQUIRE_THROWS_AS(library.get(0, 8), std::runtime_error);
+            REQUIRE_THROWS_AS(library.get("glider", -1), std::runtime_error);
+        }
+
+        WHEN("patterns are stamped into a grid") {
+
+            Grid grid(64, 64);
+            grid.set(0, 0, Cell::ALIVE);
+            const int glider = library.find("glider");
+            library.stamp(grid, glider, 0, 0, 0);
+            library.stamp(grid, glider, 5, 60, 60);
+
+            THEN("their alive cells should be merged in where they were placed") {
+
+                REQUIRE(grid.get(0, 0) == Cell::ALIVE);
+                REQUIRE(grid.crop(0, 0, 3, 3).to_string() != Zoo::glider().to_string());
+                REQUIRE(grid.crop(60, 60, 63, 63).to_string() == library.get(glider, 5).to_string());
+                REQUIRE(grid.get_alive_cells() == 11);
+                REQUIRE_THROWS(library.stamp(grid, glider, 0, 62, 0));
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("the pattern library loads a directory of pattern files", "[pattern_library]") {
+
+    GIVEN("a directory of patterns in every format along with a file that is not one") {
+
+        const std::string directory = "../test_outputs/PATTERN_LIBRARY";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+
+        Grid block(2, 2);
+        block.fill(Cell::ALIVE);
+        Zoo::save_ascii(directory + "/block.gol", block);
+        Zoo::save_binary(directory + "/blinker.bgol", Zoo::glider().crop(0, 2, 3, 3));
+        Zoo::save_rle(directory + "/spaceship.rle", Zoo::light_weight_spaceship());
+        Zoo::save_compressed(directory + "/glider.cgol", Zoo::glider().rotate(1));
+        std::ofstream(directory + "/README.txt") << "not a pattern";
+
+        PatternLibrary library;
+        const int added = library.load_directory(directory);
+
+        THEN("each pattern file should be added under the name of its file") {
+
+            REQUIRE(added == 4);
+            REQUIRE(library.size() == 6);
+            REQUIRE(library.get("block").to_string() == block.to_string());
+            REQUIRE(library.get("blinker", 1).get_height() == 3);
+            REQUIRE(library.get("spaceship").to_string() == Zoo::light_weight_spaceship().to_string());
+            REQUIRE_FALSE(library.contains("README"));
+        }
+
+        THEN("a file named after a pattern already held should replace it at the same index") {
+
+            const int glider = library.find("glider");
+            REQUIRE(glider == 0);
+            REQUIRE(library.get(glider).to_string() == Zoo::glider().rotate(1).to_string());
+        }
+
+        THEN("a directory that cannot be read or a broken file should throw") {
+
+            REQUIRE_THROWS_AS(library.load_directory(directory + "/missing"), std::runtime_error);
+
+            std::ofstream(directory + "/broken.gol") << "this is not a grid";
+            REQUIRE_THROWS_AS(library.load_directory(directory), std::runtime_error);
+        }
+    } // GIVEN
+
+} // SCENARIO
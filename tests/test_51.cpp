@@ -0,0 +1,166 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+#include "../grid.h"
+#include "../soup_search.h"
+#include "../world.h"
+#include "../zoo.h"
+
+static bool by_soup(const SoupSearch::Census &a, const SoupSearch::Census &b) {
+    return a.soup < b.soup;
+}
+
+static bool same_census(const SoupSearch::Census &a, const SoupSearch::Census &b) {
+    return a.soup == b.soup && a.population == b.population && a.generation == b.generation &&
+           a.period == b.period && a.x0 == b.x0 && a.y0 == b.y0 && a.x1 == b.x1 && a.y1 == b.y1;
+}
+
+SCENARIO("the census of a soup records how it settled", "[soup_search]") {
+
+    GIVEN("a search of 8x8 soups in 32x32 worlds and a world to run them in") {
+
+        const SoupSearch search(8, 32, 200, 10);
+        World world(32, 32);
+        Grid start(32, 32);
+
+        THEN("a blinker should settle at once into period 2 with its bounding box") {
+
+            start.fill(14, 10, 17, 11, Cell::ALIVE);
+            const SoupSearch::Census census = search.evaluate(world, start, 7);
+
+            REQUIRE(census.soup == 7);
+            REQUIRE(census.population == 3);
+            REQUIRE(census.period == 2);
+            REQUIRE(census.generation <= 2);
+            const int width = census.x1 - census.x0, height = census.y1 - census.y0;
+            REQUIRE(((width == 3 && height == 1) || (width == 1 && height == 3)));
+            REQUIRE(census.x0 >= 14);
+            REQUIRE(census.x1 <= 17);
+        }
+
+        THEN("a lone cell should die out and settle as an empty still life") {
+
+            start.set(3, 3, Cell::ALIVE);
+            const SoupSearch::Census census = search.evaluate(world, start, 0);
+
+            REQUIRE(census.population == 0);
+            REQUIRE(census.period == 1);
+            REQUIRE(census.x0 == 0);
+            REQUIRE(census.x1 == 0);
+        }
+
+        THEN("a glider in a torus should never settle within the generation limit") {
+
+            SoupSearch torus(8, 32, 200, 10);
+            torus.set_toroidal(true);
+            start.merge(Zoo::glider(), 4, 4);
+            const SoupSearch::Census census = torus.evaluate(world, start, 0);
+
+            REQUIRE(census.population == 5);
+            REQUIRE(census.period == 0);
+            REQUIRE(census.generation == 200);
+        }
+
+        THEN("every soup should be the same each time it is made, and only fill the middle of the world") {
+
+            Grid again(32, 32);
+            search.make_soup(12345, start);
+            search.make_soup(12345, again);
+            REQUIRE(start.to_string() == again.to_string());
+            REQUIRE(start.get_alive_cells() > 0);
+            REQUIRE(start.crop(12, 12, 20, 20).get_alive_cells() == start.get_alive_cells());
+
+            search.make_soup(12346, again);
+            REQUIRE(start.to_string() != again.to_string());
+        }
+
+        THEN("sizes and limits out of range should throw") {
+
+            REQUIRE_THROWS_AS(SoupSearch(0, 32, 200, 10), std::runtime_error);
+            REQUIRE_THROWS_AS(SoupSearch(65, 128, 200, 10), std::runtime_error);
+            REQUIRE_THROWS_AS(SoupSearch(16, 8, 200, 10), std::runtime_error);
+            REQUIRE_THROWS_AS(SoupSearch(16, 32, -1, 10), std::runtime_error);
+            REQUIRE_THROWS_AS(SoupSearch(16, 32, 200, 0), std::runtime_error);
+            World small(16, 16);
+            REQUIRE_THROWS_AS(search.evaluate(small, start, 0), std::runtime_error);
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("a search runs every soup once whatever the number of workers", "[soup_search]") {
+
+    GIVEN("a search of 1000 soups run on one worker and on seven") {
+
+        SoupSearch search(8, 32, 300, 12);
+        search.set_seed(51);
+
+        search.set_threads(1);
+        const SoupSearch::Summary alone = search.run(5000, 1000, "../test_outputs/SOUP_CENSUS_ALONE.bin");
+        search.set_threads(7);
+        const SoupSearch::Summary shared = search.run(5000, 1000, "../test_outputs/SOUP_CENSUS_SHARED.bin");
+
+        std::vector<SoupSearch::Census> first = SoupSearch::load_census("../test_outputs/SOUP_CENSUS_ALONE.bin");
+        std::vector<SoupSearch::Census> second = SoupSearch::load_census("../test_outputs/SOUP_CENSUS_SHARED.bin");
+        std::sort(first.begin(), first.end(), by_soup);
+        std::sort(second.begin(), second.end(), by_soup);
+
+        THEN("each soup should have one record, with the same census from either search") {
+
+            REQUIRE(first.size() == 1000);
+            REQUIRE(second.size() == 1000);
+            for (std::size_t i = 0; i < first.size(); i++) {
+                REQUIRE(first[i].soup == 5000 + i);
+                REQUIRE(same_census(first[i], second[i]));
+            }
+        }
+
+        THEN("the summaries should agree with the records and each other") {
+
+            std::uint64_t settled = 0, extinct = 0;
+            for (const SoupSearch::Census &census : first) {
+                settled += census.period > 0;
+                extinct += census.population == 0;
+            }
+
+            REQUIRE(alone.soups == 1000);
+            REQUIRE(alone.settled == settled);
+            REQUIRE(alone.extinct == extinct);
+            REQUIRE(shared.soups == alone.soups);
+            REQUIRE(shared.settled == alone.settled);
+            REQUIRE(shared.generations == alone.generations);
+            REQUIRE(shared.periods == alone.periods);
+        }
+
+        THEN("running each soup on its own should give the same census") {
+
+            World world(32, 32);
+            Grid start(32, 32);
+            for (std::size_t i = 0; i < first.size(); i += 97) {
+                search.make_soup(first[i].soup, start);
+                REQUIRE(same_census(search.evaluate(world, start, first[i].soup), first[i]));
+            }
+        }
+    } // GIVEN
+
+    GIVEN("census files that are broken") {
+
+        std::ofstream("../test_outputs/SOUP_CENSUS_BAD.bin") << "GOLX and then some more bytes to pass the header";
+
+        THEN("loading them should throw") {
+
+            REQUIRE_THROWS_AS(SoupSearch::load_census("../test_outputs/SOUP_CENSUS_BAD.bin"), std::runtime_error);
+            REQUIRE_THROWS_AS(SoupSearch::load_census("../test_outputs/SOUP_CENSUS_MISSING.bin"), std::runtime_error);
+        }
+    } // GIVEN
+
+} // SCENARIO
@@ -0,0 +1,241 @@
+/**
+ * @author 962940
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../frame_stream.h"
+#include "../grid.h"
+#include "../world.h"
+#include "../zoo.h"
+
+// A world whose width is not a whole number of words, with a random soup across all of it.
+static World soup_world(int width, int height, unsigned seed) {
+    std::mt19937 random(seed);
+    Grid grid(width, height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (random() % 3 == 0) grid.set(x, y, Cell::ALIVE);
+        }
+    }
+
+    return World(grid);
+}
+
+// Step a world, streaming every generation, and keep each frame to compare against.
+static std::vector<Grid> stream_steps(FrameWriter &writer, World &world, int steps) {
+    std::vector<Grid> frames;
+    for (int step = 0; step <= steps; step++) {
+        if (step > 0) world.step();
+        frames.push_back(world.get_state());
+        writer.submit(frames.back(), world.get_generation());
+    }
+    writer.wait();
+
+    return frames;
+}
+
+SCENARIO("a frame stream reads back every frame that was written", "[frame_stream]") {
+
+    const FrameWriter::Encoding encodings[] = {FrameWriter::Encoding::Delta, FrameWriter::Encoding::Bitplanes};
+    for (const FrameWriter::Encoding encoding : encodings) {
+
+        GIVEN(std::string("a soup streamed for 40 generations as ") +
+              (encoding == FrameWriter::Encoding::Delta ? "deltas" : "bitplanes") + " through a short queue") {
+
+            World world = soup_world(100, 70, 52);
+            std::stringstream stream;
+            FrameWriter writer(stream, 100, 70, encoding, false, 5, 2);
+            const std::vector<Grid> frames = stream_steps(writer, world, 40);
+
+            THEN("every frame should be written, counting every byte of the stream") {
+
+                REQUIRE(writer.get_frames_written() == 41);
+                REQUIRE(writer.get_bytes_written() == stream.str().size());
+            }
+
+            THEN("reading the stream should give back each frame and its generation in order, then stop") {
+
+                FrameReader reader(stream);
+                REQUIRE(reader.get_width() == 100);
+                REQUIRE(reader.get_height() == 70);
+
+                Grid frame;
+                std::uint64_t generation = 0;
+                for (std::size_t i = 0; i < frames.size(); i++) {
+                    REQUIRE(reader.next(frame, generation));
+                    REQUIRE(generation == i);
+                    REQUIRE(frame.to_string() == frames[i].to_string());
+                }
+                REQUIRE_FALSE(reader.next(frame, generation));
+                REQUIRE(generation == 40);
+            }
+        } // GIVEN
+    }
+
+} // SCENARIO
+
+SCENARIO("a frame stream picks between deltas and key frames by size", "[frame_stream]") {
+
+    GIVEN("a glider crossing a 256x256 world, streamed as deltas and as bitplanes") {
+
+        Grid grid(256, 256);
+        grid.merge(Zoo::glider(), 20, 20);
+
+        World deltas_world(grid), bitplanes_world(grid);
+        std::stringstream deltas, bitplanes;
+        FrameWriter deltas_writer(deltas, 256, 256, FrameWriter::Encoding::Delta, false, 0);
+        FrameWriter bitplanes_writer(bitplanes, 256, 256, FrameWriter::Encoding::Bitplanes);
+        stream_steps(deltas_writer, deltas_world, 20);
+        stream_steps(bitplanes_writer, bitplanes_world, 20);
+
+        THEN("bitplanes should hold every word of every frame") {
+
+            REQUIRE(bitplanes.str().size() == 16 + 21 * (20 + 256 * 4 * 8));
+        }
+
+        THEN("deltas should hold one key frame and a few changed words a frame after it") {
+
+            REQUIRE(deltas.str().size() < 16 + (20 + 256 * 4 * 8) + 20 * (20 + 64));
+        }
+    } // GIVEN
+
+    GIVEN("frames that change every word, streamed as deltas") {
+
+        Grid empty(128, 3), full(128, 3);
+        full.fill(Cell::ALIVE);
+
+        std::stringstream stream;
+        FrameWriter writer(stream, 128, 3);
+        for (int i = 0; i < 6; i++) writer.submit(i % 2 ? full : empty, std::uint64_t(i));
+        writer.wait();
+
+        THEN("each frame should fall back to a key frame, no bigger than bitplanes") {
+
+            REQUIRE(stream.str().size() == 16 + 6 * (20 + 6 * 8));
+
+            FrameReader reader(stream);
+            Grid frame;
+            std::uint64_t generation = 0;
+            for (int i = 0; i < 6; i++) {
+                REQUIRE(reader.next(frame, generation));
+                REQUIRE(frame.get_alive_cells() == (i % 2 ? 128u * 3 : 0u));
+            }
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("frame streams report what goes wrong with them", "[frame_stream]") {
+
+    GIVEN("a writer of 32x32 frames") {
+
+        std::stringstream stream;
+        FrameWriter writer(stream, 32, 32);
+
+        THEN("frames of another size should be refused") {
+
+            REQUIRE_THROWS_AS(writer.submit(Grid(32, 31), 0), std::runtime_error);
+            REQUIRE_THROWS_AS(writer.submit(Grid(64, 32), 0), std::runtime_error);
+        }
+
+        THEN("a stream that fails should throw from the next wait") {
+
+            stream.setstate(std::ios::badbit);
+            writer.submit(Grid(32, 32), 0);
+            REQUIRE_THROWS_AS(writer.wait(), std::runtime_error);
+        }
+    } // GIVEN
+
+    GIVEN("writers asked for sizes, intervals or queues out of range") {
+
+        std::stringstream stream;
+
+        THEN("they should throw") {
+
+            REQUIRE_THROWS_AS(FrameWriter(stream, -1, 32), std::runtime_error);
+            REQUIRE_THROWS_AS(FrameWriter(stream, 32, 32, FrameWriter::Encoding::Delta, false, -1),
+                              std::runtime_error);
+            REQUIRE_THROWS_AS(FrameWriter(stream, 32, 32, FrameWriter::Encoding::Delta, false, 256, 0),
+                              std::runtime_error);
+        }
+    } // GIVEN
+
+    GIVEN("streams that are broken") {
+
+        Grid grid(128, 128);
+        grid.merge(Zoo::glider(), 10, 10);
+        World world(grid);
+        std::stringstream stream;
+        {
+            FrameWriter writer(stream, 128, 128);
+            stream_steps(writer, world, 2);
+        }
+        const std::string bytes = stream.str();
+        const std::size_t key_bytes = 20 + 128 * 2 * 8;
+
+        THEN("one without the magic bytes should not be read") {
+
+            std::stringstream broken("GOLX" + bytes.substr(4));
+            REQUIRE_THROWS_AS(FrameReader(broken), std::runtime_error);
+        }
+
+        THEN("one cut off part way through a frame should throw at that frame") {
+
+            std::stringstream broken(bytes.substr(0, bytes.size() - 3));
+            FrameReader reader(broken);
+            Grid frame;
+            std::uint64_t generation = 0;
+            REQUIRE(reader.next(frame, generation));
+            REQUIRE(reader.next(frame, generation));
+            REQUIRE_THROWS_AS(reader.next(frame, generation), std::runtime_error);
+        }
+
+        THEN("one starting with a delta should throw, as it has nothing to apply to") {
+
+            std::stringstream broken(bytes.substr(0, 16) + bytes.substr(16 + key_bytes));
+            FrameReader reader(broken);
+            Grid frame;
+            std::uint64_t generation = 0;
+            REQUIRE_THROWS_AS(reader.next(frame, generation), std::runtime_error);
+        }
+    } // GIVEN
+
+} // SCENARIO
+
+SCENARIO("frame streams can be compressed with zstd", "[frame_stream]") {
+
+    std::stringstream stream;
+    if (!FrameWriter::is_compression_available()) {
+        REQUIRE_THROWS_AS(FrameWriter(stream, 32, 32, FrameWriter::Encoding::Delta, true), std::runtime_error);
+        return;
+    }
+
+    GIVEN("a soup streamed as compressed bitplanes") {
+
+        World world = soup_world(200, 100, 7);
+        FrameWriter writer(stream, 200, 100, FrameWriter::Encoding::Bitplanes, true);
+        const std::vector<Grid> frames = stream_steps(writer, world, 30);
+
+        THEN("the stream should read back every frame") {
+
+            FrameReader reader(stream);
+            Grid frame;
+            std::uint64_t generation = 0;
+            for (const Grid &expected : frames) {
+                REQUIRE(reader.next(frame, generation));
+                REQUIRE(frame.to_string() == expected.to_string());
+            }
+            REQUIRE_FALSE(reader.next(frame, generation));
+        }
+    } // GIVEN
+
+} // SCENARIO
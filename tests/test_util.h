@@ -0,0 +1,56 @@
+/**
+ * Declares helpers shared by the tests for building grids and checking steps against.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+#include <random>
+
+#include "../grid.h"
+#include "../rule.h"
+
+/**
+ * Fill a grid with alive cells at random, each alive with a chance of one in three.
+ */
+inline Grid random_soup(int width, int height, unsigned seed) {
+    std::mt19937 random(seed);
+    Grid grid(width, height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (random() % 3 == 0) grid.set(x, y, Cell::ALIVE);
+        }
+    }
+
+    return grid;
+}
+
+/**
+ * Step a grid one cell at a time by a rule, the slow and obvious way, to check the kernels against.
+ */
+inline Grid reference_step(const Grid &grid, const Rule &rule, bool toroidal) {
+    const int width = grid.get_width(), height = grid.get_height();
+    Grid next(width, height);
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int neighbours = 0;
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    if (dx == 0 && dy == 0) continue;
+                    int xx = x + dx, yy = y + dy;
+                    if (toroidal) {
+                        xx = (xx + width) % width;
+                        yy = (yy + height) % height;
+                    }
+                    if (grid.valid_coordinate(xx, yy) && grid.get(xx, yy) == Cell::ALIVE) neighbours++;
+                }
+            }
+            const unsigned mask = grid.get(x, y) == Cell::ALIVE ? rule.get_survival() : rule.get_birth();
+            next.set(x, y, (mask >> neighbours) & 1 ? Cell::ALIVE : Cell::DEAD);
+        }
+    }
+
+    return next;
+}
@@ -0,0 +1,146 @@
+/**
+ * Implements a class representing a persistent pool of worker threads.
+ *      - Pools start their worker threads once on construction and join them on destruction.
+ *      - Pools run a number of numbered tasks and block until every task has finished.
+ *          - The calling thread works through tasks alongside the workers, so a pool of N threads
+ *            starts N - 1 workers.
+ *          - Tasks are handed out one at a time from a shared counter, so uneven tasks balance out.
+ *          - Tasks must not throw.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "thread_pool.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+
+/**
+ * ThreadPool::ThreadPool(threads)
+ *
+ * Construct a pool that runs tasks on the desired number of threads, including the caller's thread.
+ *
+ * @example
+ *
+ *      // Make a pool with one thread per hardware thread
+ *      ThreadPool pool(std::thread::hardware_concurrency());
+ *
+ *      // This should be a compiler error! We want to prevent this from being allowed.
+ *      ThreadPool other = 4;
+ *
+ * @param threads
+ *      The number of threads to use, values less than 1 are treated as 1.
+ */
+ThreadPool::ThreadPool(int threads) : _generation(0), _stopping(false), _busy(0),
+                                      _invoke(nullptr), _context(nullptr), _tasks(0), _next_task(0) {
+    for (int i = 1; i < threads; i++) {
+        _workers.emplace_back(&ThreadPool::work, this);
+    }
+}
+
+/**
+ * ThreadPool::~ThreadPool()
+ *
+ * Wake and join every worker thread.
+ */
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _start.notify_all();
+
+    for (std::thread &worker : _workers) {
+        worker.join();
+    }
+}
+
+/**
+ * ThreadPool::get_threads()
+ *
+ * Gets the number of threads tasks are run on, including the caller's thread.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of threads.
+ */
+int ThreadPool::get_threads() const {
+    return (int) _workers.size() + 1;
+}
+
+/**
+ * ThreadPool::dispatch(tasks, invoke, context)
+ *
+ * Private helper function behind ThreadPool::run, publishing a batch of tasks and waiting for them.
+ * Only one batch runs at a time, other callers wait their turn.
+ *
+ * @param tasks
+ *      The number of tasks to run.
+ *
+ * @param invoke
+ *      Called as invoke(context, task) for each task.
+ *
+ * @param context
+ *      Passed through to invoke.
+ */
+void ThreadPool::dispatch(int tasks, Invoke invoke, void *context) {
+    // Not worth waking anyone for a single task
+    if (_workers.empty() || tasks <= 1) {
+        for (int task = 0; task < tasks; task++) {
+            invoke(context, task);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(_run_mutex);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _invoke = invoke;
+        _context = context;
+        _tasks = tasks;
+        _next_task.store(0);
+        _busy = (int) _workers.size();
+        _generation++;
+    }
+    _start.notify_all();
+
+    run_tasks();
+
+    // The batch may only be replaced once every worker has stopped looking at it
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done.wait(lock, [this] { return _busy == 0; });
+}
+
+/**
+ * ThreadPool::run_tasks()
+ *
+ * Private helper function to claim and run tasks from the current batch until none are left.
+ */
+void ThreadPool::run_tasks() {
+    for (int task = _next_task.fetch_add(1); task < _tasks; task = _next_task.fetch_add(1)) {
+        _invoke(_context, task);
+    }
+}
+
+/**
+ * ThreadPool::work()
+ *
+ * Private helper function run by each worker thread, sleeping until a new batch is published.
+ */
+void ThreadPool::work() {
+    std::uint64_t seen = 0;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _start.wait(lock, [&] { return _stopping || _generation != seen; });
+            if (_stopping) return;
+            seen = _generation;
+        }
+
+        run_tasks();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (--_busy == 0) _done.notify_one();
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * Declares a class representing a persistent pool of worker threads.
+ * Rich documentation for the api and behaviour the ThreadPool class can be found in thread_pool.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Declare the structure of the ThreadPool class for running numbered tasks in parallel.
+ *
+ * The threads are started once and then sleep between calls to run, so handing out work every
+ * step of a simulation does not pay for creating threads or allocating memory.
+ */
+class ThreadPool {
+private:
+    using Invoke = void (*)(void *context, int task);
+
+    std::vector<std::thread> _workers;
+    std::mutex _mutex, _run_mutex;
+    std::condition_variable _start, _done;
+    std::uint64_t _generation;
+    bool _stopping;
+    int _busy;
+
+    Invoke _invoke;
+    void *_context;
+    int _tasks;
+    std::atomic<int> _next_task;
+
+    void dispatch(int tasks, Invoke invoke, void *context);
+
+    void run_tasks();
+
+    void work();
+
+public:
+    explicit ThreadPool(int threads);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    int get_threads() const;
+
+    /**
+     * Call function(task) for every task in [0, tasks) across the pool, returning once all have finished.
+     * Declared here as the function is forwarded by pointer without being copied or type erased.
+     */
+    template<class Function>
+    void run(int tasks, Function &&function) {
+        using Target = typename std::remove_reference<Function>::type;
+        dispatch(tasks, [](void *context, int task) { (*static_cast<Target *>(context))(task); },
+                 const_cast<void *>(static_cast<const void *>(&function)));
+    }
+};
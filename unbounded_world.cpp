@@ -0,0 +1,456 @@
+/**
+ * Implements a class representing an unbounded Game of Life plane, with no edges for patterns to fall off.
+ *      - UnboundedWorlds can be constructed empty, or from a Grid placed anywhere on the plane.
+ *      - Cells can be read and written at any 64 bit coordinate.
+ *      - UnboundedWorlds can return the bounding box of their alive cells, and export it as a Grid.
+ *
+ *      - The plane is split into CHUNK_SIZE x CHUNK_SIZE chunks, each stored as one packed word per row.
+ *          - Only chunks holding alive cells are kept, in a hash map keyed on the chunk coordinate.
+ *            Chunks that die out are thrown away, so memory follows the population as it moves.
+ *
+ *      - Stepping applies the rules of Conway's Game of Life to every stored chunk, and to each neighbouring
+ *        chunk that an alive cell on the shared edge or corner could give birth into.
+ *          - Each row of a chunk is stepped by the word-parallel kernel, with the rows of the neighbouring
+ *            chunks either side of it supplying the cells across the chunk edges.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "unbounded_world.h"
+#include "kernel.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * chunk_coordinate(coordinate)
+ *
+ * Private helper function to find the chunk a coordinate of the plane falls in, rounding towards minus infinity.
+ */
+static std::int64_t chunk_coordinate(std::int64_t coordinate) {
+    return coordinate >= 0 ? coordinate / UnboundedWorld::CHUNK_SIZE
+                           : -((-(coordinate + 1)) / UnboundedWorld::CHUNK_SIZE) - 1;
+}
+
+/**
+ * chunk_offset(coordinate)
+ *
+ * Private helper function to find the offset of a coordinate of the plane within its chunk.
+ */
+static int chunk_offset(std::int64_t coordinate) {
+    return int(coordinate - chunk_coordinate(coordinate) * UnboundedWorld::CHUNK_SIZE);
+}
+
+/**
+ * UnboundedWorld::Key::operator==(other)
+ *
+ * Compare two chunk coordinates.
+ */
+bool UnboundedWorld::Key::operator==(const Key &other) const {
+    return x == other.x && y == other.y;
+}
+
+/**
+ * UnboundedWorld::KeyHash::operator()(key)
+ *
+ * Hash a chunk coordinate by mixing its two halves.
+ */
+std::size_t UnboundedWorld::KeyHash::operator()(const Key &key) const {
+    std::uint64_t hash = (std::uint64_t(key.x) * 0x9E3779B97F4A7C15ULL) ^ std::uint64_t(key.y);
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    return std::size_t(hash ^ (hash >> 31));
+}
+
+/**
+ * UnboundedWorld::UnboundedWorld()
+ *
+ * Construct an empty unbounded world.
+ *
+ * @example
+ *
+ *      // Make an empty plane
+ *      UnboundedWorld world;
+ */
+UnboundedWorld::UnboundedWorld() : _generation(0) {}
+
+/**
+ * UnboundedWorld::UnboundedWorld(grid, x0, y0)
+ *
+ * Construct an unbounded world holding the alive cells of a grid.
+ *
+ * @example
+ *
+ *      // Put a glider on the plane with its top left corner at (-10, 20)
+ *      UnboundedWorld world(Zoo::glider(), -10, 20);
+ *
+ * @param grid
+ *      The grid to copy onto the plane, its dead cells are ignored.
+ *
+ * @param x0
+ *      Optional parameter. The x coordinate of the plane to place the left column of the grid at. Defaults to 0.
+ *
+ * @param y0
+ *      Optional parameter. The y coordinate of the plane to place the top row of the grid at. Defaults to 0.
+ */
+UnboundedWorld::UnboundedWorld(const Grid &grid, std::int64_t x0, std::int64_t y0) : _generation(0) {
+    for (int y = 0; y < grid.get_height(); y++) {
+        const Grid::Word *row = grid.row_words(y);
+        for (int word = 0; word < grid.get_words_per_row(); word++) {
+            for (Grid::Word bits = row[word]; bits != 0; bits &= bits - 1) {
+                set(x0 + word * Grid::WORD_BITS + __builtin_ctzll(bits), y0 + y, Cell::ALIVE);
+            }
+        }
+    }
+}
+
+/**
+ * UnboundedWorld::get_generation()
+ *
+ * Gets the number of steps the world has been advanced since it was constructed.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The current generation.
+ */
+std::uint64_t UnboundedWorld::get_generation() const {
+    return _generation;
+}
+
+/**
+ * UnboundedWorld::get_alive_cells()
+ *
+ * Counts the number of alive cells on the plane, in time proportional to the number of chunks.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of alive cells.
+ */
+std::uint64_t UnboundedWorld::get_alive_cells() const {
+    std::uint64_t alive = 0;
+    for (const auto &entry : _chunks) {
+        for (Grid::Word row : entry.second) {
+            alive += std::uint64_t(__builtin_popcountll(row));
+        }
+    }
+    return alive;
+}
+
+/**
+ * UnboundedWorld::get_chunk_count()
+ *
+ * Gets the number of chunks currently stored, each of which holds at least one alive cell.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of chunks.
+ */
+std::size_t UnboundedWorld::get_chunk_count() const {
+    return _chunks.size();
+}
+
+/**
+ * UnboundedWorld::find(x, y)
+ *
+ * Private helper function to look up the chunk at a chunk coordinate.
+ *
+ * @return
+ *      A pointer to the chunk, or nullptr if every cell of it is dead.
+ */
+const UnboundedWorld::Chunk *UnboundedWorld::find(std::int64_t x, std::int64_t y) const {
+    auto chunk = _chunks.find(Key{x, y});
+    return chunk == _chunks.end() ? nullptr : &chunk->second;
+}
+
+/**
+ * UnboundedWorld::get(x, y)
+ *
+ * Gets the value of a cell anywhere on the plane.
+ * The function should be callable from a constant context.
+ *
+ * @param x
+ *      The x coordinate of the cell.
+ *
+ * @param y
+ *      The y coordinate of the cell.
+ *
+ * @return
+ *      Cell::ALIVE or Cell::DEAD.
+ */
+Cell UnboundedWorld::get(std::int64_t x, std::int64_t y) const {
+    const Chunk *chunk = find(chunk_coordinate(x), chunk_coordinate(y));
+    if (!chunk) return Cell::DEAD;
+
+    return ((*chunk)[chunk_offset(y)] >> chunk_offset(x)) & 1 ? Cell::ALIVE : Cell::DEAD;
+}
+
+/**
+ * UnboundedWorld::set(x, y, value)
+ *
+ * Sets the value of a cell anywhere on the plane, adding or removing its chunk as needed.
+ *
+ * @param x
+ *      The x coordinate of the cell.
+ *
+ * @param y
+ *      The y coordinate of the cell.
+ *
+ * @param value
+ *      Cell::ALIVE or Cell::DEAD.
+ */
+void UnboundedWorld::set(std::int64_t x, std::int64_t y, Cell value) {
+    const Key key{chunk_coordinate(x), chunk_coordinate(y)};
+    const Grid::Word bit = Grid::Word(1) << chunk_offset(x);
+
+    if (value == Cell::ALIVE) {
+        _chunks[key][chunk_offset(y)] |= bit;
+        return;
+    }
+
+    auto chunk = _chunks.find(key);
+    if (chunk == _chunks.end()) return;
+
+    chunk->second[chunk_offset(y)] &= ~bit;
+    for (Grid::Word row : chunk->second) {
+        if (row != 0) return;
+    }
+    _chunks.erase(chunk);
+}
+
+/**
+ * UnboundedWorld::get_bounds(x0, y0, x1, y1)
+ *
+ * Gets the smallest rectangle holding every alive cell on the plane.
+ * The function should be callable from a constant context.
+ *
+ * @param x0, y0
+ *      Set to the coordinate of the top left alive cell of the rectangle.
+ *
+ * @param x1, y1
+ *      Set to one past the coordinate of the bottom right alive cell of the rectangle.
+ *
+ * @return
+ *      False if there are no alive cells, in which case the bounds are left untouched.
+ */
+bool UnboundedWorld::get_bounds(std::int64_t &x0, std::int64_t &y0, std::int64_t &x1, std::int64_t &y1) const {
+    if (_chunks.empty()) return false;
+
+    x0 = y0 = std::numeric_limits<std::int64_t>::max();
+    x1 = y1 = std::numeric_limits<std::int64_t>::min();
+    for (const auto &entry : _chunks) {
+        const std::int64_t left = entry.first.x * CHUNK_SIZE, top = entry.first.y * CHUNK_SIZE;
+
+        Grid::Word columns = 0;
+        int first = CHUNK_SIZE, last = -1;
+        for (int row = 0; row < CHUNK_SIZE; row++) {
+            if (entry.second[row] == 0) continue;
+
+            columns |= entry.second[row];
+            first = std::min(first, row);
+            last = row;
+        }
+
+        x0 = std::min(x0, left + __builtin_ctzll(columns));
+        x1 = std::max(x1, left + (Grid::WORD_BITS - __builtin_clzll(columns)));
+        y0 = std::min(y0, top + first);
+        y1 = std::max(y1, top + last + 1);
+    }
+    return true;
+}
+
+/**
+ * UnboundedWorld::get_state()
+ *
+ * Exports the bounding box of the alive cells as a Grid, see UnboundedWorld::get_bounds(x0, y0, x1, y1)
+ * for where its top left corner lies on the plane.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Print the whole pattern, however far it has spread
+ *      std::cout << world.get_state() << std::endl;
+ *
+ * @return
+ *      A Grid just big enough to hold every alive cell, or an empty 0x0 grid if there are none.
+ *
+ * @throws
+ *      std::runtime_error if the bounding box is too wide or tall for a Grid.
+ */
+Grid UnboundedWorld::get_state() const {
+    std::int64_t x0, y0, x1, y1;
+    if (!get_bounds(x0, y0, x1, y1)) return Grid();
+
+    if (x1 - x0 > std::numeric_limits<int>::max() || y1 - y0 > std::numeric_limits<int>::max()) {
+        throw std::runtime_error("Pattern is too large to export as a Grid");
+    }
+    return get_state(x0, y0, int(x1 - x0), int(y1 - y0));
+}
+
+/**
+ * UnboundedWorld::get_state(x0, y0, width, height)
+ *
+ * Exports a rectangle of the plane as a Grid, copying whole chunk rows into place a word at a time.
+ * The function should be callable from a constant context.
+ *
+ * @param x0, y0
+ *      The coordinate of the plane to become the top left cell of the grid.
+ *
+ * @param width, height
+ *      The size of the grid.
+ *
+ * @return
+ *      A width x height Grid holding the cells of the rectangle.
+ */
+Grid UnboundedWorld::get_state(std::int64_t x0, std::int64_t y0, int width, int height) const {
+    Grid grid(width, height);
+    const int words = grid.get_words_per_row();
+
+    for (const auto &entry : _chunks) {
+        const std::int64_t left = entry.first.x * CHUNK_SIZE, top = entry.first.y * CHUNK_SIZE;
+        if (left >= x0 + width || left + CHUNK_SIZE <= x0 || top >= y0 + height || top + CHUNK_SIZE <= y0) continue;
+
+        const std::int64_t offset = left - x0;
+        for (int row = 0; row < CHUNK_SIZE; row++) {
+            const std::int64_t y = top + row - y0;
+            const Grid::Word bits = entry.second[row];
+            if (y < 0 || y >= height || bits == 0) continue;
+
+            // Shift the chunk row into the one or two grid words it overlaps
+            Grid::Word *line = grid.row_words(int(y));
+            if (offset < 0) {
+                line[0] |= bits >> -offset;
+                continue;
+            }
+            const int word = int(offset / Grid::WORD_BITS), shift = int(offset % Grid::WORD_BITS);
+            line[word] |= bits << shift;
+            if (shift != 0 && word + 1 < words) line[word + 1] |= bits >> (Grid::WORD_BITS - shift);
+        }
+    }
+
+    // Clear anything shifted into the padding past the right edge
+    const int used = width % Grid::WORD_BITS;
+    for (int y = 0; used != 0 && y < height; y++) {
+        grid.row_words(y)[words - 1] &= (Grid::Word(1) << used) - 1;
+    }
+
+    return grid;
+}
+
+/**
+ * UnboundedWorld::step_chunk(key, next)
+ *
+ * Private helper function to compute the next state of one chunk from it and the eight chunks around it.
+ * Each row is passed to the kernel as the middle word of three, the words either side coming from
+ * the chunks to the west and east, so the kernel sees every neighbour across the chunk edges.
+ *
+ * @param key
+ *      The coordinate of the chunk to step.
+ *
+ * @param next
+ *      Set to the next state of the chunk.
+ */
+void UnboundedWorld::step_chunk(const Key &key, Chunk &next) const {
+    const Chunk *around[3][3];
+    for (int dy = -1; dy <= 1; dy++) {
+        for (int dx = -1; dx <= 1; dx++) {
+            around[dy + 1][dx + 1] = find(key.x + dx, key.y + dy);
+        }
+    }
+
+    for (int y = 0; y < CHUNK_SIZE; y++) {
+        Grid::Word lines[3][3], result[3];
+        for (int line = 0; line < 3; line++) {
+            // Rows past the top and bottom of the chunk come from the chunks above and below
+            int row = y + line - 1, dy = 1;
+            if (row < 0) {
+                row += CHUNK_SIZE;
+                dy = 0;
+            } else if (row >= CHUNK_SIZE) {
+                row -= CHUNK_SIZE;
+                dy = 2;
+            }
+
+            for (int dx = 0; dx < 3; dx++) {
+                const Chunk *chunk = around[dy][dx];
+                lines[line][dx] = chunk ? (*chunk)[row] : 0;
+            }
+        }
+
+        Kernel::step_words(lines[0], lines[1], lines[2], result, 1, 2, 3 * CHUNK_SIZE, false);
+        next[y] = result[1];
+    }
+}
+
+/**
+ * UnboundedWorld::step()
+ *
+ * Take one step in Conway's Game of Life across the whole plane.
+ *
+ * Every stored chunk is stepped, along with each neighbouring chunk sharing an edge or corner with one of
+ * its alive cells, as only those can see a birth. Chunks left with no alive cells are dropped.
+ *
+ * Rules: https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life
+ *      - Any live cell with fewer than two live neighbours dies, as if by underpopulation.
+ *      - Any live cell with two or three live neighbours lives on to the next generation.
+ *      - Any live cell with more than three live neighbours dies, as if by overpopulation.
+ *      - Any dead cell with exactly three live neighbours becomes a live cell, as if by reproduction.
+ */
+void UnboundedWorld::step() {
+    _next_chunks.clear();
+
+    for (const auto &entry : _chunks) {
+        const Chunk &chunk = entry.second;
+        Grid::Word columns = 0;
+        for (Grid::Word row : chunk) {
+            columns |= row;
+        }
+
+        // Work out which sides of the chunk have alive cells on their edge
+        const Grid::Word top = chunk[0], bottom = chunk[CHUNK_SIZE - 1], high = Grid::Word(1) << (CHUNK_SIZE - 1);
+        const bool edges[3][3] = {
+                {(top & 1) != 0,     top != 0,    (top & high) != 0},
+                {(columns & 1) != 0, true,        (columns & high) != 0},
+                {(bottom & 1) != 0,  bottom != 0, (bottom & high) != 0}};
+
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                if (!edges[dy + 1][dx + 1]) continue;
+
+                const Key key{entry.first.x + dx, entry.first.y + dy};
+                auto next = _next_chunks.emplace(key, Chunk());
+                if (next.second) step_chunk(key, next.first->second);
+            }
+        }
+    }
+
+    // Drop the chunks that died out
+    for (auto next = _next_chunks.begin(); next != _next_chunks.end();) {
+        bool empty = true;
+        for (Grid::Word row : next->second) {
+            empty = empty && row == 0;
+        }
+        next = empty ? _next_chunks.erase(next) : std::next(next);
+    }
+
+    std::swap(_chunks, _next_chunks);
+    _generation++;
+}
+
+/**
+ * UnboundedWorld::advance(steps)
+ *
+ * Advance multiple steps in the Game of Life.
+ * Should be implemented by invoking UnboundedWorld::step().
+ *
+ * @param steps
+ *      The number of steps to advance the world forward.
+ */
+void UnboundedWorld::advance(int steps) {
+    for (int i = 0; i < steps; i++) {
+        step();
+    }
+}
@@ -0,0 +1,74 @@
+/**
+ * Declares a class representing an unbounded Game of Life plane stored as a sparse set of chunks.
+ * Rich documentation for the api and behaviour the UnboundedWorld class can be found in unbounded_world.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * Declare the structure of the UnboundedWorld class for simulating patterns without edges.
+ *
+ * The plane is split into square chunks of CHUNK_SIZE x CHUNK_SIZE cells, bit-packed a row to a word.
+ *      - Only chunks holding at least one alive cell are stored, in a hash map keyed on the chunk coordinate.
+ *      - Memory scales with the number of chunks the pattern currently covers, not the area it has visited.
+ */
+class UnboundedWorld {
+public:
+    static const int CHUNK_SIZE = Grid::WORD_BITS;
+
+private:
+    struct Key {
+        std::int64_t x, y;
+
+        bool operator==(const Key &other) const;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key &key) const;
+    };
+
+    using Chunk = std::array<Grid::Word, CHUNK_SIZE>;
+    using Chunks = std::unordered_map<Key, Chunk, KeyHash>;
+
+    Chunks _chunks, _next_chunks;
+    std::uint64_t _generation;
+
+    const Chunk *find(std::int64_t x, std::int64_t y) const;
+
+    void step_chunk(const Key &key, Chunk &next) const;
+
+public:
+    UnboundedWorld();
+
+    explicit UnboundedWorld(const Grid &grid, std::int64_t x0 = 0, std::int64_t y0 = 0);
+
+    std::uint64_t get_generation() const;
+
+    std::uint64_t get_alive_cells() const;
+
+    std::size_t get_chunk_count() const;
+
+    Cell get(std::int64_t x, std::int64_t y) const;
+
+    void set(std::int64_t x, std::int64_t y, Cell value);
+
+    bool get_bounds(std::int64_t &x0, std::int64_t &y0, std::int64_t &x1, std::int64_t &y1) const;
+
+    Grid get_state() const;
+
+    Grid get_state(std::int64_t x0, std::int64_t y0, int width, int height) const;
+
+    void step();
+
+    void advance(int steps);
+};
@@ -7,12 +7,62 @@
  *
  *      - A World holds two equally sized Grid objects for the current state and next state.
  *          - These buffers are swapped after each update step.
+ *          - The next state buffer is allocated along with the current state and reused every step,
+ *            as each step overwrites every word of it. Stepping and advancing never touch the heap.
  *
  *      - Stepping a world forward in time applies the rules of Conway's Game of Life.
  *          - https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life
- *
- *      - Worlds have a private helper function used to count the number of alive cells in a 3x3 neighbours
- *        around a given cell.
+ *          - Any other Life-like rule in B/S notation can be used instead, such as HighLife or Seeds, see rule.cpp.
+ *
+ *      - Worlds are updated a whole bit-packed row at a time by the word-parallel rule in kernel.cpp,
+ *        which counts the alive cells in the 3x3 neighbourhood of 64 cells at once.
+ *
+ *      - Worlds are split into tiles of TILE_ROWS rows by TILE_WORDS packed words, which remember whether
+ *        any of their cells changed in the last step.
+ *          - A tile can only change if it or one of the eight tiles around it changed last step, so only
+ *            those tiles are recomputed. Still lifes and empty space cost nothing once they settle.
+ *          - The rest are left alone. Their next state buffer already holds the same cells, as they did
+ *            not change when it was the current state.
+ *          - When most tiles are active the whole world is stepped without looking at the tiles.
+ *          - Long runs of tiles are stepped in blocks of BLOCK_WORDS words, each block all the way down its
+ *            row of tiles before the next, so a wide world is swept within the L2 cache rather than row by row.
+ *
+ *      - Worlds keep count of their population, so reading it takes constant time.
+ *          - Each step adds the change in population of the words it changed, counted with popcount.
+ *
+ *      - Worlds can watch for their state repeating, to stop still lifes and oscillators early.
+ *          - A 64 bit hash of the state is kept, made by XORing together a hash of each non-empty word and
+ *            its position. Each step updates it from only the words that changed, never rescanning the grid.
+ *          - A hash matching one of the last max_period generations is a candidate cycle, which is confirmed
+ *            exactly by checking the state comes round again the same number of steps later.
+ *          - Once a cycle is confirmed, advancing skips over whole periods without stepping them.
+ *
+ *      - Worlds can report each step to a Metrics recorder, see metrics.cpp.
+ *          - Without a recorder no clock is read and no extra counting is done, so it costs one test per step.
+ *          - Cells changed are counted with popcount from the words that changed, alongside the population.
+ *
+ *      - Worlds can step large grids in parallel, splitting the tiles into one horizontal band per thread.
+ *          - Bands only ever read the current state and write their own rows of the next state,
+ *            so the rows either side of a band (including those wrapped around a torus) need no copying.
+ *          - The threads live in a persistent ThreadPool shared by copies of the world.
+ *
+ *      - Worlds can advance several generations of a band of tiles before moving on to the next band.
+ *          - Each band is stepped k generations deep in two small scratch buffers, starting from the band
+ *            and k rows either side of it. The rows computed shrink by one at each end every generation,
+ *            leaving exactly the band after k, so every generation reads only cells already computed.
+ *          - The scratch rows stay in cache, so the world is read and written once per k generations
+ *            instead of every generation, at the cost of recomputing the overlapping halos.
+ *          - Every tile of a band is stepped, so it suits busy worlds rather than sparse ones.
+ *
+ *      - Worlds can switch to a HashLife engine to advance vast numbers of generations of a pattern.
+ *          - The world becomes a window onto an unbounded plane, so cells that leave the window are not
+ *            killed at its edge but keep evolving out of sight, and can later come back in.
+ *          - Toroidal worlds cannot be advanced this way.
+ *
+ *      - Worlds can switch to a GPU engine to step dense soups in device memory, see gpu_engine.cu.
+ *          - The cells stay on the device across steps, and are only copied back into the current state
+ *            when it or the population is read, so a checkpoint or a printed frame is what costs a copy.
+ *          - Builds without CUDA have no GPU engine, and switching to it throws.
  *
  *      - Updating the world state can conditionally be performed using a toroidal topology.
  *          - Moving off the left edge you appear on the right edge and vice versa.
@@ -22,9 +72,57 @@
  * @date March, 2020
  */
 #include "world.h"
+#include "kernel.h"
 
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
 #include <utility>
 
+/**
+ * The fewest packed words worth handing to a thread of their own, smaller bands cost more to wake a
+ * thread for than they take to step.
+ */
+static const int MIN_BAND_WORDS = 4096;
+
+/**
+ * The size of the tiles that track which parts of the world are changing, in rows and packed words.
+ */
+static const int TILE_ROWS = 64;
+static const int TILE_WORDS = 1;
+
+/**
+ * The widest block of packed words stepped down a whole row of tiles at a time. The TILE_ROWS + 2 rows
+ * of a block all fit in the L2 cache, however wide the world is.
+ */
+static const int BLOCK_WORDS = 256;
+
+/**
+ * word_hash(word, position)
+ *
+ * Private helper function to hash a packed word at a position of the grid, empty words hash to zero.
+ */
+static std::uint64_t word_hash(Grid::Word word, std::uint64_t position) {
+    if (word == 0) return 0;
+
+    std::uint64_t hash = word ^ (position * 0x9E3779B97F4A7C15ULL);
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return (hash ^ (hash >> 31)) | 1;
+}
+
+/**
+ * same_cells(a, b)
+ *
+ * Private helper function to compare two equally sized grids a packed word at a time.
+ */
+static bool same_cells(const Grid &a, const Grid &b) {
+    for (int y = 0; y < a.get_height(); y++) {
+        if (!std::equal(a.row_words(y), a.row_words(y) + a.get_words_per_row(), b.row_words(y))) return false;
+    }
+    return true;
+}
+
 // Include the minimal number of headers needed to support your implementation.
 // #include ...
 
@@ -98,8 +196,12 @@ World::World(int width, int height) : World(Grid(width, height)) {}
  * @param initial_state
  *      The state of the constructed world.
  */
-World::World(Grid grid) {
+World::World(Grid grid)
+        : _engine(Engine::Dense), _state_stale(false), _toroidal(false), _population(0), _generation(0), _hash(0), _max_period(0), _cycle_period(0),
+          _candidate_period(0), _cycle_generation(0), _candidate_generation(0), _history_generation(0),
+          _metrics(nullptr), _temporal_blocking(1) {
     _current_state = std::move(grid);
+    allocate_buffers();
 }
 
 /**
@@ -186,7 +288,7 @@ int World::get_total_cells() const {
 /**
  * World::get_alive_cells()
  *
- * Counts how many cells in the world are alive.
+ * Counts how many cells in the world are alive, in constant time from the population kept up to date by each step.
  * The function should be callable from a constant context.
  *
  * @example
@@ -207,13 +309,14 @@ int World::get_total_cells() const {
  *      The number of alive cells.
  */
 int World::get_alive_cells() const {
-    return _current_state.get_alive_cells();
+    sync_state();
+    return _population;
 }
 
 /**
  * World::get_dead_cells()
  *
- * Counts how many cells in the world are dead.
+ * Counts how many cells in the world are dead, in constant time from the population.
  * The function should be callable from a constant context.
  *
  * @example
@@ -234,7 +337,8 @@ int World::get_alive_cells() const {
  *      The number of dead cells.
  */
 int World::get_dead_cells() const {
-    return _current_state.get_dead_cells();
+    sync_state();
+    return get_total_cells() - _population;
 }
 
 /**
@@ -244,6 +348,10 @@ int World::get_dead_cells() const {
  * The function should be callable from a constant context.
  * The function should not invoke a copy the current state.
  *
+ * The HashLife and GPU engines keep the cells in their own form, so the first call after they step builds
+ * the grid from it, and later calls return the same grid until the next step. Use
+ * World::get_state(x, y, width, height) to build only a window of the world instead.
+ *
  * @example
  *
  *      // Make a world
@@ -262,9 +370,56 @@ int World::get_dead_cells() const {
  *      A reference to the current state.
  */
 const Grid& World::get_state() const {
+    sync_state();
     return _current_state;
 }
 
+/**
+ * World::get_state(x, y, width, height)
+ *
+ * Return a copy of a window of the current state, built straight from the engine holding the cells
+ * so that the rest of the world is never converted.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Advance a huge pattern a long way, then look at the part of it around the middle
+ *      world.set_engine(World::Engine::HashLife, true);
+ *      world.advance(1000000);
+ *      std::cout << world.get_state(world.get_width() / 2 - 40, world.get_height() / 2 - 20, 80, 40) << std::endl;
+ *
+ * @param x
+ *      The x coordinate of the top left cell of the window.
+ *
+ * @param y
+ *      The y coordinate of the top left cell of the window.
+ *
+ * @param width
+ *      The width of the window.
+ *
+ * @param height
+ *      The height of the window.
+ *
+ * @return
+ *      A grid of width x height cells.
+ *
+ * @throws
+ *      std::runtime_error if the window does not lie within the world.
+ */
+Grid World::get_state(int x, int y, int width, int height) const {
+    if (x < 0 || y < 0 || width < 0 || height < 0 || x > get_width() - width || y > get_height() - height) {
+        throw std::runtime_error("The window must lie within the world");
+    }
+
+    if (_state_stale && _engine == Engine::HashLife) return _hashlife->to_grid(x, y, width, height);
+    if (_state_stale && _engine == Engine::Gpu) {
+        Grid rows(get_width(), height);
+        _gpu->download(rows, y);
+        return rows.crop(x, 0, x + width, height);
+    }
+    return _current_state.crop(x, y, x + width, y + height);
+}
+
 /**
  * World::resize(square_size)
  *
@@ -311,60 +466,277 @@ void World::resize(int square_size) {
  *      The new height for the grid.
  */
 void World::resize(int new_width, int new_height) {
-    _current_state.resize(new_width, new_height);
+    resize(new_width, new_height, 0, 0);
 }
 
 /**
- * World::count_neighbours(x, y, toroidal)
+ * World::resize(new_width, new_height, x, y)
+ *
+ * Resize the current state grid in to the new width and height, moving its content so that its upper left
+ * corner lands at (x, y). This lets a world grow at any edge as a pattern spreads, without merging it into a
+ * new grid. See Grid::resize(width, height, x, y).
  *
- * Private helper function to count the number of alive neighbours of a cell.
- * The function should not be visible from outside the World class.
+ * @example
  *
- * Neighbours are considered within the 3x3 square centred around the cell at x,y in the current state grid.
- * Ignore the centre coordinate, a cell is not its own neighbour.
- * Attempt to keep the logic as simple, expressive, and readable as possible.
+ *      // Make a grid
+ *      World world(4, 4);
  *
- * If toroidal = false then skip any neighbours that would be outside of the grid,
- * this assumes the grid is Cell::DEAD outside its bounds.
+ *      // Grow the world by 64 cells to the left and top
+ *      world.resize(68, 68, 64, 64);
  *
- * If toroidal = true then correctly wrap out of bounds coordinates to the opposite side of the grid.
+ * @param new_width
+ *      The new width for the grid.
  *
- * This function is in World and not Grid because the 3x3 sized neighbourhood is specific to Conway's Game of Life,
- * while Grid is more generic to any 2D grid based cellular automaton.
+ * @param new_height
+ *      The new height for the grid.
  *
  * @param x
- *      The x coordinate of the centre of the neighbourhood.
+ *      The x coordinate in the resized world of the old upper left corner.
  *
  * @param y
- *      The y coordinate of the centre of the neighbourhood.
+ *      The y coordinate in the resized world of the old upper left corner.
+ */
+void World::resize(int new_width, int new_height, int x, int y) {
+    sync_state();
+    _current_state.resize(new_width, new_height, x, y);
+    allocate_buffers();
+
+    // Anything the HashLife engine had outside the new bounds is dropped
+    if (_engine == Engine::HashLife) _hashlife = std::make_shared<HashLife>(_current_state, _rule);
+    if (_engine == Engine::Gpu) _gpu = std::make_shared<GpuEngine>(_current_state, _rule);
+}
+
+/**
+ * World::reset(grid, generation)
+ *
+ * Start the world again from a new state of the same size, at generation 0 unless told otherwise.
+ * The buffers, rule, threads, engine and cycle detection of the world are all kept, so a world can be reused
+ * for one soup after another without allocating.
+ *
+ * @example
+ *
+ *      // Run a thousand soups through one world
+ *      World world(64, 64);
+ *      world.set_cycle_detection(30);
+ *      for (const Grid &soup : soups) {
+ *          world.reset(soup);
+ *          world.advance(1000);
+ *      }
+ *
+ * @param grid
+ *      The new state, as wide and as tall as the world.
+ *
+ * @param generation
+ *      Optional parameter. The generation the new state is, such as that of a checkpoint resumed from,
+ *      which steps, metrics and cycles then count on from. Defaults to 0.
+ *
+ * @throws
+ *      std::runtime_error if the grid is not the same size as the world.
+ */
+void World::reset(const Grid &grid, std::uint64_t generation) {
+    if (grid.get_width() != get_width() || grid.get_height() != get_height()) {
+        throw std::runtime_error("The new state must be the same size as the world");
+    }
+
+    // Copying a grid of the same size reuses the storage of the old state
+    _current_state = grid;
+    _state_stale = false;
+    _generation = generation;
+    mark_changed();
+
+    if (_engine == Engine::HashLife) _hashlife = std::make_shared<HashLife>(_current_state, _rule);
+    if (_engine == Engine::Gpu) _gpu = std::make_shared<GpuEngine>(_current_state, _rule);
+}
+
+/**
+ * World::allocate_buffers()
+ *
+ * Private helper function to size the next state grid, the dead row used past the top and
+ * bottom edges, and the tiles to match the current state. Called whenever the size of the world changes.
+ */
+void World::allocate_buffers() {
+    _next_state = Grid(get_width(), get_height());
+    _dead_row.assign(_current_state.get_words_per_row(), 0);
+
+    _tile_columns = (_current_state.get_words_per_row() + TILE_WORDS - 1) / TILE_WORDS;
+    _tile_rows = (get_height() + TILE_ROWS - 1) / TILE_ROWS;
+    _next_changed.assign(get_total_tiles(), 0);
+    _active.assign(get_total_tiles(), 0);
+    _hash_delta.assign(_tile_rows, 0);
+    _population_delta.assign(_tile_rows, 0);
+    _changed_cells.assign(_tile_rows, 0);
+    _active_tiles = 0;
+    if (_max_period > 0) _candidate_state = Grid(get_width(), get_height());
+    mark_changed();
+}
+
+/**
+ * World::mark_changed()
+ *
+ * Private helper function to mark every tile as changed, so the next step recomputes all of them.
+ * Called whenever the current state is replaced, or the buffers no longer hold the same still cells.
+ * The population is counted afresh, and any cycle found so far no longer holds, so cycle detection starts again.
+ */
+void World::mark_changed() {
+    _changed.assign(get_total_tiles(), 1);
+    _population = _current_state.get_alive_cells();
+    reset_cycles();
+}
+
+/**
+ * World::reset_cycles()
+ *
+ * Private helper function to forget every cycle and past generation, and hash the current state from scratch.
+ */
+void World::reset_cycles() {
+    _cycle_period = _candidate_period = 0;
+    _cycle_generation = _candidate_generation = 0;
+    _history.assign(std::size_t(std::max(_max_period, 0)), 0);
+    _history_generation = _generation;
+
+    _hash = 0;
+    if (_max_period <= 0) return;
+
+    const int words = _current_state.get_words_per_row();
+    for (int y = 0; y < get_height(); y++) {
+        const Grid::Word *row = _current_state.row_words(y);
+        for (int word = 0; word < words; word++) {
+            _hash ^= word_hash(row[word], std::uint64_t(y) * std::uint64_t(words) + std::uint64_t(word));
+        }
+    }
+    _history[_generation % _history.size()] = _hash;
+}
+
+/**
+ * World::detect_cycles()
+ *
+ * Private helper function called after each step, to look for the new state among the recent generations.
+ *      - A hash seen p generations ago makes p a candidate period, and the state is kept.
+ *      - The candidate is confirmed if the state is the same again after another p generations.
+ */
+void World::detect_cycles() {
+    if (_max_period <= 0 || _cycle_period > 0) return;
+
+    // Check a candidate once it has had a chance to come round again
+    if (_candidate_period > 0 && _generation == _candidate_generation + std::uint64_t(_candidate_period)) {
+        if (same_cells(_current_state, _candidate_state)) {
+            _cycle_period = _candidate_period;
+            _cycle_generation = _candidate_generation;
+            return;
+        }
+        _candidate_period = 0;
+    }
+
+    // Look back through the recent generations, nearest first, for the same hash
+    if (_candidate_period == 0) {
+        const int period_limit = (int) std::min<std::uint64_t>(std::uint64_t(_max_period),
+                                                               _generation - _history_generation);
+        for (int period = 1; period <= period_limit; period++) {
+            if (_history[(_generation - std::uint64_t(period)) % _history.size()] == _hash) {
+                _candidate_period = period;
+                _candidate_generation = _generation;
+                _candidate_state = _current_state;
+                break;
+            }
+        }
+    }
+
+    _history[_generation % _history.size()] = _hash;
+}
+
+/**
+ * World::step_tiles(first, last, toroidal, full)
+ *
+ * Private helper function to compute rows of tiles [first, last) of the next state from the current state,
+ * and record which tiles changed. Only those rows of the next state are written, so disjoint bands of tiles
+ * can be stepped in parallel. Each run of neighbouring active tiles is stepped in one go.
+ *
+ * @param first
+ *      The first row of tiles to compute.
+ *
+ * @param last
+ *      One past the last row of tiles to compute.
  *
  * @param toroidal
  *      If true then the step will consider the grid as a torus, where the left edge
  *      wraps to the right edge and the top to the bottom.
  *
- * @return
- *      Returns the number of alive neighbours.
+ * @param full
+ *      If true then every tile is computed, whether it is active or not.
  */
-int World::count_neighbours(int x, int y, bool toroidal) {
-    int count = 0;
+void World::step_tiles(int first, int last, bool toroidal, bool full) {
+    const int width = get_width(), height = get_height(), words = _current_state.get_words_per_row();
+    const Grid::Word *dead_row = _dead_row.data();
+    const bool hashing = _max_period > 0, counting = _metrics != nullptr;
+
+    for (int tile_row = first; tile_row < last; tile_row++) {
+        const unsigned char *active = _active.data() + tile_row * _tile_columns;
+        unsigned char *changed = _next_changed.data() + tile_row * _tile_columns;
+        const int top = tile_row * TILE_ROWS, bottom = std::min(height, top + TILE_ROWS);
+        std::uint64_t hash_delta = 0, changed_cells = 0;
+        int population_delta = 0;
+
+        for (int tile = 0; tile < _tile_columns;) {
+            changed[tile] = 0;
+            if (!full && !active[tile]) {
+                tile++;
+                continue;
+            }
+
+            // Find the end of this run of active tiles
+            int end = tile + 1;
+            while (end < _tile_columns && (full || active[end])) changed[end++] = 0;
+            const int run_first = tile * TILE_WORDS, run_last = std::min(words, end * TILE_WORDS);
+
+            for (int first_word = run_first; first_word < run_last; first_word += BLOCK_WORDS) {
+                const int last_word = std::min(run_last, first_word + BLOCK_WORDS);
+
+                for (int y = top; y < bottom; y++) {
+                    // Pick the neighbouring rows, wrapping around the torus or falling off the edge
+                    const Grid::Word *above = y > 0 ? _current_state.row_words(y - 1)
+                                                    : toroidal ? _current_state.row_words(height - 1) : dead_row;
+                    const Grid::Word *below = y < height - 1 ? _current_state.row_words(y + 1)
+                                                             : toroidal ? _current_state.row_words(0) : dead_row;
+                    const Grid::Word *row = _current_state.row_words(y);
+                    Grid::Word *next = _next_state.row_words(y);
 
-    for (int yy = -1; yy <= 1; yy++)
-        for (int xx = -1, newX = (toroidal ? (x + xx % get_width() + get_width()) % get_width() : x + xx), newY = (toroidal ? (y + yy % get_height() + get_height()) % get_height() : y + yy);
-        xx <= 1;
-        count += get_state().valid_coordinate(newX, newY) ? get_state().get(newX, newY) == ALIVE ? 1 : 0 : 0, yy == 0 ? xx += 2 : xx++, newX = (toroidal ? (x + xx % get_width() + get_width()) % get_width() : x + xx)){}
+                    Kernel::step_words(above, row, below, next, first_word, last_word, width, toroidal, _rule);
 
-    return count;
+                    for (int word = first_word; word < last_word; word++) {
+                        if (next[word] == row[word]) continue;
+
+                        changed[word / TILE_WORDS] = 1;
+                        population_delta += __builtin_popcountll(next[word]) - __builtin_popcountll(row[word]);
+                        if (counting) changed_cells += std::uint64_t(__builtin_popcountll(next[word] ^ row[word]));
+                        if (hashing) {
+                            const std::uint64_t position = std::uint64_t(y) * std::uint64_t(words) +
+                                                           std::uint64_t(word);
+                            hash_delta ^= word_hash(row[word], position) ^ word_hash(next[word], position);
+                        }
+                    }
+                }
+            }
+            tile = end;
+        }
+        _hash_delta[tile_row] = hash_delta;
+        _population_delta[tile_row] = population_delta;
+        _changed_cells[tile_row] = changed_cells;
+    }
 }
 
 /**
  * World::step(toroidal)
  *
- * Take one step in Conway's Game of Life.
+ * Take one step in Conway's Game of Life, or by the rule of the world if it has been changed.
  *
  * Reads from the current state grid and writes to the next state grid. Then swaps the grids.
- * Should be implemented by invoking World::count_neighbours(x, y, toroidal).
+ * Each row is updated 64 cells at a time by Kernel::step_words(above, row, below, next, first, last, width, toroidal, rule).
  * Swapping the grids should be done in O(1) constant time, and should not invoke a copy.
- * Try and boil the logic down to the fewest and most simple conditional statements.
+ * Only tiles next to a tile that changed last step are recomputed, the other tiles of the next state
+ * grid already match the current state, so it is reused as is without being cleared.
+ *
+ * If toroidal = false then the grid is assumed to be Cell::DEAD outside its bounds.
+ * If toroidal = true then the top and bottom rows are neighbours, as are the left and right columns.
  *
  * Rules: https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life
  *      - Any live cell with fewer than two live neighbours dies, as if by underpopulation.
@@ -377,41 +749,129 @@ int World::count_neighbours(int x, int y, bool toroidal) {
  *      wraps to the right edge and the top to the bottom. Defaults to false.
  */
 void World::step(bool toroidal) {
-    // Create new grid
-    _next_state = Grid(get_width(), get_height());
-    for (int y = 0; y < get_height(); y++) {
-        for (int x = 0; x < get_width(); x++) {
-            // Get neighbour count
-            int neighbours = count_neighbours(x, y, toroidal);
-            bool alive = _current_state.get(x, y) == ALIVE;
-
-            // If the current cell is alive
-            if (alive) {
-                // Check if it should still be alive
-                if (neighbours == 2 || neighbours == 3) {
-                    _next_state.set(x, y, ALIVE);
-                    continue;
+    if (_engine == Engine::HashLife) {
+        advance_hashlife(1, toroidal);
+        return;
+    }
+    if (_engine == Engine::Gpu) {
+        advance_gpu(1, toroidal);
+        return;
+    }
+
+    const auto start = _metrics ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+    // Changing topology changes what the edge tiles see, even if nothing in them changed
+    if (toroidal != _toroidal) {
+        mark_changed();
+        _toroidal = toroidal;
+    }
+
+    // Activate every tile that changed last step, along with the tiles around it
+    std::fill(_active.begin(), _active.end(), 0);
+    for (int tile_row = 0; tile_row < _tile_rows; tile_row++) {
+        for (int tile = 0; tile < _tile_columns; tile++) {
+            if (!_changed[tile_row * _tile_columns + tile]) continue;
+
+            for (int dy = -1; dy <= 1; dy++) {
+                int y = tile_row + dy;
+                if (toroidal) y = (y + _tile_rows) % _tile_rows;
+                else if (y < 0 || y >= _tile_rows) continue;
+
+                for (int dx = -1; dx <= 1; dx++) {
+                    int x = tile + dx;
+                    if (toroidal) x = (x + _tile_columns) % _tile_columns;
+                    else if (x < 0 || x >= _tile_columns) continue;
+
+                    _active[y * _tile_columns + x] = 1;
                 }
-            } else if (neighbours == 3) {
-                // If it's dead and should be alive
-                _next_state.set(x, y, ALIVE);
-                continue;
             }
-
-            // If it's dead or alive and should be dead
-            _next_state.set(x, y, DEAD);
         }
     }
+    _active_tiles = (int) std::count(_active.begin(), _active.end(), 1);
+
+    // Skip looking at the tiles when most of them need stepping anyway
+    const bool full = _active_tiles * 2 > get_total_tiles();
+    if (full) _active_tiles = get_total_tiles();
+
+    // Split the tiles into one band per thread, as long as each band is big enough to be worth it
+    const long long words = (long long) _active_tiles * TILE_WORDS * TILE_ROWS;
+    const int bands = (int) std::max(1LL, std::min<long long>({(long long) get_threads(), words / MIN_BAND_WORDS,
+                                                              (long long) _tile_rows}));
+
+    auto step_band = [&](int band) {
+        step_tiles(_tile_rows * band / bands, _tile_rows * (band + 1) / bands, toroidal, full);
+    };
+    if (bands > 1) {
+        _pool->run(bands, step_band);
+    } else {
+        step_band(0);
+    }
 
     // Swap the states
     std::swap(_current_state, _next_state);
+    std::swap(_changed, _next_changed);
+
+    _generation++;
+    for (int tile_row = 0; tile_row < _tile_rows; tile_row++) {
+        _population += _population_delta[tile_row];
+    }
+    if (_max_period > 0) {
+        for (int tile_row = 0; tile_row < _tile_rows; tile_row++) {
+            _hash ^= _hash_delta[tile_row];
+        }
+        detect_cycles();
+    }
+
+    if (_metrics) record_step(start, full);
+}
+
+/**
+ * World::record_step(start, full)
+ *
+ * Private helper function to total up the step just taken and hand it to the metrics recorder.
+ *
+ * @param start
+ *      The time the step started.
+ *
+ * @param full
+ *      If true then every tile was computed, whether it was active or not.
+ */
+void World::record_step(std::chrono::steady_clock::time_point start, bool full) {
+    StepStats stats = StepStats();
+    stats.generation = _generation;
+    stats.active_tiles = _active_tiles;
+    stats.population = _population;
+
+    // Count the cells of the active tiles, the tiles on the right and bottom edges can be cut short
+    if (full) {
+        stats.cells_processed = std::uint64_t(get_total_cells());
+    } else {
+        for (int tile_row = 0; tile_row < _tile_rows; tile_row++) {
+            const int rows = std::min(get_height(), (tile_row + 1) * TILE_ROWS) - tile_row * TILE_ROWS;
+            for (int tile = 0; tile < _tile_columns; tile++) {
+                if (!_active[tile_row * _tile_columns + tile]) continue;
+
+                const int columns = std::min(get_width(), (tile + 1) * TILE_WORDS * Grid::WORD_BITS) -
+                                    tile * TILE_WORDS * Grid::WORD_BITS;
+                stats.cells_processed += std::uint64_t(rows) * std::uint64_t(columns);
+            }
+        }
+    }
+    for (int tile_row = 0; tile_row < _tile_rows; tile_row++) {
+        stats.cells_changed += _changed_cells[tile_row];
+    }
+
+    stats.nanoseconds = std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    _metrics->record(stats);
 }
 
 /**
  * World::advance(steps, toroidal)
  *
  * Advance multiple steps in the Game of Life.
- * Should be implemented by invoking World::step(toroidal).
+ * Should be implemented by invoking World::step(toroidal), unless the HashLife engine is in use
+ * in which case all the steps are taken at once.
  *
  * @param steps
  *      The number of steps to advance the world forward.
@@ -421,8 +881,545 @@ void World::step(bool toroidal) {
  *      wraps to the right edge and the top to the bottom. Defaults to false.
  */
 void World::advance(int steps, bool toroidal) {
-    // Step the world steps amount times
-    for (int i = 0; i < steps; i++) {
+    if (_engine == Engine::HashLife) {
+        advance_hashlife(std::uint64_t(std::max(steps, 0)), toroidal);
+        return;
+    }
+    if (_engine == Engine::Gpu) {
+        advance_gpu(std::uint64_t(std::max(steps, 0)), toroidal);
+        return;
+    }
+
+    // Cycles have to be looked for and metrics recorded a generation at a time, so neither can be blocked
+    const bool blocked = _temporal_blocking > 1 && _max_period <= 0 && _metrics == nullptr;
+
+    // Step the world steps amount times, skipping whole periods once the world is known to repeat
+    for (int remaining = steps; remaining > 0; remaining--) {
+        if (_cycle_period > 0 && toroidal == _toroidal) {
+            _generation += std::uint64_t(remaining - remaining % _cycle_period);
+            remaining %= _cycle_period;
+            if (remaining == 0) break;
+        }
+        if (blocked && remaining >= _temporal_blocking) {
+            advance_blocked(toroidal);
+            remaining -= _temporal_blocking - 1;
+            continue;
+        }
         step(toroidal);
     }
 }
+
+/**
+ * World::advance_blocked(toroidal)
+ *
+ * Private helper function to advance the whole world by get_temporal_blocking() generations, a band of tiles
+ * at a time. Bands are split between the threads in the same way as a step. Every tile is marked as changed
+ * afterwards, as the next state buffer is left holding the old state rather than the same still cells.
+ *
+ * @param toroidal
+ *      If true then the step will consider the grid as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom.
+ */
+void World::advance_blocked(bool toroidal) {
+    const int words = _current_state.get_words_per_row();
+    const long long total_words = (long long) words * get_height();
+    const int bands = (int) std::max(1LL, std::min<long long>({(long long) get_threads(), total_words / MIN_BAND_WORDS,
+                                                              (long long) _tile_rows}));
+
+    // Two buffers of scratch rows for each band, grown once and then reused
+    const std::size_t scratch = 2 * std::size_t(TILE_ROWS + 2 * _temporal_blocking) * std::size_t(words);
+    if (_block_rows.size() < scratch * std::size_t(bands)) _block_rows.resize(scratch * std::size_t(bands));
+
+    auto step_band = [&](int band) {
+        step_blocked(_tile_rows * band / bands, _tile_rows * (band + 1) / bands,
+                     _block_rows.data() + scratch * std::size_t(band), toroidal);
+    };
+    if (bands > 1) {
+        _pool->run(bands, step_band);
+    } else {
+        step_band(0);
+    }
+
+    std::swap(_current_state, _next_state);
+    _generation += std::uint64_t(_temporal_blocking);
+    _toroidal = toroidal;
+
+    _changed.assign(get_total_tiles(), 1);
+    _population = 0;
+    for (int tile_row = 0; tile_row < _tile_rows; tile_row++) {
+        _population += _population_delta[tile_row];
+    }
+    reset_cycles();
+}
+
+/**
+ * World::step_blocked(first, last, scratch, toroidal)
+ *
+ * Private helper function to compute rows of tiles [first, last) of the next state get_temporal_blocking()
+ * generations on from the current state, and count the population of each. Only those rows of the next
+ * state are written, so disjoint bands of tiles can be stepped in parallel with their own scratch rows.
+ *
+ * @param first
+ *      The first row of tiles to compute.
+ *
+ * @param last
+ *      One past the last row of tiles to compute.
+ *
+ * @param scratch
+ *      Room for two buffers of TILE_ROWS + 2 * get_temporal_blocking() rows.
+ *
+ * @param toroidal
+ *      If true then the step will consider the grid as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom.
+ */
+void World::step_blocked(int first, int last, Grid::Word *scratch, bool toroidal) {
+    const int width = get_width(), height = get_height(), words = _current_state.get_words_per_row();
+    const int depth = _temporal_blocking, buffer_rows = TILE_ROWS + 2 * depth;
+    const Grid::Word *dead_row = _dead_row.data();
+
+    for (int tile_row = first; tile_row < last; tile_row++) {
+        const int top = tile_row * TILE_ROWS, bottom = std::min(height, top + TILE_ROWS);
+
+        // Row y of generation g of this band, the generations take turns with the two scratch buffers
+        auto scratch_row = [&](int y, int generation) {
+            return scratch + std::size_t((generation % 2) * buffer_rows + y - top + depth) * std::size_t(words);
+        };
+
+        // Read from the current state, the scratch rows, or past an edge
+        auto source = [&](int y, int generation) -> const Grid::Word * {
+            if (!toroidal && (y < 0 || y >= height)) return dead_row;
+            if (generation == 0) return _current_state.row_words(((y % height) + height) % height);
+            return scratch_row(y, generation);
+        };
+
+        for (int generation = 1; generation <= depth; generation++) {
+            int lo = top - depth + generation, hi = bottom + depth - generation;
+            if (!toroidal) {
+                lo = std::max(lo, 0);
+                hi = std::min(hi, height);
+            }
+
+            for (int y = lo; y < hi; y++) {
+                Grid::Word *next = generation == depth ? _next_state.row_words(y) : scratch_row(y, generation);
+                Kernel::step_row(source(y - 1, generation - 1), source(y, generation - 1),
+                                 source(y + 1, generation - 1), next, width, toroidal, _rule);
+            }
+        }
+
+        int population = 0;
+        for (int y = top; y < bottom; y++) {
+            const Grid::Word *row = _next_state.row_words(y);
+            for (int word = 0; word < words; word++) population += __builtin_popcountll(row[word]);
+        }
+        _population_delta[tile_row] = population;
+    }
+}
+
+/**
+ * World::advance_hashlife(steps, toroidal)
+ *
+ * Private helper function to advance the HashLife engine, leaving the current state to be built from it
+ * by sync_state when something reads it. Copies of a world share their engine until one of them advances.
+ *
+ * @param steps
+ *      The number of steps to advance the world forward.
+ *
+ * @param toroidal
+ *      Must be false, the unbounded plane of the HashLife engine cannot be wrapped into a torus.
+ *
+ * @throws
+ *      std::runtime_error if toroidal is true.
+ */
+void World::advance_hashlife(std::uint64_t steps, bool toroidal) {
+    if (toroidal) {
+        throw std::runtime_error("The HashLife engine cannot simulate a toroidal world");
+    }
+
+    if (_hashlife.use_count() > 1) _hashlife = std::make_shared<HashLife>(*_hashlife);
+    _hashlife->advance(steps);
+    _generation += steps;
+    _state_stale = true;
+}
+
+/**
+ * World::advance_gpu(steps, toroidal)
+ *
+ * Private helper function to advance the cells held by the GpuEngine, leaving them on the device.
+ * The current state is only copied back by sync_state, when something reads it.
+ * Copies of a world share their engine until one of them advances.
+ *
+ * @param steps
+ *      The number of steps to advance the world forward.
+ *
+ * @param toroidal
+ *      If true then the step will consider the grid as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom.
+ */
+void World::advance_gpu(std::uint64_t steps, bool toroidal) {
+    if (_gpu.use_count() > 1) _gpu = std::make_shared<GpuEngine>(*_gpu);
+    _gpu->advance(steps, toroidal);
+    _generation += steps;
+    _state_stale = steps > 0 || _state_stale;
+}
+
+/**
+ * World::sync_state()
+ *
+ * Private helper function to build the current state from the HashLife engine, or copy it back from the
+ * GpuEngine, if the engine has stepped the cells since, and count the population afresh.
+ * Does nothing for the dense engine, which steps the current state itself.
+ */
+void World::sync_state() const {
+    if (!_state_stale) return;
+
+    if (_engine == Engine::HashLife) {
+        _current_state = _hashlife->to_grid(0, 0, get_width(), get_height());
+    } else {
+        _gpu->download(_current_state);
+    }
+    _population = _current_state.get_alive_cells();
+    _state_stale = false;
+}
+
+/**
+ * World::get_threads()
+ *
+ * Gets the number of threads used to step the world.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Make a world
+ *      World world(4096);
+ *
+ *      // Print the number of threads to the console, worlds start with 1
+ *      std::cout << world.get_threads() << std::endl;
+ *
+ * @return
+ *      The number of threads.
+ */
+int World::get_threads() const {
+    return _pool ? _pool->get_threads() : 1;
+}
+
+/**
+ * World::set_threads(threads)
+ *
+ * Set the number of threads used to step the world, starting a new thread pool if more than one.
+ * Small worlds are still stepped on a single thread, as splitting them up would only slow them down.
+ *
+ * @example
+ *
+ *      // Make a world
+ *      World world(4096);
+ *
+ *      // Step the world on 8 threads
+ *      world.set_threads(8);
+ *      world.advance(100);
+ *
+ *      // Step the world on every hardware thread
+ *      world.set_threads(0);
+ *
+ * @param threads
+ *      The number of threads to use, values less than 1 use one thread per hardware thread.
+ */
+void World::set_threads(int threads) {
+    if (threads < 1) threads = (int) std::max(1u, std::thread::hardware_concurrency());
+
+    if (threads == get_threads()) return;
+    _pool = threads > 1 ? std::make_shared<ThreadPool>(threads) : nullptr;
+}
+
+/**
+ * World::get_rule()
+ *
+ * Gets the rule the world is stepped by.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A reference to the rule, Conway's B3/S23 unless it has been changed.
+ */
+const Rule &World::get_rule() const {
+    return _rule;
+}
+
+/**
+ * World::set_rule(rule)
+ *
+ * Change the rule the world is stepped by from the next step on.
+ * The current state is kept, any cycle found under the old rule is forgotten.
+ *
+ * @example
+ *
+ *      // Step a world by HighLife, where a replicator copies itself
+ *      World world(grid);
+ *      world.set_rule(Rule("B36/S23"));
+ *      world.advance(100);
+ *
+ * @param rule
+ *      The new rule.
+ *
+ * @throws
+ *      std::runtime_error if the HashLife engine is in use and cannot simulate the rule.
+ */
+void World::set_rule(const Rule &rule) {
+    if (rule == _rule) return;
+
+    sync_state();
+    if (_engine == Engine::HashLife) _hashlife = std::make_shared<HashLife>(_current_state, rule);
+    if (_engine == Engine::Gpu) _gpu = std::make_shared<GpuEngine>(_current_state, rule);
+    _rule = rule;
+    mark_changed();
+}
+
+/**
+ * World::get_engine()
+ *
+ * Gets the engine used to step the world.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      World::Engine::Dense by default, World::Engine::HashLife or World::Engine::Gpu.
+ */
+World::Engine World::get_engine() const {
+    return _engine;
+}
+
+/**
+ * World::set_engine(engine, unbounded)
+ *
+ * Choose the engine used to step the world.
+ *      - World::Engine::Dense steps every cell of the grid each generation, inside a hard border or a torus.
+ *      - World::Engine::HashLife memoises the future of every distinct square of the pattern, so repetitive
+ *        patterns can be advanced billions of generations in a moment. It simulates different physics, the
+ *        world becomes a window onto an unbounded plane where cells that leave it carry on evolving and can
+ *        come back in, so it is only used when asked for as unbounded. It cannot be toroidal.
+ *      - World::Engine::Gpu keeps the cells in the memory of a GPU and steps every one of them there each
+ *        generation, for dense soups on huge boards. They are copied back only when the state or population
+ *        is read, so advancing never waits on the host. Cycles and metrics are not tracked on the GPU.
+ *
+ * @example
+ *
+ *      // Make a world with a pattern in it
+ *      World world(grid);
+ *
+ *      // See where it is a billion generations from now, letting it spread past the edges of the world
+ *      world.set_engine(World::Engine::HashLife, true);
+ *      world.advance(1000000000);
+ *
+ * @param engine
+ *      The engine to use from now on, starting from the current state of the world.
+ *
+ * @param unbounded
+ *      Optional parameter. Whether the world may become a window onto an unbounded plane, which the HashLife
+ *      engine requires. Ignored by the other engines. Defaults to false.
+ *
+ * @throws
+ *      std::runtime_error if the HashLife engine is asked for without unbounded or cannot simulate the rule
+ *      of the world, or the GPU engine is not built in or has no GPU to run on. The world carries on with
+ *      its current engine.
+ */
+void World::set_engine(Engine engine, bool unbounded) {
+    if (engine == Engine::HashLife && !unbounded) {
+        throw std::runtime_error("The HashLife engine simulates an unbounded plane, so it must be asked for as unbounded");
+    }
+    if (engine == _engine) return;
+
+    sync_state();
+    std::shared_ptr<HashLife> hashlife = engine == Engine::HashLife ? std::make_shared<HashLife>(_current_state, _rule) : nullptr;
+    std::shared_ptr<GpuEngine> gpu = engine == Engine::Gpu ? std::make_shared<GpuEngine>(_current_state, _rule) : nullptr;
+    _hashlife = std::move(hashlife);
+    _gpu = std::move(gpu);
+    _engine = engine;
+    mark_changed();
+}
+
+/**
+ * World::get_total_tiles()
+ *
+ * Gets the number of tiles the world is split into for tracking which parts of it are changing.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      An integer for the number of tiles.
+ */
+int World::get_total_tiles() const {
+    return _tile_columns * _tile_rows;
+}
+
+/**
+ * World::get_active_tiles()
+ *
+ * Gets the number of tiles that were recomputed by the last step, the rest were skipped as nothing
+ * near them had changed. Every tile is counted when the whole world was stepped at once.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Make a big world with a glider in one corner
+ *      World world(grid);
+ *      world.step();
+ *
+ *      // Only the tiles around the glider are stepped
+ *      std::cout << world.get_active_tiles() << " of " << world.get_total_tiles() << std::endl;
+ *
+ * @return
+ *      An integer for the number of tiles stepped last step, 0 if the world has not been stepped.
+ */
+int World::get_active_tiles() const {
+    return _active_tiles;
+}
+
+/**
+ * World::get_generation()
+ *
+ * Gets the number of steps the world has taken since it was constructed, including skipped periods.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The current generation.
+ */
+std::uint64_t World::get_generation() const {
+    return _generation;
+}
+
+/**
+ * World::get_cycle_detection()
+ *
+ * Gets the longest period of cycle the world watches for.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The longest period, 0 if cycle detection is off.
+ */
+int World::get_cycle_detection() const {
+    return _max_period;
+}
+
+/**
+ * World::set_cycle_detection(max_period)
+ *
+ * Start or stop watching for the state of the world repeating, while stepping with the dense engine.
+ * Costs a few operations for each word that changes each step, and a look back over max_period hashes.
+ *
+ * @example
+ *
+ *      // Watch for cycles of up to 100 steps in a soup
+ *      World world(soup);
+ *      world.set_cycle_detection(100);
+ *
+ *      // Once the soup settles the rest of the steps are skipped
+ *      world.advance(1000000);
+ *      std::cout << "Period " << world.get_cycle_period() << " from " << world.get_cycle_generation() << std::endl;
+ *
+ * @param max_period
+ *      The longest period of cycle to watch for, 1 finds only still lifes. 0 or less stops watching.
+ */
+void World::set_cycle_detection(int max_period) {
+    _max_period = std::max(max_period, 0);
+    _candidate_state = _max_period > 0 ? Grid(get_width(), get_height()) : Grid();
+    reset_cycles();
+}
+
+/**
+ * World::get_cycle_period()
+ *
+ * Gets the period of the cycle the world has been confirmed to be in, 1 for a still life.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The period, or 0 if no cycle has been found.
+ */
+int World::get_cycle_period() const {
+    return _cycle_period;
+}
+
+/**
+ * World::get_cycle_generation()
+ *
+ * Gets the generation at which the state of the world was first seen to repeat one from a period earlier.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The first repeating generation, or 0 if no cycle has been found.
+ */
+std::uint64_t World::get_cycle_generation() const {
+    return _cycle_generation;
+}
+
+/**
+ * World::get_temporal_blocking()
+ *
+ * Gets the number of generations advanced for each band of tiles before moving on to the next.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of generations, 1 if advancing steps the whole world a generation at a time.
+ */
+int World::get_temporal_blocking() const {
+    return _temporal_blocking;
+}
+
+/**
+ * World::set_temporal_blocking(generations)
+ *
+ * Sets the number of generations World::advance(steps, toroidal) takes for each band of tiles before moving
+ * on to the next, so each trip through a world far larger than the cache computes many generations.
+ * The result is the same as stepping a generation at a time. Worlds watching for cycles or reporting
+ * to a metrics recorder still step a generation at a time, as do steps left over from a multiple of generations.
+ *
+ * @example
+ *
+ *      // Advance a huge soup 8 generations per pass through memory
+ *      World world(soup);
+ *      world.set_temporal_blocking(8);
+ *      world.advance(1000);
+ *
+ * @param generations
+ *      The number of generations, between 1 and TILE_ROWS. 1 advances a generation at a time.
+ *
+ * @throws
+ *      std::runtime_error if generations is less than 1 or more than TILE_ROWS.
+ */
+void World::set_temporal_blocking(int generations) {
+    if (generations < 1 || generations > TILE_ROWS) {
+        throw std::runtime_error("Temporal blocking must be between 1 and " + std::to_string(TILE_ROWS) +
+                                    " generations");
+    }
+    _temporal_blocking = generations;
+}
+
+/**
+ * World::get_metrics()
+ *
+ * Gets the metrics recorder the steps of the world are reported to.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A pointer to the recorder, or nullptr if the steps are not measured.
+ */
+Metrics *World::get_metrics() const {
+    return _metrics;
+}
+
+/**
+ * World::set_metrics(metrics)
+ *
+ * Start or stop reporting each step of the dense engine to a metrics recorder, which the world does not own.
+ * Copies of the world report to the same recorder. Periods skipped by cycle detection are not steps, so
+ * are not reported.
+ *
+ * @example
+ *
+ *      // Total up the steps of a world and print them as Prometheus metrics
+ *      Metrics metrics(std::cout, Metrics::Format::Prometheus);
+ *      world.set_metrics(&metrics);
+ *      world.advance(100);
+ *      metrics.flush();
+ *
+ * @param metrics
+ *      The recorder, which must outlive its use by the world, or nullptr to stop measuring.
+ */
+void World::set_metrics(Metrics *metrics) {
+    _metrics = metrics;
+}
@@ -12,19 +12,100 @@
 
 // Add the minimal number of includes you need in order to declare the class.
 // #include ...
+#include "gpu_engine.h"
 #include "grid.h"
+#include "hashlife.h"
+#include "metrics.h"
+#include "rule.h"
+#include "thread_pool.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 /**
  * Declare the structure of the World class for representing a 2d grid world.
  *
  * A World holds two equally sized Grid objects for the current state and next state.
  *      - These buffers should be swapped using std::swap after each update step.
+ *      - Both are allocated up front and only reallocated on resize, so stepping never allocates.
+ *
+ * A World steps its cells by a Rule, Conway's Game of Life unless told otherwise.
+ *
+ * The world is split into tiles, and only tiles near something that changed last step are recomputed.
+ *
+ * A World can keep a hash of its state, updated from the words each step changes, to spot when it repeats.
+ *
+ * A World can report the time and work of each step to a Metrics recorder, measuring nothing without one.
+ *
+ * Steps can be split into horizontal bands of tiles run in parallel on a shared ThreadPool.
+ *
+ * Advancing can take several generations of each band of tiles at a time, so the world is read and written
+ * once for all of them rather than once a generation.
+ *
+ * Alternatively a World can hand its cells to a HashLife engine, to advance huge numbers of generations
+ * of a window onto an unbounded plane, or to a GpuEngine, to step dense worlds in device memory and copy them back only when they are read.
  */
 class World {
+public:
+    enum class Engine {
+        Dense,
+        HashLife,
+        Gpu
+    };
+
 private:
-    Grid _current_state, _next_state;
+    // Mutable so that reading the state can build it from the engine that has stepped the cells since
+    mutable Grid _current_state;
+    Grid _next_state;
+    std::vector<Grid::Word> _dead_row;
+    std::shared_ptr<ThreadPool> _pool;
+    Rule _rule;
+    Engine _engine;
+    std::shared_ptr<HashLife> _hashlife;
+    std::shared_ptr<GpuEngine> _gpu;
+    mutable bool _state_stale;
+    std::vector<unsigned char> _changed, _next_changed, _active;
+    int _tile_columns, _tile_rows, _active_tiles;
+    bool _toroidal;
+
+    mutable int _population;
+    std::vector<int> _population_delta;
+
+    std::uint64_t _generation, _hash;
+    std::vector<std::uint64_t> _hash_delta, _history;
+    int _max_period, _cycle_period, _candidate_period;
+    std::uint64_t _cycle_generation, _candidate_generation, _history_generation;
+    Grid _candidate_state;
+
+    Metrics *_metrics;
+    std::vector<std::uint64_t> _changed_cells;
+
+    int _temporal_blocking;
+    std::vector<Grid::Word> _block_rows;
+
+    void allocate_buffers();
+
+    void mark_changed();
+
+    void reset_cycles();
+
+    void detect_cycles();
+
+    void advance_hashlife(std::uint64_t steps, bool toroidal);
+
+    void advance_gpu(std::uint64_t steps, bool toroidal);
+
+    void sync_state() const;
+
+    void step_tiles(int first, int last, bool toroidal, bool full);
 
-    int count_neighbours(int x, int y, bool toroidal);
+    void advance_blocked(bool toroidal);
+
+    void step_blocked(int first, int last, Grid::Word *scratch, bool toroidal);
+
+    void record_step(std::chrono::steady_clock::time_point start, bool full);
 
 public:
     World();
@@ -47,12 +128,52 @@ public:
 
     const Grid& get_state() const;
 
+    Grid get_state(int x, int y, int width, int height) const;
+
     void resize(int square_size);
 
     void resize(int new_width, int new_height);
 
+    void resize(int new_width, int new_height, int x, int y);
+
+    void reset(const Grid &grid, std::uint64_t generation = 0);
+
     void step(bool toroidal = false);
 
     void advance(int steps, bool toroidal = false);
 
+    int get_threads() const;
+
+    void set_threads(int threads);
+
+    const Rule &get_rule() const;
+
+    void set_rule(const Rule &rule);
+
+    Engine get_engine() const;
+
+    void set_engine(Engine engine, bool unbounded = false);
+
+    int get_total_tiles() const;
+
+    int get_active_tiles() const;
+
+    std::uint64_t get_generation() const;
+
+    int get_cycle_detection() const;
+
+    void set_cycle_detection(int max_period);
+
+    int get_cycle_period() const;
+
+    std::uint64_t get_cycle_generation() const;
+
+    int get_temporal_blocking() const;
+
+    void set_temporal_blocking(int generations);
+
+    Metrics *get_metrics() const;
+
+    void set_metrics(Metrics *metrics);
+
 };
\ No newline at end of file
@@ -0,0 +1,437 @@
+/**
+ * Implements a class representing many small, equally sized worlds stepped together.
+ *      - Searching for patterns means stepping huge numbers of small soups, where the cost of a World
+ *        per soup is mostly spent outside the kernel. A batch holds them all in one buffer instead.
+ *
+ *      - The buffer is a structure of arrays, word w of row y of world i is at (y * words + w) * count + i.
+ *          - Each row of the batch is then the same row of every world, stepped in one call to Kernel::step_batch,
+ *            which puts as many worlds in a vector as it has lanes.
+ *          - The worlds can be split into bands stepped in parallel on a ThreadPool, each writing only its own worlds.
+ *
+ *      - Each world keeps count of its population, and watches how it ends.
+ *          - A world with no alive cells is extinct, one that did not change last step is still,
+ *            and one that is back where it was two steps ago is oscillating with period 2.
+ *          - Each of those lasts forever, so once every world has ended advancing skips the remaining steps.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#include "world_batch.h"
+#include "kernel.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+/**
+ * The fewest packed words worth handing to a thread of their own.
+ */
+static const int MIN_BAND_WORDS = 4096;
+
+/**
+ * WorldBatch::WorldBatch(width, height, count)
+ *
+ * Construct a batch of count dead worlds, each width x height cells.
+ *
+ * @example
+ *
+ *      // Make a million 32x32 soups and step them all for 1000 generations
+ *      WorldBatch batch(32, 32, 1000000);
+ *      for (int i = 0; i < batch.get_count(); i++) batch.set(i, random_soup(32, 32, i));
+ *      batch.advance(1000);
+ *
+ * @param width
+ *      The width of every world.
+ *
+ * @param height
+ *      The height of every world.
+ *
+ * @param count
+ *      The number of worlds.
+ *
+ * @throws
+ *      std::runtime_error if any of the sizes is negative.
+ */
+WorldBatch::WorldBatch(int width, int height, int count)
+        : _width(width), _height(height), _count(count), _words((width + Grid::WORD_BITS - 1) / Grid::WORD_BITS),
+          _running(count), _toroidal(false), _generation(0) {
+    if (width < 0 || height < 0 || count < 0) {
+        throw std::runtime_error("The size of a batch must not be negative");
+    }
+
+    const std::size_t total = std::size_t(_height) * std::size_t(_words) * std::size_t(_count);
+    _previous.assign(total, 0);
+    _current.assign(total, 0);
+    _next.assign(total, 0);
+    _dead_row.assign(std::size_t(_words) * std::size_t(_count), 0);
+    _population.assign(std::size_t(_count), 0);
+    _status.assign(std::size_t(_count), Status::Running);
+    _settled_generation.assign(std::size_t(_count), 0);
+    _changed.assign(std::size_t(_count), 0);
+    _repeated.assign(std::size_t(_count), 0);
+}
+
+/**
+ * WorldBatch::index(y, word, world)
+ *
+ * Private helper function to find a word of a world in the structure of arrays buffers.
+ */
+std::size_t WorldBatch::index(int y, int word, int world) const {
+    return (std::size_t(y) * std::size_t(_words) + std::size_t(word)) * std::size_t(_count) + std::size_t(world);
+}
+
+/**
+ * WorldBatch::get_width(), WorldBatch::get_height(), WorldBatch::get_count()
+ *
+ * Gets the width and height of every world, and the number of worlds.
+ * The functions should be callable from a constant context.
+ */
+int WorldBatch::get_width() const {
+    return _width;
+}
+
+int WorldBatch::get_height() const {
+    return _height;
+}
+
+int WorldBatch::get_count() const {
+    return _count;
+}
+
+/**
+ * WorldBatch::get_generation()
+ *
+ * Gets the number of steps the batch has taken since it was constructed, including skipped steps.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The current generation.
+ */
+std::uint64_t WorldBatch::get_generation() const {
+    return _generation;
+}
+
+/**
+ * WorldBatch::set(world, grid)
+ *
+ * Replace the cells of a world, which starts running again.
+ *
+ * @param world
+ *      The index of the world.
+ *
+ * @param grid
+ *      The new cells, the same size as every world of the batch.
+ *
+ * @throws
+ *      std::runtime_error if the world does not exist or the grid is the wrong size.
+ */
+void WorldBatch::set(int world, const Grid &grid) {
+    if (world < 0 || world >= _count) {
+        throw std::runtime_error("Invalid World");
+    }
+    if (grid.get_width() != _width || grid.get_height() != _height) {
+        throw std::runtime_error("The grid is not the size of the worlds of the batch");
+    }
+
+    // The state before is the same as the state now, so nothing is seen to cycle until it has stepped
+    for (int y = 0; y < _height; y++) {
+        const Grid::Word *row = grid.row_words(y);
+        for (int word = 0; word < _words; word++) {
+            _current[index(y, word, world)] = _previous[index(y, word, world)] = row[word];
+        }
+    }
+
+    if (_status[world] != Status::Running) _running++;
+    _status[world] = Status::Running;
+    _settled_generation[world] = 0;
+    _population[world] = grid.get_alive_cells();
+}
+
+/**
+ * WorldBatch::get(world)
+ *
+ * Copy the cells of a world out of the batch.
+ * The function should be callable from a constant context.
+ *
+ * @param world
+ *      The index of the world.
+ *
+ * @return
+ *      A grid holding the current state of the world.
+ *
+ * @throws
+ *      std::runtime_error if the world does not exist.
+ */
+Grid WorldBatch::get(int world) const {
+    if (world < 0 || world >= _count) {
+        throw std::runtime_error("Invalid World");
+    }
+
+    Grid grid(_width, _height);
+    for (int y = 0; y < _height; y++) {
+        Grid::Word *row = grid.row_words(y);
+        for (int word = 0; word < _words; word++) {
+            row[word] = _current[index(y, word, world)];
+        }
+    }
+    return grid;
+}
+
+/**
+ * WorldBatch::get_population(world), WorldBatch::get_populations()
+ *
+ * Gets the number of alive cells of a world, or of every world in order, kept up to date as they step.
+ * The functions should be callable from a constant context.
+ *
+ * @throws
+ *      std::runtime_error if the world does not exist.
+ */
+int WorldBatch::get_population(int world) const {
+    if (world < 0 || world >= _count) {
+        throw std::runtime_error("Invalid World");
+    }
+    return _population[world];
+}
+
+const std::vector<int> &WorldBatch::get_populations() const {
+    return _population;
+}
+
+/**
+ * WorldBatch::get_status(world)
+ *
+ * Gets how a world has ended, if it has.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      Running while it is still changing, otherwise Extinct, Still or Oscillating with period 2.
+ *
+ * @throws
+ *      std::runtime_error if the world does not exist.
+ */
+WorldBatch::Status WorldBatch::get_status(int world) const {
+    if (world < 0 || world >= _count) {
+        throw std::runtime_error("Invalid World");
+    }
+    return _status[world];
+}
+
+/**
+ * WorldBatch::get_settled_generation(world)
+ *
+ * Gets the generation at which a world was first seen to have ended.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The generation, or 0 while the world is running.
+ *
+ * @throws
+ *      std::runtime_error if the world does not exist.
+ */
+std::uint64_t WorldBatch::get_settled_generation(int world) const {
+    if (world < 0 || world >= _count) {
+        throw std::runtime_error("Invalid World");
+    }
+    return _settled_generation[world];
+}
+
+/**
+ * WorldBatch::get_running()
+ *
+ * Gets the number of worlds that have not ended yet.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of running worlds.
+ */
+int WorldBatch::get_running() const {
+    return _running;
+}
+
+/**
+ * WorldBatch::get_rule()
+ *
+ * Gets the rule every world is stepped by.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A reference to the rule, Conway's B3/S23 unless it has been changed.
+ */
+const Rule &WorldBatch::get_rule() const {
+    return _rule;
+}
+
+/**
+ * WorldBatch::set_rule(rule)
+ *
+ * Change the rule every world is stepped by from the next step on. Every world starts running again,
+ * as how a world ends depends on the rule.
+ *
+ * @param rule
+ *      The new rule.
+ */
+void WorldBatch::set_rule(const Rule &rule) {
+    _rule = rule;
+    restart();
+}
+
+/**
+ * WorldBatch::restart()
+ *
+ * Private helper function to set every world running again, called when the way they step changes.
+ */
+void WorldBatch::restart() {
+    std::fill(_status.begin(), _status.end(), Status::Running);
+    std::fill(_settled_generation.begin(), _settled_generation.end(), 0);
+    _previous = _current;
+    _running = _count;
+}
+
+/**
+ * WorldBatch::get_threads()
+ *
+ * Gets the number of threads used to step the batch.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of threads.
+ */
+int WorldBatch::get_threads() const {
+    return _pool ? _pool->get_threads() : 1;
+}
+
+/**
+ * WorldBatch::set_threads(threads)
+ *
+ * Sets the number of threads used to step the batch. Each thread steps a band of whole worlds.
+ *
+ * @param threads
+ *      The number of threads, 0 or less to use every hardware thread.
+ */
+void WorldBatch::set_threads(int threads) {
+    if (threads < 1) threads = (int) std::max(1u, std::thread::hardware_concurrency());
+
+    if (threads == get_threads()) return;
+    _pool = threads > 1 ? std::make_shared<ThreadPool>(threads) : nullptr;
+}
+
+/**
+ * WorldBatch::step_worlds(first, last, toroidal)
+ *
+ * Private helper function to compute the next state of worlds [first, last), and count their population
+ * and which of them changed or repeated. Only those worlds are written, so disjoint bands of worlds
+ * can be stepped in parallel.
+ */
+void WorldBatch::step_worlds(int first, int last, bool toroidal) {
+    const std::size_t row_words = std::size_t(_words) * std::size_t(_count);
+
+    for (int y = 0; y < _height; y++) {
+        // Pick the neighbouring rows, wrapping around the torus or falling off the edge
+        const Grid::Word *above = y > 0 ? &_current[(y - 1) * row_words]
+                                        : toroidal ? &_current[(_height - 1) * row_words] : _dead_row.data();
+        const Grid::Word *below = y < _height - 1 ? &_current[(y + 1) * row_words]
+                                                  : toroidal ? _current.data() : _dead_row.data();
+
+        Kernel::step_batch(above + first, &_current[y * row_words] + first, below + first,
+                           &_next[y * row_words] + first, last - first, _count, _width, toroidal, _rule);
+    }
+
+    // Compare every world with its last two states as its population is counted
+    std::fill(_population.begin() + first, _population.begin() + last, 0);
+    std::fill(_changed.begin() + first, _changed.begin() + last, 0);
+    std::fill(_repeated.begin() + first, _repeated.begin() + last, 0);
+    for (int y = 0; y < _height; y++) {
+        for (int word = 0; word < _words; word++) {
+            const Grid::Word *next = &_next[index(y, word, 0)], *current = &_current[index(y, word, 0)];
+            const Grid::Word *previous = &_previous[index(y, word, 0)];
+
+            for (int world = first; world < last; world++) {
+                _population[world] += __builtin_popcountll(next[world]);
+                _changed[world] |= next[world] ^ current[world];
+                _repeated[world] |= next[world] ^ previous[world];
+            }
+        }
+    }
+}
+
+/**
+ * WorldBatch::step(toroidal)
+ *
+ * Take one step in every world of the batch, including those that have ended.
+ * Changing topology sets every world running again, as how a world ends depends on its edges.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then each world is a torus, where the left edge wraps to the right edge
+ *      and the top to the bottom. Defaults to false.
+ */
+void WorldBatch::step(bool toroidal) {
+    if (toroidal != _toroidal) {
+        _toroidal = toroidal;
+        restart();
+    }
+
+    if (_count == 0 || _height == 0 || _width == 0) {
+        _generation++;
+        return;
+    }
+
+    // Split the worlds into one band per thread, keeping each band a whole number of vectors of worlds
+    const long long words = (long long) _count * _height * _words;
+    const int bands = (int) std::max(1LL, std::min<long long>({(long long) get_threads(), words / MIN_BAND_WORDS,
+                                                              (long long) (_count + 7) / 8}));
+    auto band_edge = [&](int band) {
+        return band == bands ? _count : (int) ((long long) _count * band / bands) & ~7;
+    };
+    auto step_band = [&](int band) {
+        step_worlds(band_edge(band), band_edge(band + 1), toroidal);
+    };
+    if (bands > 1) {
+        _pool->run(bands, step_band);
+    } else {
+        step_band(0);
+    }
+
+    // The current state becomes the previous one, and the oldest buffer is reused for the next step
+    std::swap(_previous, _current);
+    std::swap(_current, _next);
+    _generation++;
+
+    for (int world = 0; world < _count; world++) {
+        if (_status[world] != Status::Running) continue;
+
+        if (_population[world] == 0) _status[world] = Status::Extinct;
+        else if (!_changed[world]) _status[world] = Status::Still;
+        else if (!_repeated[world]) _status[world] = Status::Oscillating;
+        else continue;
+
+        _settled_generation[world] = _generation;
+        _running--;
+    }
+}
+
+/**
+ * WorldBatch::advance(steps, toroidal)
+ *
+ * Advance every world of the batch multiple steps. Once every world has ended the remaining steps
+ * are skipped two at a time, which leaves every world exactly as stepping them would have.
+ *
+ * @param steps
+ *      The number of steps to advance the batch forward.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then each world is a torus, where the left edge wraps to the right edge
+ *      and the top to the bottom. Defaults to false.
+ */
+void WorldBatch::advance(int steps, bool toroidal) {
+    for (int remaining = steps; remaining > 0; remaining--) {
+        if (_running == 0 && toroidal == _toroidal) {
+            _generation += std::uint64_t(remaining - remaining % 2);
+            if (remaining % 2 == 0) break;
+            remaining = 1;
+        }
+        step(toroidal);
+    }
+}
@@ -0,0 +1,91 @@
+/**
+ * Declares a class representing many small, equally sized worlds stepped together.
+ * Rich documentation for the api and behaviour the WorldBatch class can be found in world_batch.cpp.
+ *
+ * @author 962940
+ * @date October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+#include "thread_pool.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Declare the structure of the WorldBatch class for stepping a large number of small worlds at once.
+ *
+ * The cells of every world are held in one structure of arrays buffer, the same word of each world side by side.
+ *      - A step is one pass over the buffer, with every lane of a vector stepping a different world.
+ *      - Each world keeps its own population, and whether it has died out, settled, or fallen into a period 2 cycle.
+ */
+class WorldBatch {
+public:
+    enum class Status {
+        Running,
+        Extinct,
+        Still,
+        Oscillating
+    };
+
+private:
+    int _width, _height, _count, _words;
+    std::vector<Grid::Word> _previous, _current, _next, _dead_row;
+    std::vector<int> _population;
+    std::vector<Status> _status;
+    std::vector<std::uint64_t> _settled_generation;
+    std::vector<Grid::Word> _changed, _repeated;
+    int _running;
+    bool _toroidal;
+    std::uint64_t _generation;
+    Rule _rule;
+    std::shared_ptr<ThreadPool> _pool;
+
+    std::size_t index(int y, int word, int world) const;
+
+    void restart();
+
+    void step_worlds(int first, int last, bool toroidal);
+
+public:
+    WorldBatch(int width, int height, int count);
+
+    int get_width() const;
+
+    int get_height() const;
+
+    int get_count() const;
+
+    std::uint64_t get_generation() const;
+
+    void set(int world, const Grid &grid);
+
+    Grid get(int world) const;
+
+    int get_population(int world) const;
+
+    const std::vector<int> &get_populations() const;
+
+    Status get_status(int world) const;
+
+    std::uint64_t get_settled_generation(int world) const;
+
+    int get_running() const;
+
+    const Rule &get_rule() const;
+
+    void set_rule(const Rule &rule);
+
+    int get_threads() const;
+
+    void set_threads(int threads);
+
+    void step(bool toroidal = false);
+
+    void advance(int steps, bool toroidal = false);
+};
@@ -18,12 +18,45 @@
  *                padded with zero or more 0 bits.
  *              - a 0 bit should be considered Cell::DEAD, a 1 bit should be considered Cell::ALIVE.
  *
+ *      - Grids can be loaded from and saved to the standard Life RLE format.
+ *          - https://www.conwaylife.com/wiki/Run_Length_Encoded
+ *          - Lines starting with '#' before the header are comments.
+ *          - A header line "x = (width), y = (height)", optionally followed by ", rule = (rule)".
+ *          - followed by runs of cells, each an optional count then a tag.
+ *              - 'b' is Cell::DEAD, 'o' is Cell::ALIVE, '$' ends a row, and '!' ends the pattern.
+ *              - Cells missing from the end of a row, and rows missing from the end of the pattern, are dead.
+ *
+ *      - Grids can be loaded from and saved to a compressed checkpoint format, which skips empty space.
+ *          - Compressed files are composed of:
+ *              - the 4 magic bytes "GOLC"
+ *              - a 4 byte int representing the grid width
+ *              - a 4 byte int representing the grid height
+ *              - followed by the packed words of the grid rows, in row order, as alternating runs of:
+ *                  - a varint count of all dead words, which are not stored.
+ *                  - a varint count of literal words, followed by each word as 8 little endian bytes.
+ *              - Varints are LEB128, 7 bits to a byte with the top bit set on all but the last byte.
+ *              - Each row is (width + 63) / 64 words, cell x in bit (x % 64) of word (x / 64).
+ *
  * @author 962940
  * @date March, 2020
  */
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <sstream>
+#include <stdexcept>
+#include <vector>
 #include "zoo.h"
+#include "mapped_file.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 // Include the minimal number of headers needed to support your implementation.
 // #include ...
@@ -126,11 +159,59 @@ Grid Zoo::light_weight_spaceship() {
     return grid;
 }
 
+/**
+ * pack_ascii_row(text, length, row)
+ *
+ * Private helper function to check a line of an ascii file and pack its cells straight into the words of a
+ * grid row. Sixteen characters at a time are compared against '#' and ' ' with SSE2 where it is available.
+ *
+ * @param text, length
+ *      The characters of the line, without its newline.
+ *
+ * @param row
+ *      The words of the grid row to fill, at least enough for length cells.
+ *
+ * @return
+ *      False if any character is neither the ALIVE nor DEAD character.
+ */
+static bool pack_ascii_row(const char *text, int length, Grid::Word *row) {
+    for (int x = 0; x < length; x += Grid::WORD_BITS) {
+        const int cells = std::min(Grid::WORD_BITS, length - x);
+        Grid::Word word = 0;
+        int cell = 0;
+
+#ifdef __SSE2__
+        const __m128i alive = _mm_set1_epi8('#'), dead = _mm_set1_epi8(' ');
+        for (; cell + 16 <= cells; cell += 16) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + x + cell));
+            const int alive_bits = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, alive));
+            const int dead_bits = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, dead));
+            if ((alive_bits | dead_bits) != 0xFFFF) return false;
+
+            word |= Grid::Word(alive_bits) << cell;
+        }
+#endif
+
+        for (; cell < cells; cell++) {
+            const char symbol = text[x + cell];
+            if (symbol == '#') {
+                word |= Grid::Word(1) << cell;
+            } else if (symbol != ' ') {
+                return false;
+            }
+        }
+        row[x / Grid::WORD_BITS] = word;
+    }
+
+    return true;
+}
+
 /**
  * Zoo::load_ascii(path)
  *
  * Load an ascii file and parse it as a grid of cells.
- * Should be implemented using std::ifstream.
+ * The file is mapped into memory and each line is found with memchr, then checked and packed straight
+ * into the words of its grid row, without setting cells one at a time.
  *
  * @example
  *
@@ -152,85 +233,106 @@ Grid Zoo::light_weight_spaceship() {
  */
 Grid Zoo::load_ascii(const std::string& filePath) {
     // First open the file
-    std::ifstream file;
-    file.open(filePath);
-    Grid newGrid;
+    MappedFile file(filePath);
+    const char *text = reinterpret_cast<const char *>(file.data());
+    const char *end = text + file.size();
 
-    // Then we need to check if the file failed to open
-    if (!file) {
-        throw std::runtime_error("File failed to open");
-    }
+    // Finds the end of the line starting at text
+    auto line_end = [&](const char *line) {
+        const void *newline = line == end ? nullptr : std::memchr(line, '\n', std::size_t(end - line));
+        return newline ? static_cast<const char *>(newline) : end;
+    };
+
+    int width = 0, height = 0;
 
-    // Once we know the file is open
-    if (file.is_open()) {
-        int width = 0, height = 0;
+    // First thing to do is get the width and height values from the top line
+    const char *top = line_end(text);
+    std::string topLine(text, top);
+    std::stringstream ss(topLine);
 
-        // First thing to do is get the width and height values from the top line
-        std::string topLine;
-        getline(file, topLine);
-        std::stringstream ss(topLine);
+    getline(ss, topLine, ' ');
+    width = stoi(topLine);
 
-        getline(ss, topLine, ' ');
-        width = stoi(topLine);
+    getline(ss, topLine, ' ');
+    height = stoi(topLine);
 
-        getline(ss, topLine, ' ');
-        height = stoi(topLine);
+    // Once we have set the width and height, we need to check to make sure the values are valid. e.g. > 0
+    if (width <= 0 || height <= 0) {
+        throw std::runtime_error("Width or Height have an invalid value, make sure they are both greater than 0");
+    }
+
+    Grid newGrid(width, height);
+    int lineIndex = 0; // lineIndex is the Y-value for the grid we're reading
+    // Next, Loop over each line
+    for (const char *line = top == end ? end : top + 1; line < end; lineIndex++) {
+        const char *next = line_end(line);
+        const int length = int(next - line);
 
-        // Once we have set the width and height, we need to check to make sure the values are valid. e.g. > 0
-        if (width <= 0 || height <= 0) {
-            file.close();
-            throw std::runtime_error("Width or Height have an invalid value, make sure they are both greater than 0");
+        // Check if the line is longer than expected
+        if (length > width) {
+            throw std::runtime_error("The line at " + std::to_string(lineIndex) + " was longer than expected");
         }
 
-        newGrid = Grid(width, height);
-        std::string line;
-        int lineIndex = 0; // lineIndex is the Y-value for the grid we're reading
-        // Next, Loop over each line
-        while ((getline(file, line))) {
-            // Check if the line is longer than expected
-            if ((int)line.length() > width) {
-                file.close();
-                throw std::runtime_error("The line at " + std::to_string(lineIndex) + " was longer than expected");
+        if (length > 0) {
+            if (lineIndex >= height) {
+                throw std::runtime_error("The line at " + std::to_string(lineIndex) + " is past the last row");
             }
-
-            if (line.length() > 0) {
-                // Loop over each character in the line
-                for (int c = 0; c < (int)line.length(); c++) {
-                    char sym = line[c];
-                    switch (sym) {
-                        case '#':
-                            // The Cell is alive
-                            newGrid.set(c, lineIndex, ALIVE);
-                            break;
-                        case ' ':
-                            // The Cell is dead
-                            newGrid.set(c, lineIndex, DEAD);
-                            break;
-                        default:
-                            // The symbol is an invalid value
-                            file.close();
-                            throw std::runtime_error("There was an invalid symbol found");
-                    }
-                }
+            if (!pack_ascii_row(line, length, newGrid.row_words(lineIndex))) {
+                // The symbol is an invalid value
+                throw std::runtime_error("There was an invalid symbol found");
             }
-            lineIndex++;
-        }
-        if (lineIndex + 1 < height) {
-            throw std::runtime_error("File ends unexpectedly");
         }
-        file.close();
-    } else {
-        throw std::runtime_error("File failed to open");
+        line = next == end ? end : next + 1;
+    }
+    if (lineIndex + 1 < height) {
+        throw std::runtime_error("File ends unexpectedly");
     }
 
     return newGrid;
 }
 
+/**
+ * The size of the buffer the writers fill before handing it to the file in one write.
+ */
+static const std::size_t WRITE_BUFFER_BYTES = std::size_t(1) << 20;
+
+/**
+ * Private helper class to collect bytes into one large reusable buffer and write it out whenever it fills,
+ * so saving a huge grid costs neither a copy of the whole file in memory nor millions of small writes.
+ */
+class OutputBuffer {
+private:
+    std::ostream &_output;
+    std::vector<char> _bytes;
+    std::size_t _used;
+
+public:
+    explicit OutputBuffer(std::ostream &output) : _output(output), _bytes(WRITE_BUFFER_BYTES), _used(0) {}
+
+    /**
+     * Reserve space for count bytes at the end of the buffer, writing out what it holds first if needed.
+     * The caller must fill every reserved byte, and count must be no more than WRITE_BUFFER_BYTES.
+     */
+    char *reserve(std::size_t count) {
+        if (_used + count > _bytes.size()) flush();
+
+        char *space = _bytes.data() + _used;
+        _used += count;
+        return space;
+    }
+
+    void flush() {
+        _output.write(_bytes.data(), std::streamsize(_used));
+        _used = 0;
+    }
+};
+
 /**
  * Zoo::save_ascii(path, grid)
  *
  * Save a grid as an ascii .gol file according to the specified file format.
- * Should be implemented using std::ofstream.
+ * Rows are expanded straight from the packed words of the grid into a reusable buffer, which is written
+ * to a std::ofstream whenever it fills.
  *
  * @example
  *
@@ -252,7 +354,7 @@ Grid Zoo::load_ascii(const std::string& filePath) {
  *      The grid to be written out to file.
  *
  * @throws
- *      Throws std::runtime_error or sub-class if the file cannot be opened.
+ *      Throws std::runtime_error or sub-class if the file cannot be opened or written to.
  */
 void Zoo::save_ascii(const std::string& filePath, const Grid& grid) {
     std::ofstream saveFile(filePath);
@@ -262,16 +364,105 @@ void Zoo::save_ascii(const std::string& filePath, const Grid& grid) {
     }
 
     saveFile << grid.get_width() << " " << grid.get_height() << std::endl;
-    saveFile << grid.to_string();
+
+    // Spell out each byte of cells at once
+    static const auto spellings = [] {
+        std::array<std::array<char, 8>, 256> table{};
+        for (int byte = 0; byte < 256; byte++) {
+            for (int bit = 0; bit < 8; bit++) {
+                table[byte][bit] = (byte >> bit) & 1 ? '#' : ' ';
+            }
+        }
+        return table;
+    }();
+
+    OutputBuffer buffer(saveFile);
+    const int width = grid.get_width();
+    for (int y = 0; y < grid.get_height(); y++) {
+        const Grid::Word *row = grid.row_words(y);
+
+        // Write the row a word at a time, so rows of any width fit in the buffer
+        for (int x = 0; x < width; x += Grid::WORD_BITS) {
+            const int cells = std::min(Grid::WORD_BITS, width - x);
+            char *text = buffer.reserve(std::size_t(cells));
+
+            Grid::Word word = row[x / Grid::WORD_BITS];
+            for (int cell = 0; cell < cells; cell += 8, word >>= 8) {
+                std::memcpy(text + cell, spellings[word & 0xFF].data(), std::size_t(std::min(8, cells - cell)));
+            }
+        }
+        *buffer.reserve(1) = '\n';
+    }
+    buffer.flush();
 
     saveFile.close();
+    if (!saveFile) {
+        throw std::runtime_error("File cannot be written");
+    }
+}
+
+/**
+ * load_little_endian(bytes, size, index)
+ *
+ * Private helper function to read 8 bytes as a little endian word, bytes past the end are read as zero.
+ */
+static Grid::Word load_little_endian(const unsigned char *bytes, std::size_t size, std::size_t index) {
+    Grid::Word word = 0;
+    if (index + sizeof(word) <= size) {
+        std::memcpy(&word, bytes + index, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        return word;
+    }
+
+    for (std::size_t i = 0; index + i < size && i < sizeof(word); i++) {
+        word |= Grid::Word(bytes[index + i]) << (8 * i);
+    }
+    return word;
+}
+
+/**
+ * unpack_row(bytes, size, bit, width, row)
+ *
+ * Private helper function to copy a row of cells out of a bit stream into the packed words of a grid row,
+ * 64 cells at a time. Both store cell x of the row in bit (x % 8) of each byte, so no cell needs decoding.
+ *
+ * @param bytes, size
+ *      The bit stream.
+ *
+ * @param bit
+ *      The index of the bit holding the first cell of the row.
+ *
+ * @param width
+ *      The number of cells in the row.
+ *
+ * @param row
+ *      The words of the grid row to fill.
+ */
+static void unpack_row(const unsigned char *bytes, std::size_t size, std::uint64_t bit, int width, Grid::Word *row) {
+    const int words = (width + Grid::WORD_BITS - 1) / Grid::WORD_BITS;
+
+    for (int word = 0; word < words; word++, bit += Grid::WORD_BITS) {
+        const std::size_t index = std::size_t(bit / 8);
+        const int shift = int(bit % 8);
+
+        // Splice together the two loads either side of an unaligned start
+        Grid::Word value = load_little_endian(bytes, size, index) >> shift;
+        if (shift != 0 && index + 8 < size) value |= Grid::Word(bytes[index + 8]) << (Grid::WORD_BITS - shift);
+        row[word] = value;
+    }
+
+    // Keep the padding past the end of the row dead
+    if (width % Grid::WORD_BITS != 0) row[words - 1] &= (Grid::Word(1) << (width % Grid::WORD_BITS)) - 1;
 }
 
 /**
  * Zoo::load_binary(path)
  *
  * Load a binary file and parse it as a grid of cells.
- * Should be implemented using std::ifstream.
+ * The file is mapped into memory, and the bit stream is copied into the packed rows of the grid 64 cells
+ * at a time, so loading a large board runs at the speed the disk can supply it.
  *
  * @example
  *
@@ -287,56 +478,39 @@ void Zoo::save_ascii(const std::string& filePath, const Grid& grid) {
  * @throws
  *      Throws std::runtime_error or sub-class if:
  *          - The file cannot be opened.
- *          - The file ends unexpectedly.
+ *          - The file ends unexpectedly, before the (width * height) bits of every cell.
+ *          - The width or height is negative.
  */
 Grid Zoo::load_binary(const std::string &filePath) {
-    Grid newGrid;
-    std::ifstream file(filePath, std::ios::in | std::ios::binary);
-
-    if (!file) {
-        throw std::runtime_error("File failed to open");
-    }
+    MappedFile file(filePath);
 
     // Read in width and height
     int width = 0;
     int height = 0;
+    const std::size_t header = sizeof(width) + sizeof(height);
 
-    file.read(reinterpret_cast<char *>(&width), sizeof(width));
-    file.read(reinterpret_cast<char *>(&height), sizeof(height));
-
-    newGrid = Grid(width, height);
-
-    // Loop over each line in the file
-    for (int y = 0; y < height; y++) {
-        char line;
-
-        // If we can get a new line
-        if (file.get(line)) {
-            // Read in each bit of each byte
-            for (int x = 0; x < 8; x++) {
-                int cell = ((line >> x) & 1);
-
-                // Convert the padded index to the index of the grid
-                int index = x + 8 * y;
-
-                if (index >= width * height) {
-                    y = height;
-                    break;
-                }
+    if (file.size() < header) {
+        throw std::runtime_error("File ends wrong");
+    }
+    std::memcpy(&width, file.data(), sizeof(width));
+    std::memcpy(&height, file.data() + sizeof(width), sizeof(height));
 
-                int xCoord = index % width;
-                int yCoord = index / width;
+    if (width < 0 || height < 0) {
+        throw std::runtime_error("File has an invalid size");
+    }
 
-                newGrid.set(xCoord, yCoord, cell == 1 ? ALIVE : DEAD);
-            }
-        } else {
-            // If the file ends before it's meant to
-            file.close();
-            throw std::runtime_error("File ends wrong");
-        }
+    // The payload must hold every cell, rounded up to a whole byte
+    const std::uint64_t cells = std::uint64_t(width) * std::uint64_t(height);
+    if (file.size() - header < (cells + 7) / 8) {
+        throw std::runtime_error("File ends wrong");
     }
 
-    file.close();
+    Grid newGrid(width, height);
+    const unsigned char *payload = file.data() + header;
+    const std::size_t size = file.size() - header;
+    for (int y = 0; y < height; y++) {
+        unpack_row(payload, size, std::uint64_t(y) * std::uint64_t(width), width, newGrid.row_words(y));
+    }
 
     return newGrid;
 }
@@ -345,7 +519,8 @@ Grid Zoo::load_binary(const std::string &filePath) {
  * Zoo::save_binary(path, grid)
  *
  * Save a grid as an binary .bgol file according to the specified file format.
- * Should be implemented using std::ofstream.
+ * The packed words of each row are shifted straight into the bit stream 64 cells at a time, through a
+ * reusable buffer which is written to a std::ofstream whenever it fills.
  *
  * @example
  *
@@ -382,31 +557,491 @@ void Zoo::save_binary(const std::string &filePath, const Grid &grid) {
     saveFile.write(reinterpret_cast<const char *>(&width), 4);
     saveFile.write(reinterpret_cast<const char *>(&height), 4);
 
-    unsigned char line = 0;
-    int size = grid.get_width() * grid.get_height();
-    int x = 0;
-    // Loop over each cell and write it to the byte
-    for (int i = 0; i < size; i++) {
-        if (i < size) {
-            int currentBit = grid.get(i % grid.get_width(), i / grid.get_width()) == ALIVE ? 1 : 0;
-            if (currentBit) {
-                line |= (1 << x);
-            }
+    // Gather the cells into whole words of the stream, writing each out as it fills
+    OutputBuffer buffer(saveFile);
+    Grid::Word pending = 0;
+    int pending_bits = 0;
+    auto emit = [&](Grid::Word word, int bytes) {
+        char *out = buffer.reserve(std::size_t(bytes));
+        for (int i = 0; i < bytes; i++) {
+            out[i] = char((word >> (8 * i)) & 0xFF);
         }
+    };
+
+    for (int y = 0; y < height; y++) {
+        const Grid::Word *row = grid.row_words(y);
+        for (int x = 0; x < width; x += Grid::WORD_BITS) {
+            const int cells = std::min(Grid::WORD_BITS, width - x);
+            const Grid::Word word = row[x / Grid::WORD_BITS];
+
+            pending |= word << pending_bits;
+            pending_bits += cells;
+            if (pending_bits >= Grid::WORD_BITS) {
+                emit(pending, 8);
+                pending_bits -= Grid::WORD_BITS;
 
-        x++;
-        // Once the byte is complete, write it to the file
-        if (x == 8) {
-            x = 0;
-            saveFile << (line);
-            line = 0;
+                // Carry over whatever did not fit, the padding bits of the grid are always zero
+                pending = pending_bits > 0 ? word >> (cells - pending_bits) : 0;
+            }
         }
     }
 
     // If the byte was incomplete before ending, finish writing to the file
-    if (x != 0) {
-        saveFile << (line);
+    emit(pending, (pending_bits + 7) / 8);
+    buffer.flush();
+
+    saveFile.close();
+    if (!saveFile)
+        throw std::runtime_error("File cannot be written");
+}
+
+/**
+ * find_cell(row, x, width, value)
+ *
+ * Private helper function to find the next cell in a packed row with the given value, skipping a word at a time.
+ *
+ * @return
+ *      The first x coordinate at or after x holding value, or width if there is none.
+ */
+static int find_cell(const Grid::Word *row, int x, int width, Cell value) {
+    while (x < width) {
+        const Grid::Word word = value == Cell::ALIVE ? row[x / Grid::WORD_BITS] : ~row[x / Grid::WORD_BITS];
+        const Grid::Word remaining = word >> (x % Grid::WORD_BITS);
+
+        if (remaining != 0) return std::min(width, x + __builtin_ctzll(remaining));
+        x += Grid::WORD_BITS - x % Grid::WORD_BITS;
+    }
+    return width;
+}
+
+/**
+ * Zoo::load_rle(path)
+ *
+ * Load a Life RLE file and parse it as a grid of cells.
+ * Runs of alive cells are filled into the packed rows of the grid a word at a time.
+ * The rule in the header is not checked, the cells are read the same way whatever it is.
+ *
+ * @example
+ *
+ *      // Load an RLE file from a directory
+ *      Grid grid = Zoo::load_rle("path/to/file.rle");
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @return
+ *      Returns the parsed grid.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The file cannot be opened.
+ *          - The header line is missing or its width or height is not a non-negative integer.
+ *          - A run of cells goes past the right or bottom edge of the grid.
+ *          - A character is not a digit, tag, or whitespace.
+ *          - The file ends before the '!' tag.
+ */
+Grid Zoo::load_rle(const std::string &filePath) {
+    MappedFile file(filePath);
+    const char *text = reinterpret_cast<const char *>(file.data());
+    const char *end = text + file.size();
+
+    // Skip the comment lines before the header
+    while (text < end && (*text == '#' || *text == '\n' || *text == '\r')) {
+        const void *newline = std::memchr(text, '\n', std::size_t(end - text));
+        text = newline ? static_cast<const char *>(newline) + 1 : end;
+    }
+
+    // Parse the header, ignoring spaces, as "x=(width),y=(height)" followed by anything
+    const void *newline = text == end ? nullptr : std::memchr(text, '\n', std::size_t(end - text));
+    const char *header_end = newline ? static_cast<const char *>(newline) : end;
+    std::string header;
+    for (const char *c = text; c < header_end; c++) {
+        if (!std::isspace(static_cast<unsigned char>(*c))) header += *c;
+    }
+
+    long long width = -1, height = -1;
+    std::size_t position = 0;
+    auto parse = [&](const char *prefix) {
+        const std::size_t length = std::strlen(prefix);
+        if (header.compare(position, length, prefix) != 0) return -1LL;
+        position += length;
+
+        long long value = 0;
+        const std::size_t start = position;
+        while (position < header.size() && std::isdigit(static_cast<unsigned char>(header[position])) &&
+               value <= std::numeric_limits<int>::max()) {
+            value = value * 10 + (header[position++] - '0');
+        }
+        return position == start || value > std::numeric_limits<int>::max() ? -1LL : value;
+    };
+    width = parse("x=");
+    if (width >= 0) height = parse(",y=");
+
+    if (width < 0 || height < 0) {
+        throw std::runtime_error("The RLE header is missing or has an invalid size");
+    }
+
+    Grid newGrid((int) width, (int) height);
+    int x = 0, y = 0;
+    long long count = 0;
+    for (text = header_end; text < end; text++) {
+        const char symbol = *text;
+        if (std::isdigit(static_cast<unsigned char>(symbol))) {
+            count = std::min<long long>(count * 10 + (symbol - '0'), std::numeric_limits<int>::max());
+            continue;
+        }
+        if (std::isspace(static_cast<unsigned char>(symbol))) continue;
+
+        const long long run = count > 0 ? count : 1;
+        count = 0;
+        switch (symbol) {
+            case 'b':
+            case 'o':
+                if (x + run > width || (symbol == 'o' && y >= height)) {
+                    throw std::runtime_error("The run at row " + std::to_string(y) + " goes past the edge of the grid");
+                }
+                if (symbol == 'o') newGrid.fill(x, y, int(x + run), y + 1, ALIVE);
+                x += int(run);
+                break;
+            case '$':
+                y = int(std::min<long long>(y + run, std::numeric_limits<int>::max()));
+                x = 0;
+                break;
+            case '!':
+                return newGrid;
+            default:
+                throw std::runtime_error("There was an invalid symbol found");
+        }
+    }
+
+    throw std::runtime_error("File ends unexpectedly");
+}
+
+/**
+ * Zoo::save_rle(path, grid, rule)
+ *
+ * Save a grid as a Life RLE file, with the rule it is stepped by in the header and lines no longer than 70 characters.
+ * Runs are found by skipping a word at a time through the packed rows, so empty space costs next to nothing,
+ * and the text is streamed through a reusable buffer.
+ *
+ * @example
+ *
+ *      // Save a glider to an RLE file in a directory
+ *      Zoo::save_rle("path/to/file.rle", Zoo::glider());
+ *
+ *      // Save a HighLife replicator, so the file says which rule it replicates under
+ *      Zoo::save_rle("path/to/replicator.rle", replicator, Rule::highlife());
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param grid
+ *      The grid to be written out to file.
+ *
+ * @param rule
+ *      Optional parameter. The rule to name in the header. Defaults to Conway's Game of Life.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened or written to.
+ */
+void Zoo::save_rle(const std::string &filePath, const Grid &grid, const Rule &rule) {
+    std::ofstream saveFile(filePath, std::ios::out | std::ios::binary);
+
+    if (!saveFile) {
+        throw std::runtime_error("File cannot be opened");
+    }
+
+    saveFile << "x = " << grid.get_width() << ", y = " << grid.get_height() << ", rule = " << rule.to_string() << "\n";
+
+    OutputBuffer buffer(saveFile);
+    int line_length = 0;
+    auto emit = [&](int run, char tag) {
+        char token[16];
+        int length = run > 1 ? std::snprintf(token, sizeof(token), "%d", run) : 0;
+        token[length++] = tag;
+
+        if (line_length + length > 70) {
+            *buffer.reserve(1) = '\n';
+            line_length = 0;
+        }
+        std::memcpy(buffer.reserve(std::size_t(length)), token, std::size_t(length));
+        line_length += length;
+    };
+
+    // Rows are only ended once another alive cell turns up, so the empty rows at the bottom are left out
+    const int width = grid.get_width();
+    int pending_rows = 0;
+    for (int y = 0; y < grid.get_height(); y++) {
+        const Grid::Word *row = grid.row_words(y);
+
+        int x = 0;
+        for (int alive = find_cell(row, 0, width, Cell::ALIVE); alive < width;
+             alive = find_cell(row, x, width, Cell::ALIVE)) {
+            if (pending_rows > 0) {
+                emit(pending_rows, '$');
+                pending_rows = 0;
+            }
+
+            // Emit the dead cells since the last run, then the run of alive cells
+            const int dead = find_cell(row, alive, width, Cell::DEAD);
+            if (alive > x) emit(alive - x, 'b');
+            emit(dead - alive, 'o');
+            x = dead;
+        }
+        pending_rows++;
+    }
+    emit(1, '!');
+    *buffer.reserve(1) = '\n';
+    buffer.flush();
+
+    saveFile.close();
+    if (!saveFile) {
+        throw std::runtime_error("File cannot be written");
+    }
+}
+
+/**
+ * The magic bytes that start a compressed checkpoint file.
+ */
+static const char COMPRESSED_MAGIC[4] = {'G', 'O', 'L', 'C'};
+
+/**
+ * The most words stored in a single literal run of a compressed checkpoint file.
+ */
+static const int MAX_LITERAL_WORDS = 4096;
+
+/**
+ * read_varint(bytes, size, index)
+ *
+ * Private helper function to read an LEB128 varint, advancing index past it.
+ *
+ * @throws
+ *      std::runtime_error if the file ends in the middle of the varint, or it does not fit in 64 bits.
+ */
+static std::uint64_t read_varint(const unsigned char *bytes, std::size_t size, std::size_t &index) {
+    std::uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (index >= size) {
+            throw std::runtime_error("File ends wrong");
+        }
+
+        const unsigned char byte = bytes[index++];
+        value |= std::uint64_t(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return value;
+    }
+    throw std::runtime_error("File has an invalid run length");
+}
+
+/**
+ * Zoo::load_compressed(path)
+ *
+ * Load a compressed checkpoint file and parse it as a grid of cells.
+ * Runs of dead words are skipped over, and literal words are copied straight into the packed grid rows.
+ *
+ * @example
+ *
+ *      // Load a compressed checkpoint file from a directory
+ *      Grid grid = Zoo::load_compressed("path/to/file.cgol");
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @return
+ *      Returns the parsed grid.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The file cannot be opened.
+ *          - The file does not start with the magic bytes, or the width or height is negative.
+ *          - The runs cover more or fewer words than the grid holds.
+ *          - The file ends unexpectedly.
+ */
+Grid Zoo::load_compressed(const std::string &filePath) {
+    MappedFile file(filePath);
+    const unsigned char *bytes = file.data();
+    const std::size_t size = file.size();
+
+    int width = 0, height = 0;
+    const std::size_t header = sizeof(COMPRESSED_MAGIC) + sizeof(width) + sizeof(height);
+    if (size < header || std::memcmp(bytes, COMPRESSED_MAGIC, sizeof(COMPRESSED_MAGIC)) != 0) {
+        throw std::runtime_error("File is not a compressed grid");
+    }
+    std::memcpy(&width, bytes + sizeof(COMPRESSED_MAGIC), sizeof(width));
+    std::memcpy(&height, bytes + sizeof(COMPRESSED_MAGIC) + sizeof(width), sizeof(height));
+
+    if (width < 0 || height < 0) {
+        throw std::runtime_error("File has an invalid size");
+    }
+
+    Grid newGrid(width, height);
+    const int words_per_row = newGrid.get_words_per_row();
+    const std::uint64_t words = std::uint64_t(words_per_row) * std::uint64_t(height);
+
+    std::size_t index = header;
+    for (std::uint64_t word = 0; word < words;) {
+        const std::uint64_t dead = read_varint(bytes, size, index);
+        if (dead > words - word) {
+            throw std::runtime_error("File has an invalid run length");
+        }
+        word += dead;
+
+        const std::uint64_t literals = read_varint(bytes, size, index);
+        if (literals > words - word) {
+            throw std::runtime_error("File has an invalid run length");
+        }
+        if (literals > (size - index) / 8) {
+            throw std::runtime_error("File ends wrong");
+        }
+
+        for (std::uint64_t i = 0; i < literals; i++, word++, index += 8) {
+            newGrid.row_words(int(word / words_per_row))[word % words_per_row] = load_little_endian(bytes, size, index);
+        }
+    }
+
+    // Keep the padding past the end of each row dead, whatever the file held there
+    if (width % Grid::WORD_BITS != 0) {
+        const Grid::Word mask = (Grid::Word(1) << (width % Grid::WORD_BITS)) - 1;
+        for (int y = 0; y < height; y++) {
+            newGrid.row_words(y)[words_per_row - 1] &= mask;
+        }
+    }
+
+    return newGrid;
+}
+
+/**
+ * Zoo::save_compressed(path, grid)
+ *
+ * Save a grid as a compressed checkpoint file, storing only the words that hold alive cells,
+ * so the size of the file follows the population of the grid rather than its area.
+ *
+ * @example
+ *
+ *      // Checkpoint a mostly empty world in a handful of bytes
+ *      Zoo::save_compressed("path/to/file.cgol", world.get_state());
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param grid
+ *      The grid to be written out to file.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened or written to.
+ */
+void Zoo::save_compressed(const std::string &filePath, const Grid &grid) {
+    std::ofstream saveFile(filePath, std::ios::out | std::ios::binary);
+
+    if (!saveFile) {
+        throw std::runtime_error("File cannot be opened");
     }
 
+    const int width = grid.get_width(), height = grid.get_height(), words_per_row = grid.get_words_per_row();
+    saveFile.write(COMPRESSED_MAGIC, sizeof(COMPRESSED_MAGIC));
+    saveFile.write(reinterpret_cast<const char *>(&width), sizeof(width));
+    saveFile.write(reinterpret_cast<const char *>(&height), sizeof(height));
+
+    OutputBuffer buffer(saveFile);
+    auto emit_varint = [&](std::uint64_t value) {
+        do {
+            const unsigned char byte = (unsigned char) ((value & 0x7F) | (value > 0x7F ? 0x80 : 0));
+            *buffer.reserve(1) = char(byte);
+            value >>= 7;
+        } while (value != 0);
+    };
+
+    // Alternate runs of dead words with runs of words holding alive cells
+    const std::uint64_t words = std::uint64_t(words_per_row) * std::uint64_t(height);
+    auto word_at = [&](std::uint64_t word) {
+        return grid.row_words(int(word / words_per_row))[word % words_per_row];
+    };
+
+    for (std::uint64_t word = 0; word < words;) {
+        const std::uint64_t dead_start = word;
+        while (word < words && word_at(word) == 0) word++;
+        emit_varint(word - dead_start);
+
+        const std::uint64_t literal_start = word;
+        while (word < words && word_at(word) != 0 && word - literal_start < MAX_LITERAL_WORDS) word++;
+        emit_varint(word - literal_start);
+
+        for (std::uint64_t literal = literal_start; literal < word; literal++) {
+            const Grid::Word value = word_at(literal);
+            char *out = buffer.reserve(8);
+            for (int i = 0; i < 8; i++) {
+                out[i] = char((value >> (8 * i)) & 0xFF);
+            }
+        }
+    }
+    buffer.flush();
+
     saveFile.close();
+    if (!saveFile) {
+        throw std::runtime_error("File cannot be written");
+    }
+}
+
+/**
+ * has_extension(path, extension)
+ *
+ * Private helper function to check whether a path ends in an extension.
+ */
+static bool has_extension(const std::string &path, const std::string &extension) {
+    return path.size() >= extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+/**
+ * Zoo::load(path)
+ *
+ * Load a file in whichever format its extension names.
+ *      - .bgol is a binary file, .rle a Life RLE file, .cgol a compressed checkpoint, anything else ascii.
+ *
+ * @example
+ *
+ *      // Load a pattern without caring what format it is in
+ *      Grid grid = Zoo::load("path/to/file.rle");
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @return
+ *      Returns the parsed grid.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the loader for the format throws.
+ */
+Grid Zoo::load(const std::string &filePath) {
+    if (has_extension(filePath, ".bgol")) return load_binary(filePath);
+    if (has_extension(filePath, ".rle")) return load_rle(filePath);
+    if (has_extension(filePath, ".cgol")) return load_compressed(filePath);
+    return load_ascii(filePath);
+}
+
+/**
+ * Zoo::save(path, grid, rule)
+ *
+ * Save a grid in whichever format the extension of the path names, as for Zoo::load(path).
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param grid
+ *      The grid to be written out to file.
+ *
+ * @param rule
+ *      Optional parameter. The rule to name in formats that record one, only RLE. Defaults to Conway's Game of Life.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the writer for the format throws.
+ */
+void Zoo::save(const std::string &filePath, const Grid &grid, const Rule &rule) {
+    if (has_extension(filePath, ".bgol")) {
+        save_binary(filePath, grid);
+    } else if (has_extension(filePath, ".rle")) {
+        save_rle(filePath, grid, rule);
+    } else if (has_extension(filePath, ".cgol")) {
+        save_compressed(filePath, grid);
+    } else {
+        save_ascii(filePath, grid);
+    }
 }
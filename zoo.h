@@ -13,6 +13,7 @@
 // Add the minimal number of includes you need in order to declare the namespace.
 // #include ...
 #include "grid.h"
+#include "rule.h"
 
 /**
  * Declare the interface of the Zoo namespace for constructing lifeforms and saving and loading them from file.
@@ -31,4 +32,16 @@ namespace Zoo {
     Grid load_binary(const std::string& filePath);
 
     void save_binary(const std::string& filePath, const Grid& grid);
+
+    Grid load_rle(const std::string& filePath);
+
+    void save_rle(const std::string& filePath, const Grid& grid, const Rule& rule = Rule());
+
+    Grid load_compressed(const std::string& filePath);
+
+    void save_compressed(const std::string& filePath, const Grid& grid);
+
+    Grid load(const std::string& filePath);
+
+    void save(const std::string& filePath, const Grid& grid, const Rule& rule = Rule());
 }
\ No newline at end of file